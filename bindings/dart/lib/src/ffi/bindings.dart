@@ -52,6 +52,36 @@ class QuiverDatabaseBindings {
   late final _quiver_database_options_default = _quiver_database_options_defaultPtr
       .asFunction<quiver_database_options_t Function()>();
 
+  quiver_connection_profile_t quiver_connection_profile_bulk_load() {
+    return _quiver_connection_profile_bulk_load();
+  }
+
+  late final _quiver_connection_profile_bulk_loadPtr = _lookup<ffi.NativeFunction<quiver_connection_profile_t Function()>>(
+    'quiver_connection_profile_bulk_load',
+  );
+  late final _quiver_connection_profile_bulk_load = _quiver_connection_profile_bulk_loadPtr
+      .asFunction<quiver_connection_profile_t Function()>();
+
+  quiver_connection_profile_t quiver_connection_profile_read_mostly() {
+    return _quiver_connection_profile_read_mostly();
+  }
+
+  late final _quiver_connection_profile_read_mostlyPtr = _lookup<ffi.NativeFunction<quiver_connection_profile_t Function()>>(
+    'quiver_connection_profile_read_mostly',
+  );
+  late final _quiver_connection_profile_read_mostly = _quiver_connection_profile_read_mostlyPtr
+      .asFunction<quiver_connection_profile_t Function()>();
+
+  quiver_connection_profile_t quiver_connection_profile_durable() {
+    return _quiver_connection_profile_durable();
+  }
+
+  late final _quiver_connection_profile_durablePtr = _lookup<ffi.NativeFunction<quiver_connection_profile_t Function()>>(
+    'quiver_connection_profile_durable',
+  );
+  late final _quiver_connection_profile_durable = _quiver_connection_profile_durablePtr
+      .asFunction<quiver_connection_profile_t Function()>();
+
   quiver_csv_options_t quiver_csv_options_default() {
     return _quiver_csv_options_default();
   }
@@ -162,6 +192,54 @@ class QuiverDatabaseBindings {
         )
       >();
 
+  int quiver_database_open_in_memory_copy(
+    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<quiver_database_options_t> options,
+    ffi.Pointer<ffi.Pointer<quiver_database_t>> out_db,
+  ) {
+    return _quiver_database_open_in_memory_copy(
+      path,
+      options,
+      out_db,
+    );
+  }
+
+  late final _quiver_database_open_in_memory_copyPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_database_options_t>,
+            ffi.Pointer<ffi.Pointer<quiver_database_t>>,
+          )
+        >
+      >('quiver_database_open_in_memory_copy');
+  late final _quiver_database_open_in_memory_copy = _quiver_database_open_in_memory_copyPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_database_options_t>,
+          ffi.Pointer<ffi.Pointer<quiver_database_t>>,
+        )
+      >();
+
+  int quiver_database_save_to(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> path,
+  ) {
+    return _quiver_database_save_to(
+      db,
+      path,
+    );
+  }
+
+  late final _quiver_database_save_toPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>)>>(
+        'quiver_database_save_to',
+      );
+  late final _quiver_database_save_to = _quiver_database_save_toPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>)>();
+
   int quiver_database_close(
     ffi.Pointer<quiver_database_t> db,
   ) {
@@ -314,270 +392,697 @@ class QuiverDatabaseBindings {
   late final _quiver_database_in_dry_run = _quiver_database_in_dry_runPtr
       .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int>)>();
 
-  int quiver_database_current_version(
-    ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Int64> out_version,
-  ) {
-    return _quiver_database_current_version(
-      db,
-      out_version,
-    );
-  }
-
-  late final _quiver_database_current_versionPtr =
-      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int64>)>>(
-        'quiver_database_current_version',
-      );
-  late final _quiver_database_current_version = _quiver_database_current_versionPtr
-      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int64>)>();
-
-  int quiver_database_create_element(
+  int quiver_database_subscribe_changes(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<quiver_element_t> element,
-    ffi.Pointer<ffi.Int64> out_id,
+    quiver_change_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
+    ffi.Pointer<ffi.Int64> out_subscription,
   ) {
-    return _quiver_database_create_element(
+    return _quiver_database_subscribe_changes(
       db,
-      collection,
-      element,
-      out_id,
+      callback,
+      user_data,
+      out_subscription,
     );
   }
 
-  late final _quiver_database_create_elementPtr =
+  late final _quiver_database_subscribe_changesPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<quiver_element_t>,
+            quiver_change_callback_t,
+            ffi.Pointer<ffi.Void>,
             ffi.Pointer<ffi.Int64>,
           )
         >
-      >('quiver_database_create_element');
-  late final _quiver_database_create_element = _quiver_database_create_elementPtr
+      >('quiver_database_subscribe_changes');
+  late final _quiver_database_subscribe_changes = _quiver_database_subscribe_changesPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<quiver_element_t>,
+          quiver_change_callback_t,
+          ffi.Pointer<ffi.Void>,
           ffi.Pointer<ffi.Int64>,
         )
       >();
 
-  int quiver_database_update_element(
-    ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    int id,
-    ffi.Pointer<quiver_element_t> element,
-  ) {
-    return _quiver_database_update_element(
-      db,
-      collection,
-      id,
-      element,
-    );
-  }
-
-  late final _quiver_database_update_elementPtr =
-      _lookup<
-        ffi.NativeFunction<
-          ffi.Int32 Function(
-            ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<quiver_element_t>,
-          )
-        >
-      >('quiver_database_update_element');
-  late final _quiver_database_update_element = _quiver_database_update_elementPtr
-      .asFunction<
-        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, int, ffi.Pointer<quiver_element_t>)
-      >();
-
-  int quiver_database_delete_element(
+  int quiver_database_unsubscribe_changes(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    int id,
+    int subscription,
   ) {
-    return _quiver_database_delete_element(
+    return _quiver_database_unsubscribe_changes(
       db,
-      collection,
-      id,
+      subscription,
     );
   }
 
-  late final _quiver_database_delete_elementPtr =
-      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Int64)>>(
-        'quiver_database_delete_element',
+  late final _quiver_database_unsubscribe_changesPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Int64)>>(
+        'quiver_database_unsubscribe_changes',
       );
-  late final _quiver_database_delete_element = _quiver_database_delete_elementPtr
-      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, int)>();
+  late final _quiver_database_unsubscribe_changes = _quiver_database_unsubscribe_changesPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, int)>();
 
-  int quiver_database_read_scalar_integers(
+  int quiver_database_poll_changes(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
-    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_mask,
+    int subscription,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_sequences,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_tables,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_collections,
+    ffi.Pointer<ffi.Pointer<ffi.Int>> out_kinds,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_ids,
     ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_read_scalar_integers(
+    return _quiver_database_poll_changes(
       db,
-      collection,
-      attribute,
-      out_values,
-      out_mask,
+      subscription,
+      out_sequences,
+      out_tables,
+      out_collections,
+      out_kinds,
+      out_ids,
       out_count,
     );
   }
 
-  late final _quiver_database_read_scalar_integersPtr =
+  late final _quiver_database_poll_changesPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Int>>,
             ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
             ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_scalar_integers');
-  late final _quiver_database_read_scalar_integers = _quiver_database_read_scalar_integersPtr
+      >('quiver_database_poll_changes');
+  late final _quiver_database_poll_changes = _quiver_database_poll_changesPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Int>>,
           ffi.Pointer<ffi.Pointer<ffi.Int64>>,
-          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
           ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_read_scalar_floats(
-    ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
-    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_mask,
-    ffi.Pointer<ffi.Size> out_count,
+  int quiver_database_free_changes(
+    ffi.Pointer<ffi.Int64> sequences,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> tables,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> collections,
+    ffi.Pointer<ffi.Int> kinds,
+    ffi.Pointer<ffi.Int64> ids,
+    int count,
   ) {
-    return _quiver_database_read_scalar_floats(
-      db,
-      collection,
-      attribute,
-      out_values,
-      out_mask,
-      out_count,
+    return _quiver_database_free_changes(
+      sequences,
+      tables,
+      collections,
+      kinds,
+      ids,
+      count,
     );
   }
 
-  late final _quiver_database_read_scalar_floatsPtr =
+  late final _quiver_database_free_changesPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
-            ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Double>>,
-            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
-            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
           )
         >
-      >('quiver_database_read_scalar_floats');
-  late final _quiver_database_read_scalar_floats = _quiver_database_read_scalar_floatsPtr
+      >('quiver_database_free_changes');
+  late final _quiver_database_free_changes = _quiver_database_free_changesPtr
       .asFunction<
         int Function(
-          ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Double>>,
-          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
-          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Int64>,
+          int,
         )
       >();
 
-  int quiver_database_read_scalar_strings(
+  int quiver_database_enable_stats(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    int enabled,
+  ) {
+    return _quiver_database_enable_stats(
+      db,
+      enabled,
+    );
+  }
+
+  late final _quiver_database_enable_statsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Int)>>(
+        'quiver_database_enable_stats',
+      );
+  late final _quiver_database_enable_stats = _quiver_database_enable_statsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, int)>();
+
+  int quiver_database_stats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Pointer<quiver_operation_stats_t>> out_stats,
     ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_read_scalar_strings(
+    return _quiver_database_stats(
       db,
-      collection,
-      attribute,
-      out_values,
+      out_stats,
       out_count,
     );
   }
 
-  late final _quiver_database_read_scalar_stringsPtr =
+  late final _quiver_database_statsPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<quiver_operation_stats_t>>,
             ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_scalar_strings');
-  late final _quiver_database_read_scalar_strings = _quiver_database_read_scalar_stringsPtr
+      >('quiver_database_stats');
+  late final _quiver_database_stats = _quiver_database_statsPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<quiver_operation_stats_t>>,
           ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_read_vector_integers(
+  int quiver_database_reset_stats(
     ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> collection,
-    ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>> out_vectors,
-    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+  ) {
+    return _quiver_database_reset_stats(
+      db,
+    );
+  }
+
+  late final _quiver_database_reset_statsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>('quiver_database_reset_stats');
+  late final _quiver_database_reset_stats = _quiver_database_reset_statsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
+  int quiver_database_free_stats(
+    ffi.Pointer<quiver_operation_stats_t> stats,
+    int count,
+  ) {
+    return _quiver_database_free_stats(
+      stats,
+      count,
+    );
+  }
+
+  late final _quiver_database_free_statsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_operation_stats_t>, ffi.Size)>>(
+        'quiver_database_free_stats',
+      );
+  late final _quiver_database_free_stats = _quiver_database_free_statsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_operation_stats_t>, int)>();
+
+  int quiver_database_traced_statements(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Pointer<quiver_traced_statement_t>> out_statements,
     ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_read_vector_integers(
+    return _quiver_database_traced_statements(
       db,
-      collection,
-      attribute,
-      out_vectors,
-      out_sizes,
+      out_statements,
       out_count,
     );
   }
 
-  late final _quiver_database_read_vector_integersPtr =
+  late final _quiver_database_traced_statementsPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
-            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Pointer<quiver_traced_statement_t>>,
             ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_vector_integers');
-  late final _quiver_database_read_vector_integers = _quiver_database_read_vector_integersPtr
+      >('quiver_database_traced_statements');
+  late final _quiver_database_traced_statements = _quiver_database_traced_statementsPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
+          ffi.Pointer<ffi.Pointer<quiver_traced_statement_t>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_clear_traced_statements(
+    ffi.Pointer<quiver_database_t> db,
+  ) {
+    return _quiver_database_clear_traced_statements(
+      db,
+    );
+  }
+
+  late final _quiver_database_clear_traced_statementsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>)>>(
+        'quiver_database_clear_traced_statements',
+      );
+  late final _quiver_database_clear_traced_statements = _quiver_database_clear_traced_statementsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>)>();
+
+  int quiver_database_free_traced_statements(
+    ffi.Pointer<quiver_traced_statement_t> statements,
+    int count,
+  ) {
+    return _quiver_database_free_traced_statements(
+      statements,
+      count,
+    );
+  }
+
+  late final _quiver_database_free_traced_statementsPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_traced_statement_t>, ffi.Size)>>(
+        'quiver_database_free_traced_statements',
+      );
+  late final _quiver_database_free_traced_statements = _quiver_database_free_traced_statementsPtr
+      .asFunction<int Function(ffi.Pointer<quiver_traced_statement_t>, int)>();
+
+  int quiver_database_current_version(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Int64> out_version,
+  ) {
+    return _quiver_database_current_version(
+      db,
+      out_version,
+    );
+  }
+
+  late final _quiver_database_current_versionPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int64>)>>(
+        'quiver_database_current_version',
+      );
+  late final _quiver_database_current_version = _quiver_database_current_versionPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Int64>)>();
+
+  int quiver_database_create_element(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<quiver_element_t> element,
+    ffi.Pointer<ffi.Int64> out_id,
+  ) {
+    return _quiver_database_create_element(
+      db,
+      collection,
+      element,
+      out_id,
+    );
+  }
+
+  late final _quiver_database_create_elementPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_element_t>,
+            ffi.Pointer<ffi.Int64>,
+          )
+        >
+      >('quiver_database_create_element');
+  late final _quiver_database_create_element = _quiver_database_create_elementPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_element_t>,
+          ffi.Pointer<ffi.Int64>,
+        )
+      >();
+
+  int quiver_database_create_elements(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Pointer<quiver_element_t>> elements,
+    int element_count,
+    ffi.Pointer<ffi.Int64> out_ids,
+  ) {
+    return _quiver_database_create_elements(
+      db,
+      collection,
+      elements,
+      element_count,
+      out_ids,
+    );
+  }
+
+  late final _quiver_database_create_elementsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<quiver_element_t>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Int64>,
+          )
+        >
+      >('quiver_database_create_elements');
+  late final _quiver_database_create_elements = _quiver_database_create_elementsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<quiver_element_t>>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+        )
+      >();
+
+  int quiver_database_update_element(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    int id,
+    ffi.Pointer<quiver_element_t> element,
+  ) {
+    return _quiver_database_update_element(
+      db,
+      collection,
+      id,
+      element,
+    );
+  }
+
+  late final _quiver_database_update_elementPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<quiver_element_t>,
+          )
+        >
+      >('quiver_database_update_element');
+  late final _quiver_database_update_element = _quiver_database_update_elementPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, int, ffi.Pointer<quiver_element_t>)
+      >();
+
+  int quiver_database_delete_element(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    int id,
+  ) {
+    return _quiver_database_delete_element(
+      db,
+      collection,
+      id,
+    );
+  }
+
+  late final _quiver_database_delete_elementPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Int64)>>(
+        'quiver_database_delete_element',
+      );
+  late final _quiver_database_delete_element = _quiver_database_delete_elementPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, int)>();
+
+  int quiver_database_delete_elements(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<quiver_delete_result_t> out_result,
+  ) {
+    return _quiver_database_delete_elements(
+      db,
+      collection,
+      ids,
+      id_count,
+      out_result,
+    );
+  }
+
+  late final _quiver_database_delete_elementsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<quiver_delete_result_t>,
+          )
+        >
+      >('quiver_database_delete_elements');
+  late final _quiver_database_delete_elements = _quiver_database_delete_elementsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          int,
+          ffi.Pointer<quiver_delete_result_t>,
+        )
+      >();
+
+  int quiver_database_delete_elements_where(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> predicate,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<quiver_delete_result_t> out_result,
+  ) {
+    return _quiver_database_delete_elements_where(
+      db,
+      collection,
+      predicate,
+      param_types,
+      param_values,
+      param_count,
+      out_result,
+    );
+  }
+
+  late final _quiver_database_delete_elements_wherePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<quiver_delete_result_t>,
+          )
+        >
+      >('quiver_database_delete_elements_where');
+  late final _quiver_database_delete_elements_where = _quiver_database_delete_elements_wherePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<quiver_delete_result_t>,
+        )
+      >();
+
+  int quiver_database_free_delete_result(
+    ffi.Pointer<quiver_delete_result_t> result,
+  ) {
+    return _quiver_database_free_delete_result(
+      result,
+    );
+  }
+
+  late final _quiver_database_free_delete_resultPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_delete_result_t>)>>(
+        'quiver_database_free_delete_result',
+      );
+  late final _quiver_database_free_delete_result = _quiver_database_free_delete_resultPtr
+      .asFunction<int Function(ffi.Pointer<quiver_delete_result_t>)>();
+
+  int quiver_database_read_scalar_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_mask,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_integers(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_mask,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_integers');
+  late final _quiver_database_read_scalar_integers = _quiver_database_read_scalar_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_floats(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_mask,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_floats(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_mask,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_floatsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_floats');
+  late final _quiver_database_read_scalar_floats = _quiver_database_read_scalar_floatsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_strings(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_scalar_strings(
+      db,
+      collection,
+      attribute,
+      out_values,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_scalar_stringsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_scalar_strings');
+  late final _quiver_database_read_scalar_strings = _quiver_database_read_scalar_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_vector_integers(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>> out_vectors,
+    ffi.Pointer<ffi.Pointer<ffi.Size>> out_sizes,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_vector_integers(
+      db,
+      collection,
+      attribute,
+      out_vectors,
+      out_sizes,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_read_vector_integersPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Size>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_vector_integers');
+  late final _quiver_database_read_vector_integers = _quiver_database_read_vector_integersPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Int64>>>,
           ffi.Pointer<ffi.Pointer<ffi.Size>>,
           ffi.Pointer<ffi.Size>,
         )
@@ -785,145 +1290,294 @@ class QuiverDatabaseBindings {
             ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_set_strings');
-  late final _quiver_database_read_set_strings = _quiver_database_read_set_stringsPtr
+      >('quiver_database_read_set_strings');
+  late final _quiver_database_read_set_strings = _quiver_database_read_set_stringsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Size>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_read_scalar_integer_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Int64> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_read_scalar_integer_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_read_scalar_integer_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_read_scalar_integer_by_id');
+  late final _quiver_database_read_scalar_integer_by_id = _quiver_database_read_scalar_integer_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_read_scalar_float_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_read_scalar_float_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_read_scalar_float_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_read_scalar_float_by_id');
+  late final _quiver_database_read_scalar_float_by_id = _quiver_database_read_scalar_float_by_idPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_read_scalar_string_by_id(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> attribute,
+    int id,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_read_scalar_string_by_id(
+      db,
+      collection,
+      attribute,
+      id,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_read_scalar_string_by_idPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_read_scalar_string_by_id');
+  late final _quiver_database_read_scalar_string_by_id = _quiver_database_read_scalar_string_by_idPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>>,
-          ffi.Pointer<ffi.Pointer<ffi.Size>>,
-          ffi.Pointer<ffi.Size>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
         )
       >();
 
-  int quiver_database_read_scalar_integer_by_id(
+  int quiver_database_read_scalar_integers_by_ids(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Int64> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_mask,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_read_scalar_integer_by_id(
+    return _quiver_database_read_scalar_integers_by_ids(
       db,
       collection,
       attribute,
-      id,
-      out_value,
-      out_has_value,
+      ids,
+      id_count,
+      out_values,
+      out_mask,
+      out_count,
     );
   }
 
-  late final _quiver_database_read_scalar_integer_by_idPtr =
+  late final _quiver_database_read_scalar_integers_by_idsPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
             ffi.Pointer<ffi.Int64>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_scalar_integer_by_id');
-  late final _quiver_database_read_scalar_integer_by_id = _quiver_database_read_scalar_integer_by_idPtr
+      >('quiver_database_read_scalar_integers_by_ids');
+  late final _quiver_database_read_scalar_integers_by_ids = _quiver_database_read_scalar_integers_by_idsPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
           ffi.Pointer<ffi.Int64>,
-          ffi.Pointer<ffi.Int>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_read_scalar_float_by_id(
+  int quiver_database_read_scalar_floats_by_ids(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Double> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Double>> out_values,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> out_mask,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_read_scalar_float_by_id(
+    return _quiver_database_read_scalar_floats_by_ids(
       db,
       collection,
       attribute,
-      id,
-      out_value,
-      out_has_value,
+      ids,
+      id_count,
+      out_values,
+      out_mask,
+      out_count,
     );
   }
 
-  late final _quiver_database_read_scalar_float_by_idPtr =
+  late final _quiver_database_read_scalar_floats_by_idsPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Double>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Double>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_scalar_float_by_id');
-  late final _quiver_database_read_scalar_float_by_id = _quiver_database_read_scalar_float_by_idPtr
+      >('quiver_database_read_scalar_floats_by_ids');
+  late final _quiver_database_read_scalar_floats_by_ids = _quiver_database_read_scalar_floats_by_idsPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
           int,
-          ffi.Pointer<ffi.Double>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Double>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_read_scalar_string_by_id(
+  int quiver_database_read_scalar_strings_by_ids(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> attribute,
-    int id,
-    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
-    ffi.Pointer<ffi.Int> out_has_value,
+    ffi.Pointer<ffi.Int64> ids,
+    int id_count,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
   ) {
-    return _quiver_database_read_scalar_string_by_id(
+    return _quiver_database_read_scalar_strings_by_ids(
       db,
       collection,
       attribute,
-      id,
-      out_value,
-      out_has_value,
+      ids,
+      id_count,
+      out_values,
+      out_count,
     );
   }
 
-  late final _quiver_database_read_scalar_string_by_idPtr =
+  late final _quiver_database_read_scalar_strings_by_idsPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Char>>,
-            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_scalar_string_by_id');
-  late final _quiver_database_read_scalar_string_by_id = _quiver_database_read_scalar_string_by_idPtr
+      >('quiver_database_read_scalar_strings_by_ids');
+  late final _quiver_database_read_scalar_strings_by_ids = _quiver_database_read_scalar_strings_by_idsPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
           int,
-          ffi.Pointer<ffi.Pointer<ffi.Char>>,
-          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
@@ -1762,6 +2416,65 @@ class QuiverDatabaseBindings {
         )
       >();
 
+  int quiver_database_read_time_series_group_all(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> group,
+    ffi.Pointer<ffi.Pointer<ffi.Int64>> out_ids,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_column_names,
+    ffi.Pointer<ffi.Pointer<ffi.Int>> out_column_types,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Void>>> out_column_data,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Uint8>>> out_column_has_value,
+    ffi.Pointer<ffi.Size> out_column_count,
+    ffi.Pointer<ffi.Size> out_row_count,
+  ) {
+    return _quiver_database_read_time_series_group_all(
+      db,
+      collection,
+      group,
+      out_ids,
+      out_column_names,
+      out_column_types,
+      out_column_data,
+      out_column_has_value,
+      out_column_count,
+      out_row_count,
+    );
+  }
+
+  late final _quiver_database_read_time_series_group_allPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Int>>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Void>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Uint8>>>,
+            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_read_time_series_group_all');
+  late final _quiver_database_read_time_series_group_all = _quiver_database_read_time_series_group_allPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Int64>>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Int>>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Void>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Uint8>>>,
+          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
   int quiver_database_update_vector_group(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
@@ -1949,70 +2662,186 @@ class QuiverDatabaseBindings {
     ffi.Pointer<ffi.Pointer<ffi.Void>> column_data,
     int column_count,
   ) {
-    return _quiver_database_upsert_time_series_row(
+    return _quiver_database_upsert_time_series_row(
+      db,
+      collection,
+      group,
+      id,
+      column_names,
+      column_types,
+      column_data,
+      column_count,
+    );
+  }
+
+  late final _quiver_database_upsert_time_series_rowPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+          )
+        >
+      >('quiver_database_upsert_time_series_row');
+  late final _quiver_database_upsert_time_series_row = _quiver_database_upsert_time_series_rowPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+        )
+      >();
+
+  int quiver_database_write_time_series(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> group,
+    ffi.Pointer<ffi.Int64> ids,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> column_names,
+    ffi.Pointer<ffi.Int> column_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> column_data,
+    ffi.Pointer<ffi.Pointer<ffi.Uint8>> column_has_value,
+    int column_count,
+    int row_count,
+    int mode,
+  ) {
+    return _quiver_database_write_time_series(
+      db,
+      collection,
+      group,
+      ids,
+      column_names,
+      column_types,
+      column_data,
+      column_has_value,
+      column_count,
+      row_count,
+      mode,
+    );
+  }
+
+  late final _quiver_database_write_time_seriesPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+            ffi.Size,
+            ffi.Size,
+            ffi.Int,
+          )
+        >
+      >('quiver_database_write_time_series');
+  late final _quiver_database_write_time_series = _quiver_database_write_time_seriesPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          ffi.Pointer<ffi.Pointer<ffi.Uint8>>,
+          int,
+          int,
+          int,
+        )
+      >();
+
+  int quiver_database_read_time_series_row(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> group,
+    ffi.Pointer<ffi.Char> attribute,
+    ffi.Pointer<ffi.Char> date_time,
+    ffi.Pointer<ffi.Int> out_data_type,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> out_values,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_read_time_series_row(
       db,
       collection,
       group,
-      id,
-      column_names,
-      column_types,
-      column_data,
-      column_count,
+      attribute,
+      date_time,
+      out_data_type,
+      out_values,
+      out_count,
     );
   }
 
-  late final _quiver_database_upsert_time_series_rowPtr =
+  late final _quiver_database_read_time_series_rowPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
             ffi.Pointer<quiver_database_t>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Int64,
-            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Int>,
             ffi.Pointer<ffi.Pointer<ffi.Void>>,
-            ffi.Size,
+            ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_upsert_time_series_row');
-  late final _quiver_database_upsert_time_series_row = _quiver_database_upsert_time_series_rowPtr
+      >('quiver_database_read_time_series_row');
+  late final _quiver_database_read_time_series_row = _quiver_database_read_time_series_rowPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          int,
-          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Int>,
           ffi.Pointer<ffi.Pointer<ffi.Void>>,
-          int,
+          ffi.Pointer<ffi.Size>,
         )
       >();
 
-  int quiver_database_read_time_series_row(
+  int quiver_database_read_time_series_rows(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Char> collection,
     ffi.Pointer<ffi.Char> group,
     ffi.Pointer<ffi.Char> attribute,
-    ffi.Pointer<ffi.Char> date_time,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> date_times,
+    int date_time_count,
     ffi.Pointer<ffi.Int> out_data_type,
     ffi.Pointer<ffi.Pointer<ffi.Void>> out_values,
-    ffi.Pointer<ffi.Size> out_count,
+    ffi.Pointer<ffi.Size> out_element_count,
   ) {
-    return _quiver_database_read_time_series_row(
+    return _quiver_database_read_time_series_rows(
       db,
       collection,
       group,
       attribute,
-      date_time,
+      date_times,
+      date_time_count,
       out_data_type,
       out_values,
-      out_count,
+      out_element_count,
     );
   }
 
-  late final _quiver_database_read_time_series_rowPtr =
+  late final _quiver_database_read_time_series_rowsPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
@@ -2020,21 +2849,23 @@ class QuiverDatabaseBindings {
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Size,
             ffi.Pointer<ffi.Int>,
             ffi.Pointer<ffi.Pointer<ffi.Void>>,
             ffi.Pointer<ffi.Size>,
           )
         >
-      >('quiver_database_read_time_series_row');
-  late final _quiver_database_read_time_series_row = _quiver_database_read_time_series_rowPtr
+      >('quiver_database_read_time_series_rows');
+  late final _quiver_database_read_time_series_rows = _quiver_database_read_time_series_rowsPtr
       .asFunction<
         int Function(
           ffi.Pointer<quiver_database_t>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          int,
           ffi.Pointer<ffi.Int>,
           ffi.Pointer<ffi.Pointer<ffi.Void>>,
           ffi.Pointer<ffi.Size>,
@@ -2635,64 +3466,335 @@ class QuiverDatabaseBindings {
       >('quiver_database_query_integer_params');
   late final _quiver_database_query_integer_params = _quiver_database_query_integer_paramsPtr
       .asFunction<
-        int Function(
-          ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Int>,
-          ffi.Pointer<ffi.Pointer<ffi.Void>>,
-          int,
-          ffi.Pointer<ffi.Int64>,
-          ffi.Pointer<ffi.Int>,
-        )
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ffi.Int64>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_query_float_params(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_query_float_params(
+      db,
+      sql,
+      param_types,
+      param_values,
+      param_count,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_query_float_paramsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_query_float_params');
+  late final _quiver_database_query_float_params = _quiver_database_query_float_paramsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Int>,
+        )
+      >();
+
+  int quiver_database_query_table(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>> out_column_names,
+    ffi.Pointer<ffi.Pointer<ffi.Int>> out_column_types,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Void>>> out_column_data,
+    ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Uint8>>> out_column_has_value,
+    ffi.Pointer<ffi.Size> out_column_count,
+    ffi.Pointer<ffi.Size> out_row_count,
+  ) {
+    return _quiver_database_query_table(
+      db,
+      sql,
+      param_types,
+      param_values,
+      param_count,
+      out_column_names,
+      out_column_types,
+      out_column_data,
+      out_column_has_value,
+      out_column_count,
+      out_row_count,
+    );
+  }
+
+  late final _quiver_database_query_tablePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Int>>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Void>>>,
+            ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Uint8>>>,
+            ffi.Pointer<ffi.Size>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_query_table');
+  late final _quiver_database_query_table = _quiver_database_query_tablePtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Char>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Int>>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Void>>>,
+          ffi.Pointer<ffi.Pointer<ffi.Pointer<ffi.Uint8>>>,
+          ffi.Pointer<ffi.Size>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_cursor_open(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Char> sql,
+    ffi.Pointer<ffi.Int> param_types,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
+    int param_count,
+    ffi.Pointer<ffi.Pointer<quiver_database_cursor_t>> out_cursor,
+  ) {
+    return _quiver_database_cursor_open(
+      db,
+      sql,
+      param_types,
+      param_values,
+      param_count,
+      out_cursor,
+    );
+  }
+
+  late final _quiver_database_cursor_openPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Int>,
+            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Size,
+            ffi.Pointer<ffi.Pointer<quiver_database_cursor_t>>,
+          )
+        >
+      >('quiver_database_cursor_open');
+  late final _quiver_database_cursor_open = _quiver_database_cursor_openPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Int>,
+          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          int,
+          ffi.Pointer<ffi.Pointer<quiver_database_cursor_t>>,
+        )
+      >();
+
+  int quiver_database_cursor_next(
+    ffi.Pointer<quiver_database_cursor_t> cursor,
+    ffi.Pointer<ffi.Int> out_has_row,
+  ) {
+    return _quiver_database_cursor_next(
+      cursor,
+      out_has_row,
+    );
+  }
+
+  late final _quiver_database_cursor_nextPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_cursor_t>, ffi.Pointer<ffi.Int>)>>(
+        'quiver_database_cursor_next',
+      );
+  late final _quiver_database_cursor_next = _quiver_database_cursor_nextPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_cursor_t>, ffi.Pointer<ffi.Int>)>();
+
+  int quiver_database_cursor_column_count(
+    ffi.Pointer<quiver_database_cursor_t> cursor,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_cursor_column_count(
+      cursor,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_cursor_column_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_cursor_t>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_database_cursor_column_count',
+      );
+  late final _quiver_database_cursor_column_count = _quiver_database_cursor_column_countPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_cursor_t>, ffi.Pointer<ffi.Size>)>();
+
+  int quiver_database_cursor_column_name(
+    ffi.Pointer<quiver_database_cursor_t> cursor,
+    int index,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_name,
+  ) {
+    return _quiver_database_cursor_column_name(
+      cursor,
+      index,
+      out_name,
+    );
+  }
+
+  late final _quiver_database_cursor_column_namePtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_cursor_t>, ffi.Size, ffi.Pointer<ffi.Pointer<ffi.Char>>)
+        >
+      >('quiver_database_cursor_column_name');
+  late final _quiver_database_cursor_column_name = _quiver_database_cursor_column_namePtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_cursor_t>, int, ffi.Pointer<ffi.Pointer<ffi.Char>>)>();
+
+  int quiver_database_cursor_get_integer(
+    ffi.Pointer<quiver_database_cursor_t> cursor,
+    int index,
+    ffi.Pointer<ffi.Int64> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_cursor_get_integer(
+      cursor,
+      index,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_cursor_get_integerPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_cursor_t>,
+            ffi.Size,
+            ffi.Pointer<ffi.Int64>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_cursor_get_integer');
+  late final _quiver_database_cursor_get_integer = _quiver_database_cursor_get_integerPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_database_cursor_t>, int, ffi.Pointer<ffi.Int64>, ffi.Pointer<ffi.Int>)
+      >();
+
+  int quiver_database_cursor_get_float(
+    ffi.Pointer<quiver_database_cursor_t> cursor,
+    int index,
+    ffi.Pointer<ffi.Double> out_value,
+    ffi.Pointer<ffi.Int> out_has_value,
+  ) {
+    return _quiver_database_cursor_get_float(
+      cursor,
+      index,
+      out_value,
+      out_has_value,
+    );
+  }
+
+  late final _quiver_database_cursor_get_floatPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_cursor_t>,
+            ffi.Size,
+            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Int>,
+          )
+        >
+      >('quiver_database_cursor_get_float');
+  late final _quiver_database_cursor_get_float = _quiver_database_cursor_get_floatPtr
+      .asFunction<
+        int Function(ffi.Pointer<quiver_database_cursor_t>, int, ffi.Pointer<ffi.Double>, ffi.Pointer<ffi.Int>)
       >();
 
-  int quiver_database_query_float_params(
-    ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Char> sql,
-    ffi.Pointer<ffi.Int> param_types,
-    ffi.Pointer<ffi.Pointer<ffi.Void>> param_values,
-    int param_count,
-    ffi.Pointer<ffi.Double> out_value,
+  int quiver_database_cursor_get_string(
+    ffi.Pointer<quiver_database_cursor_t> cursor,
+    int index,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_value,
     ffi.Pointer<ffi.Int> out_has_value,
   ) {
-    return _quiver_database_query_float_params(
-      db,
-      sql,
-      param_types,
-      param_values,
-      param_count,
+    return _quiver_database_cursor_get_string(
+      cursor,
+      index,
       out_value,
       out_has_value,
     );
   }
 
-  late final _quiver_database_query_float_paramsPtr =
+  late final _quiver_database_cursor_get_stringPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
-            ffi.Pointer<quiver_database_t>,
-            ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Int>,
-            ffi.Pointer<ffi.Pointer<ffi.Void>>,
+            ffi.Pointer<quiver_database_cursor_t>,
             ffi.Size,
-            ffi.Pointer<ffi.Double>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
             ffi.Pointer<ffi.Int>,
           )
         >
-      >('quiver_database_query_float_params');
-  late final _quiver_database_query_float_params = _quiver_database_query_float_paramsPtr
+      >('quiver_database_cursor_get_string');
+  late final _quiver_database_cursor_get_string = _quiver_database_cursor_get_stringPtr
       .asFunction<
         int Function(
-          ffi.Pointer<quiver_database_t>,
-          ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Int>,
-          ffi.Pointer<ffi.Pointer<ffi.Void>>,
+          ffi.Pointer<quiver_database_cursor_t>,
           int,
-          ffi.Pointer<ffi.Double>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
           ffi.Pointer<ffi.Int>,
         )
       >();
 
+  int quiver_database_cursor_close(
+    ffi.Pointer<quiver_database_cursor_t> cursor,
+  ) {
+    return _quiver_database_cursor_close(
+      cursor,
+    );
+  }
+
+  late final _quiver_database_cursor_closePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_database_cursor_t>)>>(
+        'quiver_database_cursor_close',
+      );
+  late final _quiver_database_cursor_close = _quiver_database_cursor_closePtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_cursor_t>)>();
+
   int quiver_database_describe(
     ffi.Pointer<quiver_database_t> db,
     ffi.Pointer<ffi.Pointer<ffi.Char>> out_report,
@@ -2756,6 +3858,85 @@ class QuiverDatabaseBindings {
         int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Pointer<ffi.Char>>)
       >();
 
+  int quiver_database_missing_indexes(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Pointer<quiver_missing_index_t>> out_indexes,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_missing_indexes(
+      db,
+      out_indexes,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_missing_indexesPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Pointer<quiver_missing_index_t>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_missing_indexes');
+  late final _quiver_database_missing_indexes = _quiver_database_missing_indexesPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Pointer<quiver_missing_index_t>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_ensure_indexes(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Pointer<quiver_missing_index_t>> out_created,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_database_ensure_indexes(
+      db,
+      out_created,
+      out_count,
+    );
+  }
+
+  late final _quiver_database_ensure_indexesPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_database_t>,
+            ffi.Pointer<ffi.Pointer<quiver_missing_index_t>>,
+            ffi.Pointer<ffi.Size>,
+          )
+        >
+      >('quiver_database_ensure_indexes');
+  late final _quiver_database_ensure_indexes = _quiver_database_ensure_indexesPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_database_t>,
+          ffi.Pointer<ffi.Pointer<quiver_missing_index_t>>,
+          ffi.Pointer<ffi.Size>,
+        )
+      >();
+
+  int quiver_database_free_missing_indexes(
+    ffi.Pointer<quiver_missing_index_t> indexes,
+    int count,
+  ) {
+    return _quiver_database_free_missing_indexes(
+      indexes,
+      count,
+    );
+  }
+
+  late final _quiver_database_free_missing_indexesPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_missing_index_t>, ffi.Size)>>(
+        'quiver_database_free_missing_indexes',
+      );
+  late final _quiver_database_free_missing_indexes = _quiver_database_free_missing_indexesPtr
+      .asFunction<int Function(ffi.Pointer<quiver_missing_index_t>, int)>();
+
   int quiver_element_create(
     ffi.Pointer<ffi.Pointer<quiver_element_t1>> out_element,
   ) {
@@ -3031,127 +4212,457 @@ class QuiverDatabaseBindings {
   ) {
     return _quiver_element_scalar_count(
       element,
-      out_count,
+      out_count,
+    );
+  }
+
+  late final _quiver_element_scalar_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_element_scalar_count',
+      );
+  late final _quiver_element_scalar_count = _quiver_element_scalar_countPtr
+      .asFunction<int Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Size>)>();
+
+  int quiver_element_array_count(
+    ffi.Pointer<quiver_element_t1> element,
+    ffi.Pointer<ffi.Size> out_count,
+  ) {
+    return _quiver_element_array_count(
+      element,
+      out_count,
+    );
+  }
+
+  late final _quiver_element_array_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Size>)>>(
+        'quiver_element_array_count',
+      );
+  late final _quiver_element_array_count = _quiver_element_array_countPtr
+      .asFunction<int Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Size>)>();
+
+  int quiver_element_to_string(
+    ffi.Pointer<quiver_element_t1> element,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_string,
+  ) {
+    return _quiver_element_to_string(
+      element,
+      out_string,
+    );
+  }
+
+  late final _quiver_element_to_stringPtr =
+      _lookup<
+        ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Pointer<ffi.Char>>)>
+      >('quiver_element_to_string');
+  late final _quiver_element_to_string = _quiver_element_to_stringPtr
+      .asFunction<int Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Pointer<ffi.Char>>)>();
+
+  int quiver_lua_runner_new(
+    ffi.Pointer<quiver_database_t> db,
+    ffi.Pointer<ffi.Pointer<quiver_lua_runner_t>> out_runner,
+  ) {
+    return _quiver_lua_runner_new(
+      db,
+      out_runner,
+    );
+  }
+
+  late final _quiver_lua_runner_newPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Pointer<quiver_lua_runner_t>>)
+        >
+      >('quiver_lua_runner_new');
+  late final _quiver_lua_runner_new = _quiver_lua_runner_newPtr
+      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Pointer<quiver_lua_runner_t>>)>();
+
+  int quiver_lua_runner_free(
+    ffi.Pointer<quiver_lua_runner_t> runner,
+  ) {
+    return _quiver_lua_runner_free(
+      runner,
+    );
+  }
+
+  late final _quiver_lua_runner_freePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_lua_runner_t>)>>('quiver_lua_runner_free');
+  late final _quiver_lua_runner_free = _quiver_lua_runner_freePtr
+      .asFunction<int Function(ffi.Pointer<quiver_lua_runner_t>)>();
+
+  int quiver_lua_runner_run(
+    ffi.Pointer<quiver_lua_runner_t> runner,
+    ffi.Pointer<ffi.Char> script,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> out_result,
+  ) {
+    return _quiver_lua_runner_run(
+      runner,
+      script,
+      out_result,
+    );
+  }
+
+  late final _quiver_lua_runner_runPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_lua_runner_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          )
+        >
+      >('quiver_lua_runner_run');
+  late final _quiver_lua_runner_run = _quiver_lua_runner_runPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_lua_runner_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+        )
+      >();
+
+  int quiver_lua_runner_free_string(
+    ffi.Pointer<ffi.Char> str,
+  ) {
+    return _quiver_lua_runner_free_string(
+      str,
+    );
+  }
+
+  late final _quiver_lua_runner_free_stringPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<ffi.Char>)>>(
+    'quiver_lua_runner_free_string',
+  );
+  late final _quiver_lua_runner_free_string = _quiver_lua_runner_free_stringPtr
+      .asFunction<int Function(ffi.Pointer<ffi.Char>)>();
+
+  quiver_async_database_options_t quiver_async_database_options_default() {
+    return _quiver_async_database_options_default();
+  }
+
+  late final _quiver_async_database_options_defaultPtr =
+      _lookup<ffi.NativeFunction<quiver_async_database_options_t Function()>>('quiver_async_database_options_default');
+  late final _quiver_async_database_options_default = _quiver_async_database_options_defaultPtr
+      .asFunction<quiver_async_database_options_t Function()>();
+
+  int quiver_async_database_open(
+    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<quiver_database_options_t> options,
+    ffi.Pointer<quiver_async_database_options_t> async_options,
+    ffi.Pointer<ffi.Pointer<quiver_async_database_t>> out_db,
+  ) {
+    return _quiver_async_database_open(
+      path,
+      options,
+      async_options,
+      out_db,
+    );
+  }
+
+  late final _quiver_async_database_openPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_database_options_t>,
+            ffi.Pointer<quiver_async_database_options_t>,
+            ffi.Pointer<ffi.Pointer<quiver_async_database_t>>,
+          )
+        >
+      >('quiver_async_database_open');
+  late final _quiver_async_database_open = _quiver_async_database_openPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_database_options_t>,
+          ffi.Pointer<quiver_async_database_options_t>,
+          ffi.Pointer<ffi.Pointer<quiver_async_database_t>>,
+        )
+      >();
+
+  int quiver_async_database_close(
+    ffi.Pointer<quiver_async_database_t> db,
+  ) {
+    return _quiver_async_database_close(
+      db,
+    );
+  }
+
+  late final _quiver_async_database_closePtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_async_database_t>)>>(
+        'quiver_async_database_close',
+      );
+  late final _quiver_async_database_close = _quiver_async_database_closePtr
+      .asFunction<int Function(ffi.Pointer<quiver_async_database_t>)>();
+
+  int quiver_async_database_create_element(
+    ffi.Pointer<quiver_async_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<quiver_element_t1> element,
+    quiver_async_id_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
+  ) {
+    return _quiver_async_database_create_element(
+      db,
+      collection,
+      element,
+      callback,
+      user_data,
     );
   }
 
-  late final _quiver_element_scalar_countPtr =
-      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Size>)>>(
-        'quiver_element_scalar_count',
-      );
-  late final _quiver_element_scalar_count = _quiver_element_scalar_countPtr
-      .asFunction<int Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Size>)>();
+  late final _quiver_async_database_create_elementPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_async_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_element_t1>,
+            quiver_async_id_callback_t,
+            ffi.Pointer<ffi.Void>,
+          )
+        >
+      >('quiver_async_database_create_element');
+  late final _quiver_async_database_create_element = _quiver_async_database_create_elementPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_async_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_element_t1>,
+          quiver_async_id_callback_t,
+          ffi.Pointer<ffi.Void>,
+        )
+      >();
 
-  int quiver_element_array_count(
+  int quiver_async_database_update_element(
+    ffi.Pointer<quiver_async_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    int id,
     ffi.Pointer<quiver_element_t1> element,
-    ffi.Pointer<ffi.Size> out_count,
+    quiver_async_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
   ) {
-    return _quiver_element_array_count(
+    return _quiver_async_database_update_element(
+      db,
+      collection,
+      id,
       element,
-      out_count,
+      callback,
+      user_data,
     );
   }
 
-  late final _quiver_element_array_countPtr =
-      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Size>)>>(
-        'quiver_element_array_count',
-      );
-  late final _quiver_element_array_count = _quiver_element_array_countPtr
-      .asFunction<int Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Size>)>();
+  late final _quiver_async_database_update_elementPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_async_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            ffi.Pointer<quiver_element_t1>,
+            quiver_async_callback_t,
+            ffi.Pointer<ffi.Void>,
+          )
+        >
+      >('quiver_async_database_update_element');
+  late final _quiver_async_database_update_element = _quiver_async_database_update_elementPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_async_database_t>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          ffi.Pointer<quiver_element_t1>,
+          quiver_async_callback_t,
+          ffi.Pointer<ffi.Void>,
+        )
+      >();
 
-  int quiver_element_to_string(
-    ffi.Pointer<quiver_element_t1> element,
-    ffi.Pointer<ffi.Pointer<ffi.Char>> out_string,
+  int quiver_async_database_delete_element(
+    ffi.Pointer<quiver_async_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    int id,
+    quiver_async_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
   ) {
-    return _quiver_element_to_string(
-      element,
-      out_string,
+    return _quiver_async_database_delete_element(
+      db,
+      collection,
+      id,
+      callback,
+      user_data,
     );
   }
 
-  late final _quiver_element_to_stringPtr =
+  late final _quiver_async_database_delete_elementPtr =
       _lookup<
-        ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Pointer<ffi.Char>>)>
-      >('quiver_element_to_string');
-  late final _quiver_element_to_string = _quiver_element_to_stringPtr
-      .asFunction<int Function(ffi.Pointer<quiver_element_t1>, ffi.Pointer<ffi.Pointer<ffi.Char>>)>();
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_async_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Int64,
+            quiver_async_callback_t,
+            ffi.Pointer<ffi.Void>,
+          )
+        >
+      >('quiver_async_database_delete_element');
+  late final _quiver_async_database_delete_element = _quiver_async_database_delete_elementPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_async_database_t>,
+          ffi.Pointer<ffi.Char>,
+          int,
+          quiver_async_callback_t,
+          ffi.Pointer<ffi.Void>,
+        )
+      >();
 
-  int quiver_lua_runner_new(
-    ffi.Pointer<quiver_database_t> db,
-    ffi.Pointer<ffi.Pointer<quiver_lua_runner_t>> out_runner,
+  int quiver_async_database_import_csv(
+    ffi.Pointer<quiver_async_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> group,
+    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<quiver_csv_options_t> options,
+    quiver_async_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
   ) {
-    return _quiver_lua_runner_new(
+    return _quiver_async_database_import_csv(
       db,
-      out_runner,
+      collection,
+      group,
+      path,
+      options,
+      callback,
+      user_data,
     );
   }
 
-  late final _quiver_lua_runner_newPtr =
+  late final _quiver_async_database_import_csvPtr =
       _lookup<
         ffi.NativeFunction<
-          ffi.Int32 Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Pointer<quiver_lua_runner_t>>)
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_async_database_t>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_csv_options_t>,
+            quiver_async_callback_t,
+            ffi.Pointer<ffi.Void>,
+          )
         >
-      >('quiver_lua_runner_new');
-  late final _quiver_lua_runner_new = _quiver_lua_runner_newPtr
-      .asFunction<int Function(ffi.Pointer<quiver_database_t>, ffi.Pointer<ffi.Pointer<quiver_lua_runner_t>>)>();
+      >('quiver_async_database_import_csv');
+  late final _quiver_async_database_import_csv = _quiver_async_database_import_csvPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_async_database_t>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_csv_options_t>,
+          quiver_async_callback_t,
+          ffi.Pointer<ffi.Void>,
+        )
+      >();
 
-  int quiver_lua_runner_free(
-    ffi.Pointer<quiver_lua_runner_t> runner,
+  int quiver_async_database_read_element_ids(
+    ffi.Pointer<quiver_async_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    quiver_async_ids_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
   ) {
-    return _quiver_lua_runner_free(
-      runner,
+    return _quiver_async_database_read_element_ids(
+      db,
+      collection,
+      callback,
+      user_data,
     );
   }
 
-  late final _quiver_lua_runner_freePtr =
-      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<quiver_lua_runner_t>)>>('quiver_lua_runner_free');
-  late final _quiver_lua_runner_free = _quiver_lua_runner_freePtr
-      .asFunction<int Function(ffi.Pointer<quiver_lua_runner_t>)>();
+  late final _quiver_async_database_read_element_idsPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(
+            ffi.Pointer<quiver_async_database_t>,
+            ffi.Pointer<ffi.Char>,
+            quiver_async_ids_callback_t,
+            ffi.Pointer<ffi.Void>,
+          )
+        >
+      >('quiver_async_database_read_element_ids');
+  late final _quiver_async_database_read_element_ids = _quiver_async_database_read_element_idsPtr
+      .asFunction<
+        int Function(
+          ffi.Pointer<quiver_async_database_t>,
+          ffi.Pointer<ffi.Char>,
+          quiver_async_ids_callback_t,
+          ffi.Pointer<ffi.Void>,
+        )
+      >();
 
-  int quiver_lua_runner_run(
-    ffi.Pointer<quiver_lua_runner_t> runner,
-    ffi.Pointer<ffi.Char> script,
-    ffi.Pointer<ffi.Pointer<ffi.Char>> out_result,
+  int quiver_async_database_export_csv(
+    ffi.Pointer<quiver_async_database_t> db,
+    ffi.Pointer<ffi.Char> collection,
+    ffi.Pointer<ffi.Char> group,
+    ffi.Pointer<ffi.Char> path,
+    ffi.Pointer<quiver_csv_options_t> options,
+    quiver_async_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
   ) {
-    return _quiver_lua_runner_run(
-      runner,
-      script,
-      out_result,
+    return _quiver_async_database_export_csv(
+      db,
+      collection,
+      group,
+      path,
+      options,
+      callback,
+      user_data,
     );
   }
 
-  late final _quiver_lua_runner_runPtr =
+  late final _quiver_async_database_export_csvPtr =
       _lookup<
         ffi.NativeFunction<
           ffi.Int32 Function(
-            ffi.Pointer<quiver_lua_runner_t>,
+            ffi.Pointer<quiver_async_database_t>,
             ffi.Pointer<ffi.Char>,
-            ffi.Pointer<ffi.Pointer<ffi.Char>>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<ffi.Char>,
+            ffi.Pointer<quiver_csv_options_t>,
+            quiver_async_callback_t,
+            ffi.Pointer<ffi.Void>,
           )
         >
-      >('quiver_lua_runner_run');
-  late final _quiver_lua_runner_run = _quiver_lua_runner_runPtr
+      >('quiver_async_database_export_csv');
+  late final _quiver_async_database_export_csv = _quiver_async_database_export_csvPtr
       .asFunction<
         int Function(
-          ffi.Pointer<quiver_lua_runner_t>,
+          ffi.Pointer<quiver_async_database_t>,
           ffi.Pointer<ffi.Char>,
-          ffi.Pointer<ffi.Pointer<ffi.Char>>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<ffi.Char>,
+          ffi.Pointer<quiver_csv_options_t>,
+          quiver_async_callback_t,
+          ffi.Pointer<ffi.Void>,
         )
       >();
 
-  int quiver_lua_runner_free_string(
-    ffi.Pointer<ffi.Char> str,
+  int quiver_async_database_flush(
+    ffi.Pointer<quiver_async_database_t> db,
+    quiver_async_callback_t callback,
+    ffi.Pointer<ffi.Void> user_data,
   ) {
-    return _quiver_lua_runner_free_string(
-      str,
+    return _quiver_async_database_flush(
+      db,
+      callback,
+      user_data,
     );
   }
 
-  late final _quiver_lua_runner_free_stringPtr = _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Pointer<ffi.Char>)>>(
-    'quiver_lua_runner_free_string',
-  );
-  late final _quiver_lua_runner_free_string = _quiver_lua_runner_free_stringPtr
-      .asFunction<int Function(ffi.Pointer<ffi.Char>)>();
+  late final _quiver_async_database_flushPtr =
+      _lookup<
+        ffi.NativeFunction<
+          ffi.Int32 Function(ffi.Pointer<quiver_async_database_t>, quiver_async_callback_t, ffi.Pointer<ffi.Void>)
+        >
+      >('quiver_async_database_flush');
+  late final _quiver_async_database_flush = _quiver_async_database_flushPtr
+      .asFunction<int Function(ffi.Pointer<quiver_async_database_t>, quiver_async_callback_t, ffi.Pointer<ffi.Void>)>();
 }
 
 abstract class quiver_error_t {
@@ -3167,12 +4678,78 @@ abstract class quiver_log_level_t {
   static const int QUIVER_LOG_OFF = 4;
 }
 
+abstract class quiver_file_log_mode_t {
+  static const int QUIVER_FILE_LOG_SYNC = 0;
+  static const int QUIVER_FILE_LOG_ASYNC = 1;
+  static const int QUIVER_FILE_LOG_OFF = 2;
+}
+
+abstract class quiver_journal_mode_t {
+  static const int QUIVER_JOURNAL_MODE_DEFAULT = 0;
+  static const int QUIVER_JOURNAL_MODE_DELETE = 1;
+  static const int QUIVER_JOURNAL_MODE_WAL = 2;
+  static const int QUIVER_JOURNAL_MODE_MEMORY = 3;
+  static const int QUIVER_JOURNAL_MODE_OFF = 4;
+}
+
+abstract class quiver_synchronous_t {
+  static const int QUIVER_SYNCHRONOUS_DEFAULT = 0;
+  static const int QUIVER_SYNCHRONOUS_OFF = 1;
+  static const int QUIVER_SYNCHRONOUS_NORMAL = 2;
+  static const int QUIVER_SYNCHRONOUS_FULL = 3;
+  static const int QUIVER_SYNCHRONOUS_EXTRA = 4;
+}
+
+abstract class quiver_temp_store_t {
+  static const int QUIVER_TEMP_STORE_DEFAULT = 0;
+  static const int QUIVER_TEMP_STORE_FILE = 1;
+  static const int QUIVER_TEMP_STORE_MEMORY = 2;
+}
+
+final class quiver_connection_profile_t extends ffi.Struct {
+  @ffi.Int32()
+  external int journal_mode;
+
+  @ffi.Int32()
+  external int synchronous;
+
+  @ffi.Int32()
+  external int temp_store;
+
+  @ffi.Int64()
+  external int cache_size_kib;
+
+  @ffi.Int64()
+  external int mmap_size;
+}
+
+final class quiver_sql_trace_options_t extends ffi.Struct {
+  @ffi.Int()
+  external int enabled;
+
+  @ffi.Int64()
+  external int slow_threshold_ns;
+
+  @ffi.Int64()
+  external int ring_capacity;
+}
+
 final class quiver_database_options_t extends ffi.Struct {
   @ffi.Int()
   external int read_only;
 
   @ffi.Int32()
   external int console_level;
+
+  external quiver_connection_profile_t profile;
+
+  external quiver_sql_trace_options_t trace;
+
+  @ffi.Int32()
+  external int file_log;
+
+  @ffi.Int()
+  external int immutable;
 }
 
 final class quiver_csv_options_t extends ffi.Struct {
@@ -3200,10 +4777,99 @@ abstract class quiver_data_type_t {
   static const int QUIVER_DATA_TYPE_NULL = 4;
 }
 
+abstract class quiver_time_series_write_mode_t {
+  static const int QUIVER_TIME_SERIES_WRITE_APPEND = 0;
+  static const int QUIVER_TIME_SERIES_WRITE_REPLACE_RANGE = 1;
+  static const int QUIVER_TIME_SERIES_WRITE_UPSERT = 2;
+}
+
 final class quiver_database extends ffi.Opaque {}
 
 typedef quiver_database_t = quiver_database;
 
+abstract class quiver_change_kind_t {
+  static const int QUIVER_CHANGE_CREATED = 0;
+  static const int QUIVER_CHANGE_UPDATED = 1;
+  static const int QUIVER_CHANGE_DELETED = 2;
+}
+
+typedef quiver_change_callback_t = ffi.Pointer<ffi.NativeFunction<quiver_change_callback_tFunction>>;
+typedef quiver_change_callback_tFunction =
+    ffi.Void Function(
+      ffi.Pointer<ffi.Void> user_data,
+      ffi.Int64 sequence,
+      ffi.Pointer<ffi.Char> table,
+      ffi.Pointer<ffi.Char> collection,
+      ffi.Int32 kind,
+      ffi.Pointer<ffi.Int64> ids,
+      ffi.Size id_count,
+    );
+typedef Dartquiver_change_callback_tFunction =
+    void Function(
+      ffi.Pointer<ffi.Void> user_data,
+      int sequence,
+      ffi.Pointer<ffi.Char> table,
+      ffi.Pointer<ffi.Char> collection,
+      int kind,
+      ffi.Pointer<ffi.Int64> ids,
+      int id_count,
+    );
+
+final class quiver_operation_stats_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> operation;
+
+  @ffi.Int64()
+  external int calls;
+
+  @ffi.Int64()
+  external int total_ns;
+
+  @ffi.Int64()
+  external int p50_ns;
+
+  @ffi.Int64()
+  external int p99_ns;
+
+  @ffi.Int64()
+  external int rows_read;
+
+  @ffi.Int64()
+  external int rows_written;
+
+  @ffi.Int64()
+  external int statements_prepared;
+
+  @ffi.Int64()
+  external int statements_reused;
+
+  @ffi.Int64()
+  external int bytes_bound;
+}
+
+final class quiver_traced_statement_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> sql;
+
+  external ffi.Pointer<ffi.Char> operation;
+
+  @ffi.Int64()
+  external int elapsed_ns;
+
+  @ffi.Int64()
+  external int rows;
+}
+
+final class quiver_delete_result_t extends ffi.Struct {
+  @ffi.Int64()
+  external int elements;
+
+  external ffi.Pointer<ffi.Pointer<ffi.Char>> group_tables;
+
+  external ffi.Pointer<ffi.Int64> group_rows;
+
+  @ffi.Size()
+  external int group_count;
+}
+
 final class quiver_element extends ffi.Opaque {}
 
 typedef quiver_element_t = quiver_element;
@@ -3241,8 +4907,82 @@ final class quiver_group_metadata_t extends ffi.Struct {
   external int value_column_count;
 }
 
+final class quiver_database_cursor extends ffi.Opaque {}
+
+typedef quiver_database_cursor_t = quiver_database_cursor;
+
+final class quiver_missing_index_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> table;
+
+  external ffi.Pointer<ffi.Char> columns;
+
+  external ffi.Pointer<ffi.Char> reason;
+
+  external ffi.Pointer<ffi.Char> create_sql;
+}
+
 typedef quiver_element_t1 = quiver_element;
 
 final class quiver_lua_runner extends ffi.Opaque {}
 
 typedef quiver_lua_runner_t = quiver_lua_runner;
+
+final class quiver_async_database extends ffi.Opaque {}
+
+typedef quiver_async_database_t = quiver_async_database;
+
+final class quiver_async_database_options_t extends ffi.Struct {
+  @ffi.Size()
+  external int max_batch_writes;
+
+  @ffi.Int64()
+  external int max_batch_delay_us;
+}
+
+typedef quiver_async_callback_t = ffi.Pointer<ffi.NativeFunction<quiver_async_callback_tFunction>>;
+typedef quiver_async_callback_tFunction =
+    ffi.Void Function(
+      ffi.Pointer<ffi.Void> user_data,
+      ffi.Int32 status,
+      ffi.Pointer<ffi.Char> error,
+    );
+typedef Dartquiver_async_callback_tFunction =
+    void Function(
+      ffi.Pointer<ffi.Void> user_data,
+      int status,
+      ffi.Pointer<ffi.Char> error,
+    );
+
+typedef quiver_async_id_callback_t = ffi.Pointer<ffi.NativeFunction<quiver_async_id_callback_tFunction>>;
+typedef quiver_async_id_callback_tFunction =
+    ffi.Void Function(
+      ffi.Pointer<ffi.Void> user_data,
+      ffi.Int32 status,
+      ffi.Int64 id,
+      ffi.Pointer<ffi.Char> error,
+    );
+typedef Dartquiver_async_id_callback_tFunction =
+    void Function(
+      ffi.Pointer<ffi.Void> user_data,
+      int status,
+      int id,
+      ffi.Pointer<ffi.Char> error,
+    );
+
+typedef quiver_async_ids_callback_t = ffi.Pointer<ffi.NativeFunction<quiver_async_ids_callback_tFunction>>;
+typedef quiver_async_ids_callback_tFunction =
+    ffi.Void Function(
+      ffi.Pointer<ffi.Void> user_data,
+      ffi.Int32 status,
+      ffi.Pointer<ffi.Int64> ids,
+      ffi.Size count,
+      ffi.Pointer<ffi.Char> error,
+    );
+typedef Dartquiver_async_ids_callback_tFunction =
+    void Function(
+      ffi.Pointer<ffi.Void> user_data,
+      int status,
+      ffi.Pointer<ffi.Int64> ids,
+      int count,
+      ffi.Pointer<ffi.Char> error,
+    );
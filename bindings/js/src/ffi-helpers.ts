@@ -4,14 +4,21 @@ import { type Allocation, type DatabaseOptions, LOG_LEVEL_INFO } from "./types.t
 const encoder = new TextEncoder();
 
 /**
- * Construct the 8-byte quiver_database_options_t struct as an Allocation.
- * Layout: offset 0 = int32 read_only (default 0), offset 4 = int32 console_level (default 1 = QUIVER_LOG_INFO).
+ * Construct the 72-byte quiver_database_options_t struct as an Allocation.
+ * Layout: offset 0 = int32 read_only (default 0), offset 4 = int32 console_level (default 1 = QUIVER_LOG_INFO),
+ * offset 8 = quiver_connection_profile_t (int32 journal_mode, synchronous, temp_store, 4 bytes padding,
+ * int64 cache_size_kib at 24, int64 mmap_size at 32); all zero = SQLite defaults.
+ * offset 40 = quiver_sql_trace_options_t (int32 enabled, 4 bytes padding, int64 slow_threshold_ns at 48,
+ * int64 ring_capacity at 56, default 256); tracing off.
+ * offset 64 = int32 file_log (0 = QUIVER_FILE_LOG_SYNC), offset 68 = int32 immutable (default 0).
  */
 export function makeDefaultOptions(options?: DatabaseOptions): Allocation {
-  const buf = new Uint8Array(8);
+  const buf = new Uint8Array(72);
   const dv = new DataView(buf.buffer);
   dv.setInt32(0, options?.readOnly ? 1 : 0, true);
   dv.setInt32(4, options?.consoleLevel ?? LOG_LEVEL_INFO, true);
+  dv.setBigInt64(56, 256n, true);
+  dv.setInt32(68, options?.immutable ? 1 : 0, true);
   return { ptr: ptr(buf), buf };
 }
 
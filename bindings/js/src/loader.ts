@@ -36,6 +36,8 @@ const lifecycleSymbols = {
   quiver_database_from_schema: { args: [BUF, BUF, BUF, P], returns: I32 },
   quiver_database_from_migrations: { args: [BUF, BUF, BUF, P], returns: I32 },
   quiver_database_open: { args: [BUF, BUF, P], returns: I32 },
+  quiver_database_open_in_memory_copy: { args: [BUF, BUF, P], returns: I32 },
+  quiver_database_save_to: { args: [P, BUF], returns: I32 },
   quiver_database_close: { args: [P], returns: I32 },
   quiver_database_is_healthy: { args: [P, P], returns: I32 },
   quiver_database_path: { args: [P, P], returns: I32 },
@@ -57,8 +59,12 @@ const elementSymbols = {
 
 const crudSymbols = {
   quiver_database_create_element: { args: [P, BUF, P, P], returns: I32 },
+  quiver_database_create_elements: { args: [P, BUF, P, USIZE, P], returns: I32 },
   quiver_database_update_element: { args: [P, BUF, I64, P], returns: I32 },
   quiver_database_delete_element: { args: [P, BUF, I64], returns: I32 },
+  quiver_database_delete_elements: { args: [P, BUF, P, USIZE, P], returns: I32 },
+  quiver_database_delete_elements_where: { args: [P, BUF, BUF, P, P, USIZE, P], returns: I32 },
+  quiver_database_free_delete_result: { args: [P], returns: I32 },
 } as const;
 
 const readSymbols = {
@@ -68,6 +74,15 @@ const readSymbols = {
   quiver_database_read_scalar_integer_by_id: { args: [P, BUF, BUF, I64, P, P], returns: I32 },
   quiver_database_read_scalar_float_by_id: { args: [P, BUF, BUF, I64, P, P], returns: I32 },
   quiver_database_read_scalar_string_by_id: { args: [P, BUF, BUF, I64, P, P], returns: I32 },
+  quiver_database_read_scalar_integers_by_ids: {
+    args: [P, BUF, BUF, P, USIZE, P, P, P],
+    returns: I32,
+  },
+  quiver_database_read_scalar_floats_by_ids: {
+    args: [P, BUF, BUF, P, USIZE, P, P, P],
+    returns: I32,
+  },
+  quiver_database_read_scalar_strings_by_ids: { args: [P, BUF, BUF, P, USIZE, P, P], returns: I32 },
   quiver_database_read_vector_integers: { args: [P, BUF, BUF, P, P, P], returns: I32 },
   quiver_database_read_vector_floats: { args: [P, BUF, BUF, P, P, P], returns: I32 },
   quiver_database_read_vector_strings: { args: [P, BUF, BUF, P, P, P], returns: I32 },
@@ -80,6 +95,14 @@ const readSymbols = {
   quiver_database_read_set_integers_by_id: { args: [P, BUF, BUF, I64, P, P], returns: I32 },
   quiver_database_read_set_floats_by_id: { args: [P, BUF, BUF, I64, P, P], returns: I32 },
   quiver_database_read_set_strings_by_id: { args: [P, BUF, BUF, I64, P, P], returns: I32 },
+  quiver_database_read_vector_group_by_id: {
+    args: [P, BUF, BUF, I64, P, P, P, P, P, P],
+    returns: I32,
+  },
+  quiver_database_read_set_group_by_id: {
+    args: [P, BUF, BUF, I64, P, P, P, P, P, P],
+    returns: I32,
+  },
   quiver_database_read_element_ids: { args: [P, BUF, P, P], returns: I32 },
   quiver_database_number_of_elements: { args: [P, BUF, P], returns: I32 },
 } as const;
@@ -91,6 +114,15 @@ const querySymbols = {
   quiver_database_query_string_params: { args: [P, BUF, P, P, USIZE, P, P], returns: I32 },
   quiver_database_query_integer_params: { args: [P, BUF, P, P, USIZE, P, P], returns: I32 },
   quiver_database_query_float_params: { args: [P, BUF, P, P, USIZE, P, P], returns: I32 },
+  quiver_database_query_table: { args: [P, BUF, P, P, USIZE, P, P, P, P, P, P], returns: I32 },
+  quiver_database_cursor_open: { args: [P, BUF, P, P, USIZE, P], returns: I32 },
+  quiver_database_cursor_next: { args: [P, P], returns: I32 },
+  quiver_database_cursor_column_count: { args: [P, P], returns: I32 },
+  quiver_database_cursor_column_name: { args: [P, USIZE, P], returns: I32 },
+  quiver_database_cursor_get_integer: { args: [P, USIZE, P, P], returns: I32 },
+  quiver_database_cursor_get_float: { args: [P, USIZE, P, P], returns: I32 },
+  quiver_database_cursor_get_string: { args: [P, USIZE, P, P], returns: I32 },
+  quiver_database_cursor_close: { args: [P], returns: I32 },
 } as const;
 
 const transactionSymbols = {
@@ -127,10 +159,22 @@ const timeSeriesSymbols = {
     returns: I32,
   },
   quiver_database_read_time_series_row: { args: [P, BUF, BUF, BUF, BUF, P, P, P], returns: I32 },
+  quiver_database_read_time_series_group_all: {
+    args: [P, BUF, BUF, P, P, P, P, P, P, P],
+    returns: I32,
+  },
+  quiver_database_read_time_series_rows: {
+    args: [P, BUF, BUF, BUF, P, USIZE, P, P, P],
+    returns: I32,
+  },
   quiver_database_upsert_time_series_row: {
     args: [P, BUF, BUF, I64, P, P, P, USIZE],
     returns: I32,
   },
+  quiver_database_write_time_series: {
+    args: [P, BUF, BUF, P, P, P, P, P, USIZE, USIZE, I32],
+    returns: I32,
+  },
   quiver_database_update_time_series_group: {
     args: [P, BUF, BUF, I64, P, P, P, P, USIZE, USIZE],
     returns: I32,
@@ -156,6 +200,42 @@ const csvSymbols = {
   quiver_database_import_csv: { args: [P, BUF, BUF, BUF, P], returns: I32 },
 } as const;
 
+// Callback arguments take a JSCallback's .ptr.
+const changeFeedSymbols = {
+  quiver_database_subscribe_changes: { args: [P, P, P, P], returns: I32 },
+  quiver_database_unsubscribe_changes: { args: [P, I64], returns: I32 },
+  quiver_database_poll_changes: { args: [P, I64, P, P, P, P, P, P], returns: I32 },
+  quiver_database_free_changes: { args: [P, P, P, P, P, USIZE], returns: I32 },
+} as const;
+
+const diagnosticsSymbols = {
+  quiver_database_enable_stats: { args: [P, I32], returns: I32 },
+  quiver_database_stats: { args: [P, P, P], returns: I32 },
+  quiver_database_reset_stats: { args: [P], returns: I32 },
+  quiver_database_free_stats: { args: [P, USIZE], returns: I32 },
+  quiver_database_traced_statements: { args: [P, P, P], returns: I32 },
+  quiver_database_clear_traced_statements: { args: [P], returns: I32 },
+  quiver_database_free_traced_statements: { args: [P, USIZE], returns: I32 },
+  quiver_database_missing_indexes: { args: [P, P, P], returns: I32 },
+  quiver_database_ensure_indexes: { args: [P, P, P], returns: I32 },
+  quiver_database_free_missing_indexes: { args: [P, USIZE], returns: I32 },
+} as const;
+
+const asyncSymbols = {
+  // quiver_async_database_options_default is omitted for the same reason as
+  // quiver_database_options_default: it returns a struct by value. Completion
+  // callbacks run on the worker thread, so their JSCallbacks need threadsafe: true.
+  quiver_async_database_open: { args: [BUF, BUF, BUF, P], returns: I32 },
+  quiver_async_database_close: { args: [P], returns: I32 },
+  quiver_async_database_create_element: { args: [P, BUF, P, P, P], returns: I32 },
+  quiver_async_database_update_element: { args: [P, BUF, I64, P, P, P], returns: I32 },
+  quiver_async_database_delete_element: { args: [P, BUF, I64, P, P], returns: I32 },
+  quiver_async_database_import_csv: { args: [P, BUF, BUF, BUF, P, P, P], returns: I32 },
+  quiver_async_database_read_element_ids: { args: [P, BUF, P, P], returns: I32 },
+  quiver_async_database_export_csv: { args: [P, BUF, BUF, BUF, P, P, P], returns: I32 },
+  quiver_async_database_flush: { args: [P, P, P], returns: I32 },
+} as const;
+
 const freeSymbols = {
   quiver_database_free_integer_array: { args: [P], returns: I32 },
   quiver_database_free_float_array: { args: [P], returns: I32 },
@@ -188,6 +268,9 @@ const allSymbols = {
   ...describeSymbols,
   ...timeSeriesSymbols,
   ...csvSymbols,
+  ...changeFeedSymbols,
+  ...diagnosticsSymbols,
+  ...asyncSymbols,
   ...freeSymbols,
   ...luaSymbols,
 } as const;
@@ -19,6 +19,8 @@ export type DatabaseOptions = {
   readOnly?: boolean;
   /** A LOG_LEVEL_* constant; defaults to LOG_LEVEL_INFO. */
   consoleLevel?: number;
+  /** Open an archived database that is never written again; implies readOnly. */
+  immutable?: boolean;
 };
 
 export type ScalarValue = number | bigint | string | null;
@@ -89,9 +89,55 @@ end
     QUIVER_LOG_OFF = 4
 end
 
+@cenum quiver_file_log_mode_t::UInt32 begin
+    QUIVER_FILE_LOG_SYNC = 0
+    QUIVER_FILE_LOG_ASYNC = 1
+    QUIVER_FILE_LOG_OFF = 2
+end
+
+@cenum quiver_journal_mode_t::UInt32 begin
+    QUIVER_JOURNAL_MODE_DEFAULT = 0
+    QUIVER_JOURNAL_MODE_DELETE = 1
+    QUIVER_JOURNAL_MODE_WAL = 2
+    QUIVER_JOURNAL_MODE_MEMORY = 3
+    QUIVER_JOURNAL_MODE_OFF = 4
+end
+
+@cenum quiver_synchronous_t::UInt32 begin
+    QUIVER_SYNCHRONOUS_DEFAULT = 0
+    QUIVER_SYNCHRONOUS_OFF = 1
+    QUIVER_SYNCHRONOUS_NORMAL = 2
+    QUIVER_SYNCHRONOUS_FULL = 3
+    QUIVER_SYNCHRONOUS_EXTRA = 4
+end
+
+@cenum quiver_temp_store_t::UInt32 begin
+    QUIVER_TEMP_STORE_DEFAULT = 0
+    QUIVER_TEMP_STORE_FILE = 1
+    QUIVER_TEMP_STORE_MEMORY = 2
+end
+
+struct quiver_connection_profile_t
+    journal_mode::quiver_journal_mode_t
+    synchronous::quiver_synchronous_t
+    temp_store::quiver_temp_store_t
+    cache_size_kib::Int64
+    mmap_size::Int64
+end
+
+struct quiver_sql_trace_options_t
+    enabled::Cint
+    slow_threshold_ns::Int64
+    ring_capacity::Int64
+end
+
 mutable struct quiver_database_options_t
     read_only::Cint
     console_level::quiver_log_level_t
+    profile::quiver_connection_profile_t
+    trace::quiver_sql_trace_options_t
+    file_log::quiver_file_log_mode_t
+    immutable::Cint
 end
 
 mutable struct quiver_csv_options_t
@@ -108,6 +154,18 @@ function quiver_database_options_default()
     @ccall libquiver_c.quiver_database_options_default()::quiver_database_options_t
 end
 
+function quiver_connection_profile_bulk_load()
+    @ccall libquiver_c.quiver_connection_profile_bulk_load()::quiver_connection_profile_t
+end
+
+function quiver_connection_profile_read_mostly()
+    @ccall libquiver_c.quiver_connection_profile_read_mostly()::quiver_connection_profile_t
+end
+
+function quiver_connection_profile_durable()
+    @ccall libquiver_c.quiver_connection_profile_durable()::quiver_connection_profile_t
+end
+
 function quiver_csv_options_default()
     @ccall libquiver_c.quiver_csv_options_default()::quiver_csv_options_t
 end
@@ -120,6 +178,12 @@ end
     QUIVER_DATA_TYPE_NULL = 4
 end
 
+@cenum quiver_time_series_write_mode_t::UInt32 begin
+    QUIVER_TIME_SERIES_WRITE_APPEND = 0
+    QUIVER_TIME_SERIES_WRITE_REPLACE_RANGE = 1
+    QUIVER_TIME_SERIES_WRITE_UPSERT = 2
+end
+
 mutable struct quiver_database end
 
 const quiver_database_t = quiver_database
@@ -136,6 +200,14 @@ function quiver_database_from_schema(db_path, schema_path, options, out_db)
     @ccall libquiver_c.quiver_database_from_schema(db_path::Ptr{Cchar}, schema_path::Ptr{Cchar}, options::Ptr{quiver_database_options_t}, out_db::Ptr{Ptr{quiver_database_t}})::quiver_error_t
 end
 
+function quiver_database_open_in_memory_copy(path, options, out_db)
+    @ccall libquiver_c.quiver_database_open_in_memory_copy(path::Ptr{Cchar}, options::Ptr{quiver_database_options_t}, out_db::Ptr{Ptr{quiver_database_t}})::quiver_error_t
+end
+
+function quiver_database_save_to(db, path)
+    @ccall libquiver_c.quiver_database_save_to(db::Ptr{quiver_database_t}, path::Ptr{Cchar})::quiver_error_t
+end
+
 function quiver_database_close(db)
     @ccall libquiver_c.quiver_database_close(db::Ptr{quiver_database_t})::quiver_error_t
 end
@@ -176,6 +248,79 @@ function quiver_database_in_dry_run(db, out_active)
     @ccall libquiver_c.quiver_database_in_dry_run(db::Ptr{quiver_database_t}, out_active::Ptr{Cint})::quiver_error_t
 end
 
+@cenum quiver_change_kind_t::UInt32 begin
+    QUIVER_CHANGE_CREATED = 0
+    QUIVER_CHANGE_UPDATED = 1
+    QUIVER_CHANGE_DELETED = 2
+end
+
+# typedef void ( * quiver_change_callback_t ) ( void * user_data , int64_t sequence , const char * table , const char * collection , quiver_change_kind_t kind , const int64_t * ids , size_t id_count )
+const quiver_change_callback_t = Ptr{Cvoid}
+
+function quiver_database_subscribe_changes(db, callback, user_data, out_subscription)
+    @ccall libquiver_c.quiver_database_subscribe_changes(db::Ptr{quiver_database_t}, callback::quiver_change_callback_t, user_data::Ptr{Cvoid}, out_subscription::Ptr{Int64})::quiver_error_t
+end
+
+function quiver_database_unsubscribe_changes(db, subscription)
+    @ccall libquiver_c.quiver_database_unsubscribe_changes(db::Ptr{quiver_database_t}, subscription::Int64)::quiver_error_t
+end
+
+function quiver_database_poll_changes(db, subscription, out_sequences, out_tables, out_collections, out_kinds, out_ids, out_count)
+    @ccall libquiver_c.quiver_database_poll_changes(db::Ptr{quiver_database_t}, subscription::Int64, out_sequences::Ptr{Ptr{Int64}}, out_tables::Ptr{Ptr{Ptr{Cchar}}}, out_collections::Ptr{Ptr{Ptr{Cchar}}}, out_kinds::Ptr{Ptr{Cint}}, out_ids::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_free_changes(sequences, tables, collections, kinds, ids, count)
+    @ccall libquiver_c.quiver_database_free_changes(sequences::Ptr{Int64}, tables::Ptr{Ptr{Cchar}}, collections::Ptr{Ptr{Cchar}}, kinds::Ptr{Cint}, ids::Ptr{Int64}, count::Csize_t)::quiver_error_t
+end
+
+struct quiver_operation_stats_t
+    operation::Ptr{Cchar}
+    calls::Int64
+    total_ns::Int64
+    p50_ns::Int64
+    p99_ns::Int64
+    rows_read::Int64
+    rows_written::Int64
+    statements_prepared::Int64
+    statements_reused::Int64
+    bytes_bound::Int64
+end
+
+function quiver_database_enable_stats(db, enabled)
+    @ccall libquiver_c.quiver_database_enable_stats(db::Ptr{quiver_database_t}, enabled::Cint)::quiver_error_t
+end
+
+function quiver_database_stats(db, out_stats, out_count)
+    @ccall libquiver_c.quiver_database_stats(db::Ptr{quiver_database_t}, out_stats::Ptr{Ptr{quiver_operation_stats_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_reset_stats(db)
+    @ccall libquiver_c.quiver_database_reset_stats(db::Ptr{quiver_database_t})::quiver_error_t
+end
+
+function quiver_database_free_stats(stats, count)
+    @ccall libquiver_c.quiver_database_free_stats(stats::Ptr{quiver_operation_stats_t}, count::Csize_t)::quiver_error_t
+end
+
+struct quiver_traced_statement_t
+    sql::Ptr{Cchar}
+    operation::Ptr{Cchar}
+    elapsed_ns::Int64
+    rows::Int64
+end
+
+function quiver_database_traced_statements(db, out_statements, out_count)
+    @ccall libquiver_c.quiver_database_traced_statements(db::Ptr{quiver_database_t}, out_statements::Ptr{Ptr{quiver_traced_statement_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_clear_traced_statements(db)
+    @ccall libquiver_c.quiver_database_clear_traced_statements(db::Ptr{quiver_database_t})::quiver_error_t
+end
+
+function quiver_database_free_traced_statements(statements, count)
+    @ccall libquiver_c.quiver_database_free_traced_statements(statements::Ptr{quiver_traced_statement_t}, count::Csize_t)::quiver_error_t
+end
+
 function quiver_database_current_version(db, out_version)
     @ccall libquiver_c.quiver_database_current_version(db::Ptr{quiver_database_t}, out_version::Ptr{Int64})::quiver_error_t
 end
@@ -188,6 +333,10 @@ function quiver_database_create_element(db, collection, element, out_id)
     @ccall libquiver_c.quiver_database_create_element(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, element::Ptr{quiver_element_t}, out_id::Ptr{Int64})::quiver_error_t
 end
 
+function quiver_database_create_elements(db, collection, elements, element_count, out_ids)
+    @ccall libquiver_c.quiver_database_create_elements(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, elements::Ptr{Ptr{quiver_element_t}}, element_count::Csize_t, out_ids::Ptr{Int64})::quiver_error_t
+end
+
 function quiver_database_update_element(db, collection, id, element)
     @ccall libquiver_c.quiver_database_update_element(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, id::Int64, element::Ptr{quiver_element_t})::quiver_error_t
 end
@@ -196,6 +345,25 @@ function quiver_database_delete_element(db, collection, id)
     @ccall libquiver_c.quiver_database_delete_element(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, id::Int64)::quiver_error_t
 end
 
+struct quiver_delete_result_t
+    elements::Int64
+    group_tables::Ptr{Ptr{Cchar}}
+    group_rows::Ptr{Int64}
+    group_count::Csize_t
+end
+
+function quiver_database_delete_elements(db, collection, ids, id_count, out_result)
+    @ccall libquiver_c.quiver_database_delete_elements(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_result::Ptr{quiver_delete_result_t})::quiver_error_t
+end
+
+function quiver_database_delete_elements_where(db, collection, predicate, param_types, param_values, param_count, out_result)
+    @ccall libquiver_c.quiver_database_delete_elements_where(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, predicate::Ptr{Cchar}, param_types::Ptr{Cint}, param_values::Ptr{Ptr{Cvoid}}, param_count::Csize_t, out_result::Ptr{quiver_delete_result_t})::quiver_error_t
+end
+
+function quiver_database_free_delete_result(result)
+    @ccall libquiver_c.quiver_database_free_delete_result(result::Ptr{quiver_delete_result_t})::quiver_error_t
+end
+
 function quiver_database_number_of_elements(db, collection, out_count)
     @ccall libquiver_c.quiver_database_number_of_elements(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, out_count::Ptr{Int64})::quiver_error_t
 end
@@ -248,6 +416,18 @@ function quiver_database_read_scalar_string_by_id(db, collection, attribute, id,
     @ccall libquiver_c.quiver_database_read_scalar_string_by_id(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, out_value::Ptr{Ptr{Cchar}}, out_has_value::Ptr{Cint})::quiver_error_t
 end
 
+function quiver_database_read_scalar_integers_by_ids(db, collection, attribute, ids, id_count, out_values, out_mask, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_integers_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Int64}}, out_mask::Ptr{Ptr{UInt8}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_floats_by_ids(db, collection, attribute, ids, id_count, out_values, out_mask, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_floats_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Cdouble}}, out_mask::Ptr{Ptr{UInt8}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_read_scalar_strings_by_ids(db, collection, attribute, ids, id_count, out_values, out_count)
+    @ccall libquiver_c.quiver_database_read_scalar_strings_by_ids(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, ids::Ptr{Int64}, id_count::Csize_t, out_values::Ptr{Ptr{Ptr{Cchar}}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_read_vector_integers_by_id(db, collection, attribute, id, out_values, out_count)
     @ccall libquiver_c.quiver_database_read_vector_integers_by_id(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, attribute::Ptr{Cchar}, id::Int64, out_values::Ptr{Ptr{Int64}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
@@ -362,6 +542,10 @@ function quiver_database_read_time_series_group(db, collection, group, id, out_c
     @ccall libquiver_c.quiver_database_read_time_series_group(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, id::Int64, out_column_names::Ptr{Ptr{Ptr{Cchar}}}, out_column_types::Ptr{Ptr{Cint}}, out_column_data::Ptr{Ptr{Ptr{Cvoid}}}, out_column_has_value::Ptr{Ptr{Ptr{UInt8}}}, out_column_count::Ptr{Csize_t}, out_row_count::Ptr{Csize_t})::quiver_error_t
 end
 
+function quiver_database_read_time_series_group_all(db, collection, group, out_ids, out_column_names, out_column_types, out_column_data, out_column_has_value, out_column_count, out_row_count)
+    @ccall libquiver_c.quiver_database_read_time_series_group_all(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, out_ids::Ptr{Ptr{Int64}}, out_column_names::Ptr{Ptr{Ptr{Cchar}}}, out_column_types::Ptr{Ptr{Cint}}, out_column_data::Ptr{Ptr{Ptr{Cvoid}}}, out_column_has_value::Ptr{Ptr{Ptr{UInt8}}}, out_column_count::Ptr{Csize_t}, out_row_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_update_time_series_group(db, collection, group, id, column_names, column_types, column_data, column_has_value, column_count, row_count)
     @ccall libquiver_c.quiver_database_update_time_series_group(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, id::Int64, column_names::Ptr{Ptr{Cchar}}, column_types::Ptr{Cint}, column_data::Ptr{Ptr{Cvoid}}, column_has_value::Ptr{Ptr{UInt8}}, column_count::Csize_t, row_count::Csize_t)::quiver_error_t
 end
@@ -370,10 +554,18 @@ function quiver_database_upsert_time_series_row(db, collection, group, id, colum
     @ccall libquiver_c.quiver_database_upsert_time_series_row(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, id::Int64, column_names::Ptr{Ptr{Cchar}}, column_types::Ptr{Cint}, column_data::Ptr{Ptr{Cvoid}}, column_count::Csize_t)::quiver_error_t
 end
 
+function quiver_database_write_time_series(db, collection, group, ids, column_names, column_types, column_data, column_has_value, column_count, row_count, mode)
+    @ccall libquiver_c.quiver_database_write_time_series(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, ids::Ptr{Int64}, column_names::Ptr{Ptr{Cchar}}, column_types::Ptr{Cint}, column_data::Ptr{Ptr{Cvoid}}, column_has_value::Ptr{Ptr{UInt8}}, column_count::Csize_t, row_count::Csize_t, mode::Cint)::quiver_error_t
+end
+
 function quiver_database_read_time_series_row(db, collection, group, attribute, date_time, out_data_type, out_values, out_count)
     @ccall libquiver_c.quiver_database_read_time_series_row(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, attribute::Ptr{Cchar}, date_time::Ptr{Cchar}, out_data_type::Ptr{Cint}, out_values::Ptr{Ptr{Cvoid}}, out_count::Ptr{Csize_t})::quiver_error_t
 end
 
+function quiver_database_read_time_series_rows(db, collection, group, attribute, date_times, date_time_count, out_data_type, out_values, out_element_count)
+    @ccall libquiver_c.quiver_database_read_time_series_rows(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, attribute::Ptr{Cchar}, date_times::Ptr{Ptr{Cchar}}, date_time_count::Csize_t, out_data_type::Ptr{Cint}, out_values::Ptr{Ptr{Cvoid}}, out_element_count::Ptr{Csize_t})::quiver_error_t
+end
+
 function quiver_database_free_time_series_data(column_names, column_types, column_data, column_has_value, column_count, row_count)
     @ccall libquiver_c.quiver_database_free_time_series_data(column_names::Ptr{Ptr{Cchar}}, column_types::Ptr{Cint}, column_data::Ptr{Ptr{Cvoid}}, column_has_value::Ptr{Ptr{UInt8}}, column_count::Csize_t, row_count::Csize_t)::quiver_error_t
 end
@@ -462,6 +654,46 @@ function quiver_database_query_float_params(db, sql, param_types, param_values,
     @ccall libquiver_c.quiver_database_query_float_params(db::Ptr{quiver_database_t}, sql::Ptr{Cchar}, param_types::Ptr{Cint}, param_values::Ptr{Ptr{Cvoid}}, param_count::Csize_t, out_value::Ptr{Cdouble}, out_has_value::Ptr{Cint})::quiver_error_t
 end
 
+function quiver_database_query_table(db, sql, param_types, param_values, param_count, out_column_names, out_column_types, out_column_data, out_column_has_value, out_column_count, out_row_count)
+    @ccall libquiver_c.quiver_database_query_table(db::Ptr{quiver_database_t}, sql::Ptr{Cchar}, param_types::Ptr{Cint}, param_values::Ptr{Ptr{Cvoid}}, param_count::Csize_t, out_column_names::Ptr{Ptr{Ptr{Cchar}}}, out_column_types::Ptr{Ptr{Cint}}, out_column_data::Ptr{Ptr{Ptr{Cvoid}}}, out_column_has_value::Ptr{Ptr{Ptr{UInt8}}}, out_column_count::Ptr{Csize_t}, out_row_count::Ptr{Csize_t})::quiver_error_t
+end
+
+mutable struct quiver_database_cursor end
+
+const quiver_database_cursor_t = quiver_database_cursor
+
+function quiver_database_cursor_open(db, sql, param_types, param_values, param_count, out_cursor)
+    @ccall libquiver_c.quiver_database_cursor_open(db::Ptr{quiver_database_t}, sql::Ptr{Cchar}, param_types::Ptr{Cint}, param_values::Ptr{Ptr{Cvoid}}, param_count::Csize_t, out_cursor::Ptr{Ptr{quiver_database_cursor_t}})::quiver_error_t
+end
+
+function quiver_database_cursor_next(cursor, out_has_row)
+    @ccall libquiver_c.quiver_database_cursor_next(cursor::Ptr{quiver_database_cursor_t}, out_has_row::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_database_cursor_column_count(cursor, out_count)
+    @ccall libquiver_c.quiver_database_cursor_column_count(cursor::Ptr{quiver_database_cursor_t}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_cursor_column_name(cursor, index, out_name)
+    @ccall libquiver_c.quiver_database_cursor_column_name(cursor::Ptr{quiver_database_cursor_t}, index::Csize_t, out_name::Ptr{Ptr{Cchar}})::quiver_error_t
+end
+
+function quiver_database_cursor_get_integer(cursor, index, out_value, out_has_value)
+    @ccall libquiver_c.quiver_database_cursor_get_integer(cursor::Ptr{quiver_database_cursor_t}, index::Csize_t, out_value::Ptr{Int64}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_database_cursor_get_float(cursor, index, out_value, out_has_value)
+    @ccall libquiver_c.quiver_database_cursor_get_float(cursor::Ptr{quiver_database_cursor_t}, index::Csize_t, out_value::Ptr{Cdouble}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_database_cursor_get_string(cursor, index, out_value, out_has_value)
+    @ccall libquiver_c.quiver_database_cursor_get_string(cursor::Ptr{quiver_database_cursor_t}, index::Csize_t, out_value::Ptr{Ptr{Cchar}}, out_has_value::Ptr{Cint})::quiver_error_t
+end
+
+function quiver_database_cursor_close(cursor)
+    @ccall libquiver_c.quiver_database_cursor_close(cursor::Ptr{quiver_database_cursor_t})::quiver_error_t
+end
+
 function quiver_database_describe(db, out_report)
     @ccall libquiver_c.quiver_database_describe(db::Ptr{quiver_database_t}, out_report::Ptr{Ptr{Cchar}})::quiver_error_t
 end
@@ -474,6 +706,25 @@ function quiver_database_summarize_collection(db, collection, out_report)
     @ccall libquiver_c.quiver_database_summarize_collection(db::Ptr{quiver_database_t}, collection::Ptr{Cchar}, out_report::Ptr{Ptr{Cchar}})::quiver_error_t
 end
 
+struct quiver_missing_index_t
+    table::Ptr{Cchar}
+    columns::Ptr{Cchar}
+    reason::Ptr{Cchar}
+    create_sql::Ptr{Cchar}
+end
+
+function quiver_database_missing_indexes(db, out_indexes, out_count)
+    @ccall libquiver_c.quiver_database_missing_indexes(db::Ptr{quiver_database_t}, out_indexes::Ptr{Ptr{quiver_missing_index_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_ensure_indexes(db, out_created, out_count)
+    @ccall libquiver_c.quiver_database_ensure_indexes(db::Ptr{quiver_database_t}, out_created::Ptr{Ptr{quiver_missing_index_t}}, out_count::Ptr{Csize_t})::quiver_error_t
+end
+
+function quiver_database_free_missing_indexes(indexes, count)
+    @ccall libquiver_c.quiver_database_free_missing_indexes(indexes::Ptr{quiver_missing_index_t}, count::Csize_t)::quiver_error_t
+end
+
 function quiver_element_create(out_element)
     @ccall libquiver_c.quiver_element_create(out_element::Ptr{Ptr{quiver_element_t}})::quiver_error_t
 end
@@ -554,6 +805,64 @@ function quiver_lua_runner_free_string(str)
     @ccall libquiver_c.quiver_lua_runner_free_string(str::Ptr{Cchar})::quiver_error_t
 end
 
+mutable struct quiver_async_database end
+
+const quiver_async_database_t = quiver_async_database
+
+mutable struct quiver_async_database_options_t
+    max_batch_writes::Csize_t
+    max_batch_delay_us::Int64
+end
+
+# typedef void ( * quiver_async_callback_t ) ( void * user_data , quiver_error_t status , const char * error )
+const quiver_async_callback_t = Ptr{Cvoid}
+
+# typedef void ( * quiver_async_id_callback_t ) ( void * user_data , quiver_error_t status , int64_t id , const char * error )
+const quiver_async_id_callback_t = Ptr{Cvoid}
+
+# typedef void ( * quiver_async_ids_callback_t ) ( void * user_data , quiver_error_t status , const int64_t * ids , size_t count , const char * error )
+const quiver_async_ids_callback_t = Ptr{Cvoid}
+
+function quiver_async_database_options_default()
+    @ccall libquiver_c.quiver_async_database_options_default()::quiver_async_database_options_t
+end
+
+function quiver_async_database_open(path, options, async_options, out_db)
+    @ccall libquiver_c.quiver_async_database_open(path::Ptr{Cchar}, options::Ptr{quiver_database_options_t}, async_options::Ptr{quiver_async_database_options_t}, out_db::Ptr{Ptr{quiver_async_database_t}})::quiver_error_t
+end
+
+function quiver_async_database_close(db)
+    @ccall libquiver_c.quiver_async_database_close(db::Ptr{quiver_async_database_t})::quiver_error_t
+end
+
+function quiver_async_database_create_element(db, collection, element, callback, user_data)
+    @ccall libquiver_c.quiver_async_database_create_element(db::Ptr{quiver_async_database_t}, collection::Ptr{Cchar}, element::Ptr{quiver_element_t}, callback::quiver_async_id_callback_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
+function quiver_async_database_update_element(db, collection, id, element, callback, user_data)
+    @ccall libquiver_c.quiver_async_database_update_element(db::Ptr{quiver_async_database_t}, collection::Ptr{Cchar}, id::Int64, element::Ptr{quiver_element_t}, callback::quiver_async_callback_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
+function quiver_async_database_delete_element(db, collection, id, callback, user_data)
+    @ccall libquiver_c.quiver_async_database_delete_element(db::Ptr{quiver_async_database_t}, collection::Ptr{Cchar}, id::Int64, callback::quiver_async_callback_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
+function quiver_async_database_import_csv(db, collection, group, path, options, callback, user_data)
+    @ccall libquiver_c.quiver_async_database_import_csv(db::Ptr{quiver_async_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, path::Ptr{Cchar}, options::Ptr{quiver_csv_options_t}, callback::quiver_async_callback_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
+function quiver_async_database_read_element_ids(db, collection, callback, user_data)
+    @ccall libquiver_c.quiver_async_database_read_element_ids(db::Ptr{quiver_async_database_t}, collection::Ptr{Cchar}, callback::quiver_async_ids_callback_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
+function quiver_async_database_export_csv(db, collection, group, path, options, callback, user_data)
+    @ccall libquiver_c.quiver_async_database_export_csv(db::Ptr{quiver_async_database_t}, collection::Ptr{Cchar}, group::Ptr{Cchar}, path::Ptr{Cchar}, options::Ptr{quiver_csv_options_t}, callback::quiver_async_callback_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
+function quiver_async_database_flush(db, callback, user_data)
+    @ccall libquiver_c.quiver_async_database_flush(db::Ptr{quiver_async_database_t}, callback::quiver_async_callback_t, user_data::Ptr{Cvoid})::quiver_error_t
+end
+
 @cenum quiver_time_frequency_t::UInt32 begin
     QUIVER_TIME_FREQUENCY_YEARLY = 0
     QUIVER_TIME_FREQUENCY_MONTHLY = 1
@@ -16,7 +16,7 @@ function read_scalar_integers(db::Database, collection::String, attribute::Strin
     values = unsafe_wrap(Array, out_values[], count)
     mask = unsafe_wrap(Array, out_mask[], count)
     result = if not_null
-        Int64[values[i] for i in 1:count]
+        copy(values)
     else
         Optional{Int64}[mask[i] != 0 ? values[i] : nothing for i in 1:count]
     end
@@ -43,7 +43,7 @@ function read_scalar_floats(db::Database, collection::String, attribute::String)
     values = unsafe_wrap(Array, out_values[], count)
     mask = unsafe_wrap(Array, out_mask[], count)
     result = if not_null
-        Float64[values[i] for i in 1:count]
+        copy(values)
     else
         Optional{Float64}[mask[i] != 0 ? values[i] : nothing for i in 1:count]
     end
@@ -20,6 +20,7 @@ HEADERS = [
     "include/quiver/c/database.h",
     "include/quiver/c/element.h",
     "include/quiver/c/lua_runner.h",
+    "include/quiver/c/async_database.h",
 ]
 
 
@@ -24,13 +24,62 @@ ffi.cdef("""
         QUIVER_LOG_OFF = 4,
     } quiver_log_level_t;
 
+    typedef enum {
+        QUIVER_FILE_LOG_SYNC = 0,
+        QUIVER_FILE_LOG_ASYNC = 1,
+        QUIVER_FILE_LOG_OFF = 2,
+    } quiver_file_log_mode_t;
+
+    typedef enum {
+        QUIVER_JOURNAL_MODE_DEFAULT = 0,
+        QUIVER_JOURNAL_MODE_DELETE = 1,
+        QUIVER_JOURNAL_MODE_WAL = 2,
+        QUIVER_JOURNAL_MODE_MEMORY = 3,
+        QUIVER_JOURNAL_MODE_OFF = 4,
+    } quiver_journal_mode_t;
+
+    typedef enum {
+        QUIVER_SYNCHRONOUS_DEFAULT = 0,
+        QUIVER_SYNCHRONOUS_OFF = 1,
+        QUIVER_SYNCHRONOUS_NORMAL = 2,
+        QUIVER_SYNCHRONOUS_FULL = 3,
+        QUIVER_SYNCHRONOUS_EXTRA = 4,
+    } quiver_synchronous_t;
+
+    typedef enum {
+        QUIVER_TEMP_STORE_DEFAULT = 0,
+        QUIVER_TEMP_STORE_FILE = 1,
+        QUIVER_TEMP_STORE_MEMORY = 2,
+    } quiver_temp_store_t;
+
+    typedef struct {
+        quiver_journal_mode_t journal_mode;
+        quiver_synchronous_t synchronous;
+        quiver_temp_store_t temp_store;
+        int64_t cache_size_kib;
+        int64_t mmap_size;
+    } quiver_connection_profile_t;
+
+    typedef struct {
+        int enabled;
+        int64_t slow_threshold_ns;
+        int64_t ring_capacity;
+    } quiver_sql_trace_options_t;
+
     typedef struct {
         int read_only;
         quiver_log_level_t console_level;
+        quiver_connection_profile_t profile;
+        quiver_sql_trace_options_t trace;
+        quiver_file_log_mode_t file_log;
+        int immutable;
     } quiver_database_options_t;
 
     // database.h
     quiver_database_options_t quiver_database_options_default(void);
+    quiver_connection_profile_t quiver_connection_profile_bulk_load(void);
+    quiver_connection_profile_t quiver_connection_profile_read_mostly(void);
+    quiver_connection_profile_t quiver_connection_profile_durable(void);
 
     typedef struct quiver_database quiver_database_t;
 
@@ -45,6 +94,9 @@ ffi.cdef("""
                                                 const char* schema_path,
                                                 const quiver_database_options_t* options,
                                                 quiver_database_t** out_db);
+    quiver_error_t quiver_database_open_in_memory_copy(const char* path,
+        const quiver_database_options_t* options, quiver_database_t** out_db);
+    quiver_error_t quiver_database_save_to(quiver_database_t* db, const char* path);
     quiver_error_t quiver_database_close(quiver_database_t* db);
     quiver_error_t quiver_database_is_healthy(quiver_database_t* db, int* out_healthy);
     quiver_error_t quiver_database_path(quiver_database_t* db, const char** out_path);
@@ -166,6 +218,27 @@ ffi.cdef("""
         const char* collection, const char* attribute, int64_t id,
         char*** out_values, size_t* out_count);
 
+    // Read scalar attributes for a list of IDs
+    quiver_error_t quiver_database_read_scalar_integers_by_ids(quiver_database_t* db,
+        const char* collection, const char* attribute, const int64_t* ids, size_t id_count,
+        int64_t** out_values, uint8_t** out_mask, size_t* out_count);
+    quiver_error_t quiver_database_read_scalar_floats_by_ids(quiver_database_t* db,
+        const char* collection, const char* attribute, const int64_t* ids, size_t id_count,
+        double** out_values, uint8_t** out_mask, size_t* out_count);
+    quiver_error_t quiver_database_read_scalar_strings_by_ids(quiver_database_t* db,
+        const char* collection, const char* attribute, const int64_t* ids, size_t id_count,
+        char*** out_values, size_t* out_count);
+
+    // Read vector/set group by ID
+    quiver_error_t quiver_database_read_vector_group_by_id(quiver_database_t* db,
+        const char* collection, const char* group, int64_t id, char*** out_column_names,
+        int** out_column_types, void*** out_column_data, uint8_t*** out_column_has_value,
+        size_t* out_column_count, size_t* out_row_count);
+    quiver_error_t quiver_database_read_set_group_by_id(quiver_database_t* db,
+        const char* collection, const char* group, int64_t id, char*** out_column_names,
+        int** out_column_types, void*** out_column_data, uint8_t*** out_column_has_value,
+        size_t* out_column_count, size_t* out_row_count);
+
     // Read element Ids
     quiver_error_t quiver_database_read_element_ids(quiver_database_t* db,
         const char* collection, int64_t** out_ids, size_t* out_count);
@@ -357,6 +430,142 @@ ffi.cdef("""
         const char* collection, const char* group, const char* path,
         const quiver_csv_options_t* options);
 
+    // Batch create and bulk delete
+    quiver_error_t quiver_database_create_elements(quiver_database_t* db,
+        const char* collection, const quiver_element_t* const* elements, size_t element_count,
+        int64_t* out_ids);
+
+    typedef struct {
+        int64_t elements;
+        char** group_tables;
+        int64_t* group_rows;
+        size_t group_count;
+    } quiver_delete_result_t;
+
+    quiver_error_t quiver_database_delete_elements(quiver_database_t* db,
+        const char* collection, const int64_t* ids, size_t id_count,
+        quiver_delete_result_t* out_result);
+    quiver_error_t quiver_database_delete_elements_where(quiver_database_t* db,
+        const char* collection, const char* predicate, const int* param_types,
+        const void* const* param_values, size_t param_count, quiver_delete_result_t* out_result);
+    quiver_error_t quiver_database_free_delete_result(quiver_delete_result_t* result);
+
+    // Time series - every element, bulk write and many timestamps
+    typedef enum {
+        QUIVER_TIME_SERIES_WRITE_APPEND = 0,
+        QUIVER_TIME_SERIES_WRITE_REPLACE_RANGE = 1,
+        QUIVER_TIME_SERIES_WRITE_UPSERT = 2,
+    } quiver_time_series_write_mode_t;
+
+    quiver_error_t quiver_database_read_time_series_group_all(quiver_database_t* db,
+        const char* collection, const char* group, int64_t** out_ids, char*** out_column_names,
+        int** out_column_types, void*** out_column_data, uint8_t*** out_column_has_value,
+        size_t* out_column_count, size_t* out_row_count);
+
+    quiver_error_t quiver_database_write_time_series(quiver_database_t* db,
+        const char* collection, const char* group, const int64_t* ids,
+        const char* const* column_names, const int* column_types, const void* const* column_data,
+        const uint8_t* const* column_has_value, size_t column_count, size_t row_count, int mode);
+
+    quiver_error_t quiver_database_read_time_series_rows(quiver_database_t* db,
+        const char* collection, const char* group, const char* attribute,
+        const char* const* date_times, size_t date_time_count, int* out_data_type,
+        void** out_values, size_t* out_element_count);
+
+    // Whole-result query and streaming cursor
+    quiver_error_t quiver_database_query_table(quiver_database_t* db,
+        const char* sql, const int* param_types, const void* const* param_values,
+        size_t param_count, char*** out_column_names, int** out_column_types,
+        void*** out_column_data, uint8_t*** out_column_has_value, size_t* out_column_count,
+        size_t* out_row_count);
+
+    typedef struct quiver_database_cursor quiver_database_cursor_t;
+
+    quiver_error_t quiver_database_cursor_open(quiver_database_t* db,
+        const char* sql, const int* param_types, const void* const* param_values,
+        size_t param_count, quiver_database_cursor_t** out_cursor);
+    quiver_error_t quiver_database_cursor_next(quiver_database_cursor_t* cursor, int* out_has_row);
+    quiver_error_t quiver_database_cursor_column_count(quiver_database_cursor_t* cursor,
+        size_t* out_count);
+    quiver_error_t quiver_database_cursor_column_name(quiver_database_cursor_t* cursor,
+        size_t index, const char** out_name);
+    quiver_error_t quiver_database_cursor_get_integer(quiver_database_cursor_t* cursor,
+        size_t index, int64_t* out_value, int* out_has_value);
+    quiver_error_t quiver_database_cursor_get_float(quiver_database_cursor_t* cursor,
+        size_t index, double* out_value, int* out_has_value);
+    quiver_error_t quiver_database_cursor_get_string(quiver_database_cursor_t* cursor,
+        size_t index, char** out_value, int* out_has_value);
+    quiver_error_t quiver_database_cursor_close(quiver_database_cursor_t* cursor);
+
+    // Change feed
+    typedef enum {
+        QUIVER_CHANGE_CREATED = 0,
+        QUIVER_CHANGE_UPDATED = 1,
+        QUIVER_CHANGE_DELETED = 2,
+    } quiver_change_kind_t;
+
+    typedef void (*quiver_change_callback_t)(void* user_data,
+        int64_t sequence, const char* table, const char* collection, quiver_change_kind_t kind,
+        const int64_t* ids, size_t id_count);
+
+    quiver_error_t quiver_database_subscribe_changes(quiver_database_t* db,
+        quiver_change_callback_t callback, void* user_data, int64_t* out_subscription);
+    quiver_error_t quiver_database_unsubscribe_changes(quiver_database_t* db, int64_t subscription);
+    quiver_error_t quiver_database_poll_changes(quiver_database_t* db,
+        int64_t subscription, int64_t** out_sequences, char*** out_tables, char*** out_collections,
+        int** out_kinds, int64_t** out_ids, size_t* out_count);
+    quiver_error_t quiver_database_free_changes(int64_t* sequences,
+        char** tables, char** collections, int* kinds, int64_t* ids, size_t count);
+
+    // Per-operation metrics
+    typedef struct {
+        char* operation;
+        int64_t calls;
+        int64_t total_ns;
+        int64_t p50_ns;
+        int64_t p99_ns;
+        int64_t rows_read;
+        int64_t rows_written;
+        int64_t statements_prepared;
+        int64_t statements_reused;
+        int64_t bytes_bound;
+    } quiver_operation_stats_t;
+
+    quiver_error_t quiver_database_enable_stats(quiver_database_t* db, int enabled);
+    quiver_error_t quiver_database_stats(quiver_database_t* db,
+        quiver_operation_stats_t** out_stats, size_t* out_count);
+    quiver_error_t quiver_database_reset_stats(quiver_database_t* db);
+    quiver_error_t quiver_database_free_stats(quiver_operation_stats_t* stats, size_t count);
+
+    // SQL trace
+    typedef struct {
+        char* sql;
+        char* operation;
+        int64_t elapsed_ns;
+        int64_t rows;
+    } quiver_traced_statement_t;
+
+    quiver_error_t quiver_database_traced_statements(quiver_database_t* db,
+        quiver_traced_statement_t** out_statements, size_t* out_count);
+    quiver_error_t quiver_database_clear_traced_statements(quiver_database_t* db);
+    quiver_error_t quiver_database_free_traced_statements(quiver_traced_statement_t* statements,
+        size_t count);
+
+    // Index advisor
+    typedef struct {
+        char* table;
+        char* columns;
+        char* reason;
+        char* create_sql;
+    } quiver_missing_index_t;
+
+    quiver_error_t quiver_database_missing_indexes(quiver_database_t* db,
+        quiver_missing_index_t** out_indexes, size_t* out_count);
+    quiver_error_t quiver_database_ensure_indexes(quiver_database_t* db,
+        quiver_missing_index_t** out_created, size_t* out_count);
+    quiver_error_t quiver_database_free_missing_indexes(quiver_missing_index_t* indexes,
+        size_t count);
+
     // lua_runner.h
     typedef struct quiver_lua_runner quiver_lua_runner_t;
 
@@ -364,6 +573,49 @@ ffi.cdef("""
     quiver_error_t quiver_lua_runner_free(quiver_lua_runner_t* runner);
     quiver_error_t quiver_lua_runner_run(quiver_lua_runner_t* runner, const char* script, char** out_result);
     quiver_error_t quiver_lua_runner_free_string(char* str);
+
+    // async_database.h
+    typedef struct quiver_async_database quiver_async_database_t;
+
+    typedef struct {
+        size_t max_batch_writes;
+        int64_t max_batch_delay_us;
+    } quiver_async_database_options_t;
+
+    typedef void (*quiver_async_callback_t)(void* user_data,
+        quiver_error_t status, const char* error);
+    typedef void (*quiver_async_id_callback_t)(void* user_data,
+        quiver_error_t status, int64_t id, const char* error);
+    typedef void (*quiver_async_ids_callback_t)(void* user_data,
+        quiver_error_t status, const int64_t* ids, size_t count, const char* error);
+
+    quiver_async_database_options_t quiver_async_database_options_default(void);
+
+    quiver_error_t quiver_async_database_open(const char* path,
+        const quiver_database_options_t* options,
+        const quiver_async_database_options_t* async_options, quiver_async_database_t** out_db);
+    quiver_error_t quiver_async_database_close(quiver_async_database_t* db);
+
+    quiver_error_t quiver_async_database_create_element(quiver_async_database_t* db,
+        const char* collection, const quiver_element_t* element,
+        quiver_async_id_callback_t callback, void* user_data);
+    quiver_error_t quiver_async_database_update_element(quiver_async_database_t* db,
+        const char* collection, int64_t id, const quiver_element_t* element,
+        quiver_async_callback_t callback, void* user_data);
+    quiver_error_t quiver_async_database_delete_element(quiver_async_database_t* db,
+        const char* collection, int64_t id, quiver_async_callback_t callback, void* user_data);
+    quiver_error_t quiver_async_database_import_csv(quiver_async_database_t* db,
+        const char* collection, const char* group, const char* path,
+        const quiver_csv_options_t* options, quiver_async_callback_t callback, void* user_data);
+
+    quiver_error_t quiver_async_database_read_element_ids(quiver_async_database_t* db,
+        const char* collection, quiver_async_ids_callback_t callback, void* user_data);
+    quiver_error_t quiver_async_database_export_csv(quiver_async_database_t* db,
+        const char* collection, const char* group, const char* path,
+        const quiver_csv_options_t* options, quiver_async_callback_t callback, void* user_data);
+
+    quiver_error_t quiver_async_database_flush(quiver_async_database_t* db,
+        quiver_async_callback_t callback, void* user_data);
 """)
 
 _lib = None
@@ -487,8 +487,10 @@ class Database(DatabaseCSVExport, DatabaseCSVImport):
         if count == 0 or out_values[0] == ffi.NULL:
             return []
         try:
-            mask = out_mask[0]
-            return [out_values[0][i] if mask[i] else None for i in range(count)]
+            # Bulk-copy both buffers once instead of indexing the C arrays per element.
+            values = ffi.unpack(out_values[0], count)
+            mask = ffi.unpack(out_mask[0], count)
+            return [value if present else None for value, present in zip(values, mask)]
         finally:
             lib.quiver_database_free_integer_array(out_values[0])
             lib.quiver_database_free_mask(out_mask[0])
@@ -514,8 +516,10 @@ class Database(DatabaseCSVExport, DatabaseCSVImport):
         if count == 0 or out_values[0] == ffi.NULL:
             return []
         try:
-            mask = out_mask[0]
-            return [out_values[0][i] if mask[i] else None for i in range(count)]
+            # Bulk-copy both buffers once instead of indexing the C arrays per element.
+            values = ffi.unpack(out_values[0], count)
+            mask = ffi.unpack(out_mask[0], count)
+            return [value if present else None for value, present in zip(values, mask)]
         finally:
             lib.quiver_database_free_float_array(out_values[0])
             lib.quiver_database_free_mask(out_mask[0])
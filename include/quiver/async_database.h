@@ -0,0 +1,146 @@
+#ifndef QUIVER_ASYNC_DATABASE_H
+#define QUIVER_ASYNC_DATABASE_H
+
+#include "export.h"
+#include "quiver/database.h"
+#include "quiver/options.h"
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace quiver {
+
+// How AsyncDatabase groups consecutive writes into one transaction.
+struct AsyncDatabaseOptions {
+    // Most writes committed together; 1 gives every write its own transaction.
+    size_t max_batch_writes = 1000;
+    // How long a batch stays open for more writes after its first one. 0 commits as soon as no write
+    // is waiting, so coalescing never delays a lone write.
+    std::chrono::microseconds max_batch_delay{0};
+};
+
+// Owns a Database on one worker thread and runs queued operations there in submission order, so the
+// calling thread never blocks on SQLite. Every operation returns a std::future for its result; an
+// exception thrown by the operation is rethrown by the future's get().
+//
+// Consecutive writes share one transaction, up to max_batch_writes or max_batch_delay after the
+// first of them, and their futures resolve once it commits. Each write runs inside its own
+// SAVEPOINT: if it throws, only its changes are rolled back (ROLLBACK TO), its future gets the
+// exception and the batch carries on, so every write runs once and ends up committed or failed as
+// if it had run alone. Only an error that ends the whole transaction (a failed commit, or one SQLite
+// rolls back itself, such as a full disk) fails every write of the batch. A write submitted while
+// the connection is already in a transaction (one a submit() opened, or a dry run) joins that
+// transaction instead and resolves at once.
+//
+// Anything that is not a write ends the current batch first, so it sees every earlier write
+// committed. The destructor runs everything still queued, then stops the worker.
+class QUIVER_API AsyncDatabase {
+public:
+    explicit AsyncDatabase(Database database, const AsyncDatabaseOptions& options = {});
+    AsyncDatabase(const std::string& path,
+                  const DatabaseOptions& db_options = {},
+                  const AsyncDatabaseOptions& options = {});
+    ~AsyncDatabase();
+
+    // Non-copyable, non-movable: the worker thread holds a pointer to the queue
+    AsyncDatabase(const AsyncDatabase&) = delete;
+    AsyncDatabase& operator=(const AsyncDatabase&) = delete;
+    AsyncDatabase(AsyncDatabase&&) = delete;
+    AsyncDatabase& operator=(AsyncDatabase&&) = delete;
+
+    // Runs fn(Database&) on the worker. fn may manage transactions and dry runs itself.
+    template <typename F>
+    auto submit(F fn) -> std::future<std::invoke_result_t<F&, Database&>>;
+
+    // Runs fn(Database&) on the worker as a write that may share a transaction with its neighbours.
+    // fn must not begin, commit or roll back transactions or savepoints.
+    template <typename F>
+    auto submit_write(F fn) -> std::future<std::invoke_result_t<F&, Database&>>;
+
+    // Callback forms for callers that cannot wait on a future (the C API): done runs on the worker
+    // once fn's outcome is final - for a batched write, after the commit - with a null pointer on
+    // success or fn's exception. fn keeps any result itself; done must not throw.
+    void submit(std::function<void(Database&)> fn, std::function<void(std::exception_ptr)> done);
+    void submit_write(std::function<void(Database&)> fn, std::function<void(std::exception_ptr)> done);
+
+    // Writes
+    std::future<int64_t> create_element(const std::string& collection, const Element& element);
+    std::future<void> update_element(const std::string& collection, int64_t id, const Element& element);
+    std::future<void> delete_element(const std::string& collection, int64_t id);
+    // Runs on its own, like a read: it manages its own transaction, so it ends the current batch
+    // rather than joining one.
+    std::future<void> import_csv(const std::string& collection,
+                                 const std::string& group,
+                                 const std::string& path,
+                                 const CSVOptions& options = default_csv_options());
+
+    // Reads
+    std::future<std::vector<int64_t>> read_element_ids(const std::string& collection);
+    std::future<std::vector<std::optional<int64_t>>> read_scalar_integers(const std::string& collection,
+                                                                          const std::string& attribute);
+    std::future<std::vector<std::optional<double>>> read_scalar_floats(const std::string& collection,
+                                                                       const std::string& attribute);
+    std::future<std::vector<std::optional<std::string>>> read_scalar_strings(const std::string& collection,
+                                                                             const std::string& attribute);
+    std::future<void> export_csv(const std::string& collection,
+                                 const std::string& group,
+                                 const std::string& path,
+                                 const CSVOptions& options = default_csv_options());
+
+    // Resolves once everything submitted before it has finished and committed.
+    std::future<void> flush();
+
+private:
+    // Runs on the worker: performs the operation and returns what resolves its future, which the
+    // worker calls once the operation's transaction (if it shares one) has committed.
+    using Operation = std::function<std::function<void()>(Database&)>;
+    using Failure = std::function<void(std::exception_ptr)>;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+
+    void enqueue(Operation operation, Failure failure, bool write);
+
+    template <typename F>
+    auto enqueue_task(F fn, bool write) -> std::future<std::invoke_result_t<F&, Database&>>;
+};
+
+template <typename F>
+auto AsyncDatabase::submit(F fn) -> std::future<std::invoke_result_t<F&, Database&>> {
+    return enqueue_task(std::move(fn), false);
+}
+
+template <typename F>
+auto AsyncDatabase::submit_write(F fn) -> std::future<std::invoke_result_t<F&, Database&>> {
+    return enqueue_task(std::move(fn), true);
+}
+
+template <typename F>
+auto AsyncDatabase::enqueue_task(F fn, bool write) -> std::future<std::invoke_result_t<F&, Database&>> {
+    using Result = std::invoke_result_t<F&, Database&>;
+    // std::function needs copyable callables, so the promise (and a result) travel by shared_ptr.
+    auto promise = std::make_shared<std::promise<Result>>();
+    auto future = promise->get_future();
+    enqueue(
+        [fn = std::move(fn), promise](Database& db) mutable -> std::function<void()> {
+            if constexpr (std::is_void_v<Result>) {
+                fn(db);
+                return [promise] { promise->set_value(); };
+            } else {
+                auto result = std::make_shared<Result>(fn(db));
+                return [promise, result] { promise->set_value(std::move(*result)); };
+            }
+        },
+        [promise](std::exception_ptr error) { promise->set_exception(error); },
+        write);
+    return future;
+}
+
+}  // namespace quiver
+
+#endif  // QUIVER_ASYNC_DATABASE_H
@@ -0,0 +1,93 @@
+#ifndef QUIVER_C_ASYNC_DATABASE_H
+#define QUIVER_C_ASYNC_DATABASE_H
+
+#include "common.h"
+#include "element.h"
+#include "options.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A database driven from a worker thread (see quiver::AsyncDatabase). Every operation returns as soon
+// as it is queued; its outcome arrives through a completion callback, so an event loop never blocks
+// on disk I/O. Operations run in submission order, and consecutive writes may share a transaction.
+typedef struct quiver_async_database quiver_async_database_t;
+
+typedef struct {
+    size_t max_batch_writes;     // most writes committed together; 1 = one transaction per write
+    int64_t max_batch_delay_us;  // how long a batch stays open after its first write; 0 = no waiting
+} quiver_async_database_options_t;
+
+// Completion callbacks run on the worker thread, once per operation. status is QUIVER_OK or
+// QUIVER_ERROR; on error, error holds the message (quiver_get_last_error is not set, it is per
+// thread), otherwise it is NULL. Strings and arrays are only valid during the call. A NULL callback
+// discards the outcome. Callbacks must not call back into the same async database and wait on it.
+typedef void (*quiver_async_callback_t)(void* user_data, quiver_error_t status, const char* error);
+typedef void (*quiver_async_id_callback_t)(void* user_data, quiver_error_t status, int64_t id, const char* error);
+typedef void (*quiver_async_ids_callback_t)(void* user_data,
+                                            quiver_error_t status,
+                                            const int64_t* ids,
+                                            size_t count,
+                                            const char* error);
+
+QUIVER_C_API quiver_async_database_options_t quiver_async_database_options_default(void);
+
+// NULL options mean defaults. The database is opened on the calling thread, so open errors are
+// reported directly.
+QUIVER_C_API quiver_error_t quiver_async_database_open(const char* path,
+                                                       const quiver_database_options_t* options,
+                                                       const quiver_async_database_options_t* async_options,
+                                                       quiver_async_database_t** out_db);
+// Blocks until every queued operation has run and its callback returned.
+QUIVER_C_API quiver_error_t quiver_async_database_close(quiver_async_database_t* db);
+
+// Writes. The element is copied before the call returns.
+QUIVER_C_API quiver_error_t quiver_async_database_create_element(quiver_async_database_t* db,
+                                                                 const char* collection,
+                                                                 const quiver_element_t* element,
+                                                                 quiver_async_id_callback_t callback,
+                                                                 void* user_data);
+QUIVER_C_API quiver_error_t quiver_async_database_update_element(quiver_async_database_t* db,
+                                                                 const char* collection,
+                                                                 int64_t id,
+                                                                 const quiver_element_t* element,
+                                                                 quiver_async_callback_t callback,
+                                                                 void* user_data);
+QUIVER_C_API quiver_error_t quiver_async_database_delete_element(quiver_async_database_t* db,
+                                                                 const char* collection,
+                                                                 int64_t id,
+                                                                 quiver_async_callback_t callback,
+                                                                 void* user_data);
+// Never batched: it runs in its own transaction once the writes queued before it have committed.
+QUIVER_C_API quiver_error_t quiver_async_database_import_csv(quiver_async_database_t* db,
+                                                             const char* collection,
+                                                             const char* group,
+                                                             const char* path,
+                                                             const quiver_csv_options_t* options,
+                                                             quiver_async_callback_t callback,
+                                                             void* user_data);
+
+// Reads
+QUIVER_C_API quiver_error_t quiver_async_database_read_element_ids(quiver_async_database_t* db,
+                                                                   const char* collection,
+                                                                   quiver_async_ids_callback_t callback,
+                                                                   void* user_data);
+QUIVER_C_API quiver_error_t quiver_async_database_export_csv(quiver_async_database_t* db,
+                                                             const char* collection,
+                                                             const char* group,
+                                                             const char* path,
+                                                             const quiver_csv_options_t* options,
+                                                             quiver_async_callback_t callback,
+                                                             void* user_data);
+
+// Completes once everything queued before it has finished and committed.
+QUIVER_C_API quiver_error_t quiver_async_database_flush(quiver_async_database_t* db,
+                                                        quiver_async_callback_t callback,
+                                                        void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // QUIVER_C_ASYNC_DATABASE_H
@@ -19,6 +19,13 @@ typedef enum {
     QUIVER_DATA_TYPE_NULL = 4
 } quiver_data_type_t;
 
+// How quiver_database_write_time_series treats rows already stored for the written elements
+typedef enum {
+    QUIVER_TIME_SERIES_WRITE_APPEND = 0,
+    QUIVER_TIME_SERIES_WRITE_REPLACE_RANGE = 1,
+    QUIVER_TIME_SERIES_WRITE_UPSERT = 2,
+} quiver_time_series_write_mode_t;
+
 // Opaque handle type
 typedef struct quiver_database quiver_database_t;
 
@@ -34,6 +41,12 @@ QUIVER_C_API quiver_error_t quiver_database_from_schema(const char* db_path,
                                                         const char* schema_path,
                                                         const quiver_database_options_t* options,
                                                         quiver_database_t** out_db);
+// Loads the database file at path into a private in-memory connection; see
+// Database::open_in_memory_copy. quiver_database_save_to writes a database out atomically.
+QUIVER_C_API quiver_error_t quiver_database_open_in_memory_copy(const char* path,
+                                                                const quiver_database_options_t* options,
+                                                                quiver_database_t** out_db);
+QUIVER_C_API quiver_error_t quiver_database_save_to(quiver_database_t* db, const char* path);
 QUIVER_C_API quiver_error_t quiver_database_close(quiver_database_t* db);
 QUIVER_C_API quiver_error_t quiver_database_is_healthy(quiver_database_t* db, int* out_healthy);
 QUIVER_C_API quiver_error_t quiver_database_path(quiver_database_t* db, const char** out_path);
@@ -50,6 +63,92 @@ QUIVER_C_API quiver_error_t quiver_database_begin_dry_run(quiver_database_t* db)
 QUIVER_C_API quiver_error_t quiver_database_end_dry_run(quiver_database_t* db);
 QUIVER_C_API quiver_error_t quiver_database_in_dry_run(quiver_database_t* db, int* out_active);
 
+// Change feed (see Database::subscribe_changes). One batch per committed transaction; rolled-back
+// transactions and dry runs publish nothing. Group-table writes made with raw SQL through a cursor
+// or quiver_database_query_* are not published, and WITHOUT ROWID collections publish nothing for
+// their own rows.
+typedef enum {
+    QUIVER_CHANGE_CREATED = 0,
+    QUIVER_CHANGE_UPDATED = 1,
+    QUIVER_CHANGE_DELETED = 2,
+} quiver_change_kind_t;
+
+// Called for each published batch once per (table, kind) that has ids, ids in ascending order.
+// Strings and ids are only valid during the call.
+typedef void (*quiver_change_callback_t)(void* user_data,
+                                         int64_t sequence,
+                                         const char* table,
+                                         const char* collection,
+                                         quiver_change_kind_t kind,
+                                         const int64_t* ids,
+                                         size_t id_count);
+
+// A NULL callback subscribes for polling: batches queue until quiver_database_poll_changes.
+QUIVER_C_API quiver_error_t quiver_database_subscribe_changes(quiver_database_t* db,
+                                                              quiver_change_callback_t callback,
+                                                              void* user_data,
+                                                              int64_t* out_subscription);
+QUIVER_C_API quiver_error_t quiver_database_unsubscribe_changes(quiver_database_t* db, int64_t subscription);
+// Takes the queued changes of a polling subscription, flattened to one entry per changed element:
+// out_sequences[i], out_tables[i], out_collections[i], out_kinds[i] (quiver_change_kind_t) and
+// out_ids[i]. Nothing queued returns NULL arrays and a zero count. Free with
+// quiver_database_free_changes.
+QUIVER_C_API quiver_error_t quiver_database_poll_changes(quiver_database_t* db,
+                                                         int64_t subscription,
+                                                         int64_t** out_sequences,
+                                                         char*** out_tables,
+                                                         char*** out_collections,
+                                                         int** out_kinds,
+                                                         int64_t** out_ids,
+                                                         size_t* out_count);
+QUIVER_C_API quiver_error_t quiver_database_free_changes(int64_t* sequences,
+                                                         char** tables,
+                                                         char** collections,
+                                                         int* kinds,
+                                                         int64_t* ids,
+                                                         size_t count);
+
+// Per-operation metrics (see Database::stats). Off until enabled; one entry per operation called
+// while enabled, sorted by name.
+typedef struct {
+    char* operation;
+    int64_t calls;
+    int64_t total_ns;
+    int64_t p50_ns;
+    int64_t p99_ns;
+    int64_t rows_read;
+    int64_t rows_written;
+    int64_t statements_prepared;
+    int64_t statements_reused;
+    int64_t bytes_bound;
+} quiver_operation_stats_t;
+
+QUIVER_C_API quiver_error_t quiver_database_enable_stats(quiver_database_t* db, int enabled);
+// No operations recorded returns a NULL array and a zero count. Free with quiver_database_free_stats.
+QUIVER_C_API quiver_error_t quiver_database_stats(quiver_database_t* db,
+                                                  quiver_operation_stats_t** out_stats,
+                                                  size_t* out_count);
+QUIVER_C_API quiver_error_t quiver_database_reset_stats(quiver_database_t* db);
+QUIVER_C_API quiver_error_t quiver_database_free_stats(quiver_operation_stats_t* stats, size_t count);
+
+// SQL trace (see Database::traced_statements and quiver_database_options_t.trace). operation is ""
+// for a statement run outside any database function.
+typedef struct {
+    char* sql;
+    char* operation;
+    int64_t elapsed_ns;
+    int64_t rows;
+} quiver_traced_statement_t;
+
+// Oldest first; nothing traced returns a NULL array and a zero count. Free with
+// quiver_database_free_traced_statements.
+QUIVER_C_API quiver_error_t quiver_database_traced_statements(quiver_database_t* db,
+                                                              quiver_traced_statement_t** out_statements,
+                                                              size_t* out_count);
+QUIVER_C_API quiver_error_t quiver_database_clear_traced_statements(quiver_database_t* db);
+QUIVER_C_API quiver_error_t quiver_database_free_traced_statements(quiver_traced_statement_t* statements,
+                                                                   size_t count);
+
 // Version
 QUIVER_C_API quiver_error_t quiver_database_current_version(quiver_database_t* db, int64_t* out_version);
 
@@ -59,12 +158,44 @@ QUIVER_C_API quiver_error_t quiver_database_create_element(quiver_database_t* db
                                                            const char* collection,
                                                            quiver_element_t* element,
                                                            int64_t* out_id);
+// Batch create (see Database::create_elements). out_ids is caller-owned storage for element_count
+// ids, written in input order.
+QUIVER_C_API quiver_error_t quiver_database_create_elements(quiver_database_t* db,
+                                                            const char* collection,
+                                                            const quiver_element_t* const* elements,
+                                                            size_t element_count,
+                                                            int64_t* out_ids);
 QUIVER_C_API quiver_error_t quiver_database_update_element(quiver_database_t* db,
                                                            const char* collection,
                                                            int64_t id,
                                                            const quiver_element_t* element);
 QUIVER_C_API quiver_error_t quiver_database_delete_element(quiver_database_t* db, const char* collection, int64_t id);
 
+// Bulk delete (see Database::delete_elements). elements is how many elements were deleted, and
+// group_tables[i] lost group_rows[i] rows with them. Free with quiver_database_free_delete_result.
+typedef struct {
+    int64_t elements;
+    char** group_tables;
+    int64_t* group_rows;
+    size_t group_count;
+} quiver_delete_result_t;
+
+QUIVER_C_API quiver_error_t quiver_database_delete_elements(quiver_database_t* db,
+                                                            const char* collection,
+                                                            const int64_t* ids,
+                                                            size_t id_count,
+                                                            quiver_delete_result_t* out_result);
+// predicate is a SQL expression over the collection's columns; its parameters use the *_params
+// query encoding.
+QUIVER_C_API quiver_error_t quiver_database_delete_elements_where(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* predicate,
+                                                                  const int* param_types,
+                                                                  const void* const* param_values,
+                                                                  size_t param_count,
+                                                                  quiver_delete_result_t* out_result);
+QUIVER_C_API quiver_error_t quiver_database_free_delete_result(quiver_delete_result_t* result);
+
 // Read scalar attributes. One entry per element (aligned with read_element_ids).
 // Numeric readers carry a parallel presence mask: out_mask[i] == 0 means SQL NULL and
 // out_values[i] is then a placeholder (0 / 0.0) to be ignored. Free out_values with the
@@ -156,6 +287,35 @@ QUIVER_C_API quiver_error_t quiver_database_read_scalar_string_by_id(quiver_data
                                                                      char** out_value,
                                                                      int* out_has_value);
 
+// Read scalar attributes for a list of element IDs in one call. Entry i belongs to ids[i]
+// (duplicates repeat; an unknown id reads as NULL). Same output layout and free functions as
+// quiver_database_read_scalar_integers / floats / strings.
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_by_ids(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        const int64_t* ids,
+                                                                        size_t id_count,
+                                                                        int64_t** out_values,
+                                                                        uint8_t** out_mask,
+                                                                        size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_by_ids(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      const int64_t* ids,
+                                                                      size_t id_count,
+                                                                      double** out_values,
+                                                                      uint8_t** out_mask,
+                                                                      size_t* out_count);
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_by_ids(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       const int64_t* ids,
+                                                                       size_t id_count,
+                                                                       char*** out_values,
+                                                                       size_t* out_count);
+
 // Read vector attributes by element ID
 QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_by_id(quiver_database_t* db,
                                                                        const char* collection,
@@ -360,6 +520,22 @@ QUIVER_C_API quiver_error_t quiver_database_read_time_series_group(quiver_databa
                                                                    size_t* out_column_count,
                                                                    size_t* out_row_count);
 
+// Read time series group for every element in one ordered scan (by id, then dimension columns)
+// out_ids[r]: element id of row r; free with quiver_database_free_integer_array
+// The columns use the quiver_database_read_time_series_group layout (dimension columns first, then
+// value columns) and are freed with quiver_database_free_time_series_data. An empty group returns
+// NULL arrays with zero counts
+QUIVER_C_API quiver_error_t quiver_database_read_time_series_group_all(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* group,
+                                                                       int64_t** out_ids,
+                                                                       char*** out_column_names,
+                                                                       int** out_column_types,
+                                                                       void*** out_column_data,
+                                                                       uint8_t*** out_column_has_value,
+                                                                       size_t* out_column_count,
+                                                                       size_t* out_row_count);
+
 // Update time series group - replaces all rows for element with multi-column typed data
 // column_names[]: column names (including dimension column, any order)
 // column_types[]: quiver_data_type_t per column
@@ -397,6 +573,26 @@ QUIVER_C_API quiver_error_t quiver_database_upsert_time_series_row(quiver_databa
                                                                    const void* const* column_data,
                                                                    size_t column_count);
 
+// Bulk write time series rows for many elements at once
+// ids[r]: element id of row r (row_count entries, any order, may repeat)
+// column_names/column_types/column_data/column_has_value: same columnar layout and NULL mask as
+// quiver_database_update_time_series_group; every dimension column is required and may not be masked
+// mode: quiver_time_series_write_mode_t - APPEND fails on an existing (id, dimensions) key,
+// REPLACE_RANGE first deletes each element's rows between its smallest and largest written
+// leading-dimension value, UPSERT overwrites rows that share a key
+// All rows are written in one transaction; on error nothing is written
+QUIVER_C_API quiver_error_t quiver_database_write_time_series(quiver_database_t* db,
+                                                              const char* collection,
+                                                              const char* group,
+                                                              const int64_t* ids,
+                                                              const char* const* column_names,
+                                                              const int* column_types,
+                                                              const void* const* column_data,
+                                                              const uint8_t* const* column_has_value,
+                                                              size_t column_count,
+                                                              size_t row_count,
+                                                              int mode);
+
 // Read time series row - returns one value per element for a specific attribute at a given date_time
 // Uses "last non-null value at or before date_time" lookup semantics
 // out_data_type: attribute's data type (QUIVER_DATA_TYPE_*)
@@ -416,6 +612,22 @@ QUIVER_C_API quiver_error_t quiver_database_read_time_series_row(quiver_database
                                                                  void** out_values,
                                                                  size_t* out_count);
 
+// Read time series rows - quiver_database_read_time_series_row over many timestamps in one call
+// out_values: element-major matrix of out_element_count x date_time_count cells; the cell for element
+// e (read_element_ids order) at date_times[t] is at index e * date_time_count + t. Missing values and
+// freeing follow quiver_database_read_time_series_row, with out_element_count * date_time_count as
+// the array length. NULL out_values when either dimension is zero. Fails for groups with more than
+// one dimension column and for tables without a key or index on (id, date-time dimension)
+QUIVER_C_API quiver_error_t quiver_database_read_time_series_rows(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* group,
+                                                                  const char* attribute,
+                                                                  const char* const* date_times,
+                                                                  size_t date_time_count,
+                                                                  int* out_data_type,
+                                                                  void** out_values,
+                                                                  size_t* out_element_count);
+
 // Free multi-column time series read results
 // Uses column_types to determine deallocation strategy per column; masks are plain uint8_t
 // arrays freed unconditionally. NULL arrays (empty result) and NULL slots (partial failure)
@@ -526,6 +738,58 @@ QUIVER_C_API quiver_error_t quiver_database_query_float_params(quiver_database_t
                                                                double* out_value,
                                                                int* out_has_value);
 
+// Whole-result query - every row and column as typed arrays, in select-list order. Parameters use
+// the *_params encoding. Column types: INTEGER -> int64_t*, FLOAT -> double*, STRING -> char**;
+// each column takes its type from its cells (INTEGER cells widen in a FLOAT column) and the call
+// fails on BLOB cells or a column mixing STRING with numbers. out_column_has_value[c][r] == 0 means
+// SQL NULL (placeholder data: 0, 0.0 or NULL char*). Columns are returned even when out_row_count
+// is 0. Free everything with one quiver_database_free_time_series_data call.
+QUIVER_C_API quiver_error_t quiver_database_query_table(quiver_database_t* db,
+                                                        const char* sql,
+                                                        const int* param_types,
+                                                        const void* const* param_values,
+                                                        size_t param_count,
+                                                        char*** out_column_names,
+                                                        int** out_column_types,
+                                                        void*** out_column_data,
+                                                        uint8_t*** out_column_has_value,
+                                                        size_t* out_column_count,
+                                                        size_t* out_row_count);
+
+// Streaming query cursor - steps a SQL statement one row at a time instead of materializing every
+// row. Parameters use the same (param_types, param_values) encoding as the *_params queries.
+// A cursor borrows its database: close it before quiver_database_close on that database.
+// Typed getters read the current row and follow the query_* typing policy: out_has_value == 0
+// for SQL NULL or a cell of another type, and get_float widens an INTEGER cell.
+// get_string returns a heap string freed with quiver_database_free_string.
+typedef struct quiver_database_cursor quiver_database_cursor_t;
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_open(quiver_database_t* db,
+                                                        const char* sql,
+                                                        const int* param_types,
+                                                        const void* const* param_values,
+                                                        size_t param_count,
+                                                        quiver_database_cursor_t** out_cursor);
+QUIVER_C_API quiver_error_t quiver_database_cursor_next(quiver_database_cursor_t* cursor, int* out_has_row);
+QUIVER_C_API quiver_error_t quiver_database_cursor_column_count(quiver_database_cursor_t* cursor, size_t* out_count);
+// out_name borrows the cursor's storage and stays valid until the cursor is closed.
+QUIVER_C_API quiver_error_t quiver_database_cursor_column_name(quiver_database_cursor_t* cursor,
+                                                               size_t index,
+                                                               const char** out_name);
+QUIVER_C_API quiver_error_t quiver_database_cursor_get_integer(quiver_database_cursor_t* cursor,
+                                                               size_t index,
+                                                               int64_t* out_value,
+                                                               int* out_has_value);
+QUIVER_C_API quiver_error_t quiver_database_cursor_get_float(quiver_database_cursor_t* cursor,
+                                                             size_t index,
+                                                             double* out_value,
+                                                             int* out_has_value);
+QUIVER_C_API quiver_error_t quiver_database_cursor_get_string(quiver_database_cursor_t* cursor,
+                                                              size_t index,
+                                                              char** out_value,
+                                                              int* out_has_value);
+QUIVER_C_API quiver_error_t quiver_database_cursor_close(quiver_database_cursor_t* cursor);
+
 // Schema inspection — human-readable text reports. Each returns a heap string via *out_report,
 // freed with quiver_database_free_string.
 QUIVER_C_API quiver_error_t quiver_database_describe(quiver_database_t* db, char** out_report);
@@ -536,6 +800,24 @@ QUIVER_C_API quiver_error_t quiver_database_summarize_collection(quiver_database
                                                                  const char* collection,
                                                                  char** out_report);
 
+// Index advisor (see Database::missing_indexes). columns is the comma-separated index key.
+typedef struct {
+    char* table;
+    char* columns;
+    char* reason;
+    char* create_sql;
+} quiver_missing_index_t;
+
+// None missing returns a NULL array and a zero count. Free with quiver_database_free_missing_indexes.
+QUIVER_C_API quiver_error_t quiver_database_missing_indexes(quiver_database_t* db,
+                                                            quiver_missing_index_t** out_indexes,
+                                                            size_t* out_count);
+// Creates every missing index and returns the ones created, like quiver_database_missing_indexes.
+QUIVER_C_API quiver_error_t quiver_database_ensure_indexes(quiver_database_t* db,
+                                                           quiver_missing_index_t** out_created,
+                                                           size_t* out_count);
+QUIVER_C_API quiver_error_t quiver_database_free_missing_indexes(quiver_missing_index_t* indexes, size_t count);
+
 #ifdef __cplusplus
 }
 #endif
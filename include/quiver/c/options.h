@@ -15,9 +15,59 @@ typedef enum {
     QUIVER_LOG_OFF = 4,
 } quiver_log_level_t;
 
+// quiver_database.log handling for file-backed databases (see quiver::FileLogMode).
+typedef enum {
+    QUIVER_FILE_LOG_SYNC = 0,
+    QUIVER_FILE_LOG_ASYNC = 1,
+    QUIVER_FILE_LOG_OFF = 2,
+} quiver_file_log_mode_t;
+
+// Connection tuning applied at open time (see quiver::ConnectionProfile). The *_DEFAULT values
+// and 0 sizes leave SQLite's own setting alone.
+typedef enum {
+    QUIVER_JOURNAL_MODE_DEFAULT = 0,
+    QUIVER_JOURNAL_MODE_DELETE = 1,
+    QUIVER_JOURNAL_MODE_WAL = 2,
+    QUIVER_JOURNAL_MODE_MEMORY = 3,
+    QUIVER_JOURNAL_MODE_OFF = 4,
+} quiver_journal_mode_t;
+
+typedef enum {
+    QUIVER_SYNCHRONOUS_DEFAULT = 0,
+    QUIVER_SYNCHRONOUS_OFF = 1,
+    QUIVER_SYNCHRONOUS_NORMAL = 2,
+    QUIVER_SYNCHRONOUS_FULL = 3,
+    QUIVER_SYNCHRONOUS_EXTRA = 4,
+} quiver_synchronous_t;
+
+typedef enum {
+    QUIVER_TEMP_STORE_DEFAULT = 0,
+    QUIVER_TEMP_STORE_FILE = 1,
+    QUIVER_TEMP_STORE_MEMORY = 2,
+} quiver_temp_store_t;
+
+typedef struct {
+    quiver_journal_mode_t journal_mode;
+    quiver_synchronous_t synchronous;
+    quiver_temp_store_t temp_store;
+    int64_t cache_size_kib;  // page cache size in KiB; 0 = SQLite default
+    int64_t mmap_size;       // memory-mapped I/O limit in bytes; 0 = SQLite default (off)
+} quiver_connection_profile_t;
+
+// SQL statement trace (see quiver::SqlTraceOptions). enabled == 0 turns it off.
+typedef struct {
+    int enabled;
+    int64_t slow_threshold_ns;  // 0 = every statement
+    int64_t ring_capacity;      // traced statements kept for quiver_database_traced_statements
+} quiver_sql_trace_options_t;
+
 typedef struct {
     int read_only;
     quiver_log_level_t console_level;
+    quiver_connection_profile_t profile;
+    quiver_sql_trace_options_t trace;
+    quiver_file_log_mode_t file_log;
+    int immutable;  // nonzero: archived, never-written file (see quiver::DatabaseOptions::immutable)
 } quiver_database_options_t;
 
 // CSV options for controlling enum resolution and date formatting.
@@ -50,6 +100,10 @@ typedef struct {
 } quiver_csv_options_t;
 
 QUIVER_C_API quiver_database_options_t quiver_database_options_default(void);
+// Presets, same values as quiver::ConnectionProfile::bulk_load / read_mostly / durable.
+QUIVER_C_API quiver_connection_profile_t quiver_connection_profile_bulk_load(void);
+QUIVER_C_API quiver_connection_profile_t quiver_connection_profile_read_mostly(void);
+QUIVER_C_API quiver_connection_profile_t quiver_connection_profile_durable(void);
 QUIVER_C_API quiver_csv_options_t quiver_csv_options_default(void);
 
 #ifdef __cplusplus
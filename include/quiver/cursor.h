@@ -0,0 +1,59 @@
+#ifndef QUIVER_CURSOR_H
+#define QUIVER_CURSOR_H
+
+#include "export.h"
+#include "value.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace quiver {
+
+// Forward-only view over a running SQL statement, returned by Database::cursor(). Each next()
+// steps the statement once and the typed getters read the current row straight from SQLite, so a
+// read of any size holds one row at a time instead of a fully materialized Result.
+//
+// A cursor borrows its Database's connection: it must not outlive the Database, and it should be
+// destroyed (or stepped to the end) before the transaction it reads in is committed or rolled back.
+class QUIVER_API Cursor {
+public:
+    ~Cursor();
+
+    // Non-copyable
+    Cursor(const Cursor&) = delete;
+    Cursor& operator=(const Cursor&) = delete;
+
+    // Movable
+    Cursor(Cursor&& other) noexcept;
+    Cursor& operator=(Cursor&& other) noexcept;
+
+    // Step to the next row. Returns false once the statement is exhausted (and keeps returning
+    // false); throws on a SQLite error.
+    bool next();
+
+    const std::vector<std::string>& columns() const;
+    size_t column_count() const;
+
+    // Typed access to the current row, with the same typing policy as Row: a SQL NULL (or a cell
+    // of another type) is std::nullopt, and get_float widens an INTEGER cell.
+    bool is_null(size_t index) const;
+    std::optional<int64_t> get_integer(size_t index) const;
+    std::optional<double> get_float(size_t index) const;
+    std::optional<std::string> get_string(size_t index) const;
+
+    // The current cell as a Value (throws for BLOB cells, like every other quiver read).
+    Value get_value(size_t index) const;
+
+private:
+    friend class Database;
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+
+    explicit Cursor(std::unique_ptr<Impl> impl);
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_CURSOR_H
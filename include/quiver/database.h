@@ -3,18 +3,158 @@
 
 #include "export.h"
 #include "quiver/attribute_metadata.h"
+#include "quiver/cursor.h"
 #include "quiver/element.h"
+#include "quiver/index_advisor.h"
 #include "quiver/options.h"
 #include "quiver/result.h"
 
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace quiver {
 
+// Counters for the prepared-statement cache behind every internal query. A hit reuses a statement
+// prepared by an earlier call with the same SQL text; a miss prepares (and then caches) a new one.
+struct StatementCacheStats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    size_t size = 0;
+    size_t capacity = 0;
+};
+
+// Counters for the foreign-key label -> id cache. A hit resolves a label without querying; a miss
+// queries the referenced collection (one label, or the whole collection for import_csv). size is
+// the number of labels currently cached.
+struct LabelCacheStats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    size_t size = 0;
+};
+
+// Timing and I/O of one public Database operation since enable_stats (or the last reset_stats).
+// Latency percentiles cover the most recent kLatencyWindow calls. Work done inside another
+// operation is charged to the outermost one: the statements create_element runs count as
+// create_element, not as execute.
+struct OperationStats {
+    static constexpr size_t kLatencyWindow = 1024;
+
+    std::string operation;
+    int64_t calls = 0;
+    int64_t total_ns = 0;
+    int64_t p50_ns = 0;
+    int64_t p99_ns = 0;
+    int64_t rows_read = 0;            // result rows stepped
+    int64_t rows_written = 0;         // rows inserted, updated or deleted (sqlite3_total_changes)
+    int64_t statements_prepared = 0;  // statement cache misses
+    int64_t statements_reused = 0;    // statement cache hits
+    int64_t bytes_bound = 0;          // parameter payload: 8 per number, the text length per string
+};
+
+// A statement reported by the SQL trace (DatabaseOptions::trace): the SQL with its parameters
+// bound, how long it ran, the rows it returned (or changed, for a write) and the public operation
+// that ran it, empty when it ran outside one.
+struct TracedStatement {
+    std::string sql;
+    int64_t elapsed_ns = 0;
+    int64_t rows = 0;
+    std::string operation;
+};
+
+// One numeric scalar attribute for every element, as contiguous storage: values[i] is meaningful
+// only where valid[i] != 0 (SQL NULL otherwise, with values[i] left as 0). Positionally aligned
+// with read_element_ids, like read_scalar_integers / read_scalar_floats.
+template <typename T>
+struct ScalarColumn {
+    std::vector<T> values;
+    std::vector<uint8_t> valid;
+};
+
+// How write_time_series treats rows already stored for the same elements.
+enum class TimeSeriesWriteMode {
+    // Insert only; a row whose key (id + dimensions) already exists fails the whole write.
+    Append,
+    // Per element, delete stored rows whose leading dimension falls within the [min, max] the
+    // write covers for that element, then insert.
+    ReplaceRange,
+    // Insert, replacing any stored row with the same key (as upsert_time_series_row).
+    Upsert,
+};
+
+// One named column of a columnar result: a typed array with one cell per row, plus an optional
+// validity mask (empty = every cell present; valid[r] == 0 means SQL NULL, with values[r] left
+// default-constructed). Readers always fill the mask.
+struct TypedColumn {
+    std::string name;
+    std::variant<std::vector<int64_t>, std::vector<double>, std::vector<std::string>> values;
+    std::vector<uint8_t> valid;
+};
+
+// One column of bulk time-series data.
+using TimeSeriesColumn = TypedColumn;
+
+// A whole time-series group across elements, column by column: row r belongs to element ids[r].
+// columns holds the dimension column(s) first, then the value columns in declaration order.
+// It is the shape write_time_series takes, so a read can be written back unchanged.
+struct TimeSeriesData {
+    std::vector<int64_t> ids;
+    std::vector<TimeSeriesColumn> columns;
+};
+
+// The whole result of query_table, column by column, in select-list order. Each column takes its
+// type from its cells: INTEGER -> int64_t, REAL -> double (INTEGER cells in a REAL column widen),
+// TEXT -> std::string; an all-NULL column follows its declared type, defaulting to int64_t.
+// valid is always filled, and columns are present even when row_count is 0.
+struct QueryTable {
+    std::vector<TypedColumn> columns;
+    size_t row_count = 0;
+};
+
+// What a committed transaction did to an element (see TableChanges).
+enum class ChangeKind {
+    Created,
+    Updated,
+    Deleted,
+};
+
+// One table's share of a committed transaction, as element ids in ascending order. A collection
+// reports its elements netted over the transaction: created then updated is created, created then
+// deleted is not reported at all. A group table (vector, set or time series) lists under updated
+// every element whose rows in it were written. Deleting an element is reported on its collection
+// only, not on the group tables its rows cascade from.
+struct TableChanges {
+    std::string table;
+    std::string collection;
+    std::vector<int64_t> created;
+    std::vector<int64_t> updated;
+    std::vector<int64_t> deleted;
+};
+
+// Everything one committed transaction changed, ordered by table name. sequence numbers the
+// batches a Database publishes, starting at 1.
+struct ChangeBatch {
+    int64_t sequence = 0;
+    std::vector<TableChanges> tables;
+};
+
+using ChangeCallback = std::function<void(const ChangeBatch&)>;
+
+// What delete_elements / delete_elements_where removed: elements from the collection, and the rows
+// each of its group tables lost with them, by table name (every group table is listed, even at 0).
+// A packed time series group is listed under its time series table name, in decoded rows.
+struct DeleteResult {
+    int64_t elements = 0;
+    std::map<std::string, int64_t> group_rows;
+};
+
 class QUIVER_API Database {
 public:
     explicit Database(const std::string& path, const DatabaseOptions& options = {});
@@ -34,14 +174,54 @@ public:
 
     static Database
     from_schema(const std::string& db_path, const std::string& schema_path, const DatabaseOptions& options = {});
+
+    // Clones the database file at path into a private in-memory connection (SQLite backup API)
+    // and loads its schema, so every later read is served from RAM. The file is only read, and
+    // changes stay in memory until save_to writes them out. options.read_only makes the copy
+    // query-only; path() reports ":memory:".
+    static Database open_in_memory_copy(const std::string& path, const DatabaseOptions& options = {});
+
+    // Writes a consistent snapshot of this database to path: the copy goes to "<path>.tmp" and is
+    // renamed over path once complete, so a failed save never leaves a partial file behind. path
+    // must not be open on another connection. Not allowed inside a transaction.
+    void save_to(const std::string& path);
+
     bool is_healthy() const;
 
+    StatementCacheStats statement_cache_stats() const;
+    LabelCacheStats label_cache_stats() const;
+
+    // Per-operation metrics, off by default. stats() lists every operation called while enabled,
+    // sorted by name; disabling keeps what was collected, reset_stats clears it.
+    void enable_stats(bool enabled = true);
+    bool stats_enabled() const;
+    std::vector<OperationStats> stats() const;
+    void reset_stats();
+
+    // Statements kept by the SQL trace, oldest first; empty when DatabaseOptions::trace is off.
+    std::vector<TracedStatement> traced_statements() const;
+    void clear_traced_statements();
+
     int64_t current_version() const;
 
     // Element operations
     int64_t create_element(const std::string& collection, const Element& element);
+    // Batch create: every element is FK-resolved and validated before the first write, distinct
+    // FK labels are looked up once, and rows go in as multi-row INSERTs. Returns the new ids in
+    // input order. Labels are resolved against rows that exist before the call, so an element
+    // cannot reference another element of the same batch.
+    std::vector<int64_t> create_elements(const std::string& collection, const std::vector<Element>& elements);
     void update_element(const std::string& collection, int64_t id, const Element& element);
     void delete_element(const std::string& collection, int64_t id);
+    // Bulk delete in one statement: the ids are staged in a temp table, checked for existence with
+    // one query (any unknown id throws before anything is deleted, like delete_element), and
+    // removed together, their group rows going with them through the FK cascade. Duplicates count
+    // once. delete_elements_where deletes every element matching predicate, a SQL expression over
+    // the collection's columns whose ? placeholders take parameters.
+    DeleteResult delete_elements(const std::string& collection, std::span<const int64_t> ids);
+    DeleteResult delete_elements_where(const std::string& collection,
+                                       const std::string& predicate,
+                                       const std::vector<Value>& parameters = {});
 
     // Read scalar attributes (all elements). One entry per element, aligned with read_element_ids;
     // a SQL NULL is std::nullopt (positional — never dropped).
@@ -50,6 +230,10 @@ public:
     std::vector<std::optional<double>> read_scalar_floats(const std::string& collection, const std::string& attribute);
     std::vector<std::optional<std::string>> read_scalar_strings(const std::string& collection,
                                                                 const std::string& attribute);
+    // Same reads, written straight into a typed buffer plus validity mask instead of one
+    // std::optional per element - the path for large collections and for the C API.
+    ScalarColumn<int64_t> read_scalar_integers_column(const std::string& collection, const std::string& attribute);
+    ScalarColumn<double> read_scalar_floats_column(const std::string& collection, const std::string& attribute);
 
     // Read scalar attributes (by element ID)
     std::optional<int64_t>
@@ -59,6 +243,17 @@ public:
     std::optional<std::string>
     read_scalar_string_by_id(const std::string& collection, const std::string& attribute, int64_t id);
 
+    // Read scalar attributes (for a list of element IDs) in one statement. Entry i belongs to
+    // ids[i], so duplicates repeat and an unknown id reads as SQL NULL.
+    ScalarColumn<int64_t> read_scalar_integers_by_ids(const std::string& collection,
+                                                      const std::string& attribute,
+                                                      std::span<const int64_t> ids);
+    ScalarColumn<double>
+    read_scalar_floats_by_ids(const std::string& collection, const std::string& attribute, std::span<const int64_t> ids);
+    std::vector<std::optional<std::string>> read_scalar_strings_by_ids(const std::string& collection,
+                                                                       const std::string& attribute,
+                                                                       std::span<const int64_t> ids);
+
     // Read vector attributes (all elements)
     std::vector<std::vector<int64_t>> read_vector_integers(const std::string& collection, const std::string& attribute);
     std::vector<std::vector<double>> read_vector_floats(const std::string& collection, const std::string& attribute);
@@ -134,14 +329,30 @@ public:
     std::vector<std::map<std::string, Value>>
     read_time_series_group(const std::string& collection, const std::string& group, int64_t id);
 
+    // Read time series group for every element in one ordered scan (by id, then dimension columns).
+    // Integer columns come back as int64_t, REAL as double, TEXT and DATE_TIME as strings.
+    TimeSeriesData read_time_series_group_all(const std::string& collection, const std::string& group);
+
     // Read time series row - returns one value per element for a specific attribute at a given date_time
     // Uses "last non-null value at or before date_time" lookup semantics
     // Returns nullptr Value for elements with no matching data
+    // Throws for groups with more than one dimension column (e.g. date_time and block), where a
+    // timestamp names several rows
     std::vector<Value> read_time_series_row(const std::string& collection,
                                             const std::string& group,
                                             const std::string& attribute,
                                             const std::string& date_time);
 
+    // As-of lookup over many timestamps at once: result[e][t] is what read_time_series_row would
+    // return for element e (in read_element_ids order) at date_times[t]. Timestamps may come in any
+    // order. Each element's rows are scanned once through the (id, dimension) key and carried
+    // forward, instead of one grouped self-join per timestamp. Throws when that key or an index
+    // on it is missing (see ensure_indexes) or the group has more than one dimension column.
+    std::vector<std::vector<Value>> read_time_series_rows(const std::string& collection,
+                                                          const std::string& group,
+                                                          const std::string& attribute,
+                                                          const std::vector<std::string>& date_times);
+
     // Update time series group - replaces all rows for element
     void update_time_series_group(const std::string& collection,
                                   const std::string& group,
@@ -159,6 +370,16 @@ public:
                                 int64_t id,
                                 const std::map<std::string, Value>& row);
 
+    // Bulk time-series write for many elements at once, columnar: row r belongs to element ids[r],
+    // and every column carries ids.size() cells. Columns must include every dimension column of the
+    // group. Shapes, element ids and column types are checked once, before the first write; rows go
+    // in as multi-row INSERTs inside one transaction. Errors are "Cannot write_time_series: ...".
+    void write_time_series(const std::string& collection,
+                           const std::string& group,
+                           const std::vector<int64_t>& ids,
+                           const std::vector<TimeSeriesColumn>& columns,
+                           TimeSeriesWriteMode mode = TimeSeriesWriteMode::Append);
+
     // Time series files - singleton table storing file paths for external time series data
     bool has_time_series_files(const std::string& collection) const;
     std::vector<std::string> list_time_series_files_columns(const std::string& collection) const;
@@ -177,6 +398,12 @@ public:
     // integer value distributions, per-group empty/non-empty counts).
     std::string summarize_collection(const std::string& collection) const;
 
+    // Indexes the schema lacks for the lookups Quiver issues (see IndexAdvisor); each one is also
+    // logged at debug level when the schema is loaded. ensure_indexes creates them all in one
+    // transaction and returns the ones it created.
+    std::vector<MissingIndex> missing_indexes() const;
+    std::vector<MissingIndex> ensure_indexes();
+
     // CSV operations
     void export_csv(const std::string& collection,
                     const std::string& group,
@@ -192,6 +419,14 @@ public:
     std::optional<int64_t> query_integer(const std::string& sql, const std::vector<Value>& parameters = {});
     std::optional<double> query_float(const std::string& sql, const std::vector<Value>& parameters = {});
 
+    // Query returning every row and column as typed arrays (see QueryTable). Throws on a BLOB cell
+    // or a column mixing TEXT with numbers.
+    QueryTable query_table(const std::string& sql, const std::vector<Value>& parameters = {});
+
+    // Streaming query - steps the statement row by row instead of materializing every row up front.
+    // The cursor must not outlive this Database (see cursor.h).
+    Cursor cursor(const std::string& sql, const std::vector<Value>& parameters = {});
+
     // Transaction control
     void begin_transaction();
     void commit();
@@ -207,15 +442,49 @@ public:
     void end_dry_run();
     bool in_dry_run() const;
 
+    // Change feed - every committed transaction that changes elements is published as one
+    // ChangeBatch once the commit has returned. A subscription with a callback receives each batch
+    // as it is published (the callback may use this Database); one without queues them until
+    // poll_changes takes them. Rolled-back transactions, and so every dry run, publish nothing.
+    // Recording starts with the first subscription. Collection rows are seen through SQLite's
+    // update hook, so raw SQL through cursor or query_* is published for them too; group rows are
+    // recorded by the group writers of this class, so group-table writes made through cursor or
+    // query_* are not published. SQLite fires no update hook for a WITHOUT ROWID table: a
+    // collection declared that way publishes nothing for its own rows. A ROLLBACK TO a savepoint run through query_* drops
+    // the changes made since that savepoint; savepoints opened any other way are not followed.
+    int64_t subscribe_changes(ChangeCallback callback = {});
+    void unsubscribe_changes(int64_t subscription);
+    std::vector<ChangeBatch> poll_changes(int64_t subscription);
+
 private:
+    // Shares one loaded schema across its reader connections.
+    friend class DatabasePool;
+
     struct Impl;
     std::unique_ptr<Impl> impl_;
 
+    // Opens path; with schema_source, adopts its loaded schema instead of reading one (pool readers).
+    Database(const std::string& path, const DatabaseOptions& options, const Database* schema_source);
+
     // Internal helper for executing raw SQL (for migrations)
     void execute_raw(const std::string& sql);
 
     // Internal method for parameterized queries
     Result execute(const std::string& sql, const std::vector<Value>& parameters = {});
+    // Same, over any contiguous run of parameters (e.g. one chunk of a batch) without copying it.
+    Result execute(const std::string& sql, std::span<const Value> parameters);
+
+    // Prepare (or reuse) a statement and bind parameters. With borrow_text, string parameters are
+    // bound in place, so they must outlive the returned cursor; otherwise SQLite copies them.
+    Cursor prepare_cursor(const std::string& sql, std::span<const Value> parameters, bool borrow_text);
+
+    // Behind read_scalar_* and read_scalar_*_column: the collection's attribute in rowid order,
+    // checked and tracked as `operation`. Column is std::vector<std::optional<T>> or ScalarColumn<T>.
+    template <typename Column>
+    Column read_scalar_column(const char* operation, const std::string& collection, const std::string& attribute);
+
+    // Deletes the elements staged in the delete_elements temp table and empties it
+    DeleteResult delete_staged_elements(const std::string& collection);
 
     // Internal methods
     void set_version(int64_t version);
@@ -223,6 +492,13 @@ private:
     void apply_schema(const std::string& schema_path);
 };
 
+// Array parameter for query_* / cursor: the values as one JSON array, so a single placeholder
+// expands through SQLite's json_each table-valued function, e.g.
+//   WHERE id IN (SELECT value FROM json_each(?))
+// or, keeping the array's order, FROM json_each(?) AS ids JOIN T ON T.id = ids.value ORDER BY ids.key
+QUIVER_API Value array_parameter(std::span<const int64_t> values);
+QUIVER_API Value array_parameter(std::span<const double> values);
+
 }  // namespace quiver
 
 #endif  // QUIVER_DATABASE_H
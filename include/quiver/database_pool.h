@@ -0,0 +1,80 @@
+#ifndef QUIVER_DATABASE_POOL_H
+#define QUIVER_DATABASE_POOL_H
+
+#include "export.h"
+#include "quiver/database.h"
+#include "quiver/options.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace quiver {
+
+// A fixed set of read-only connections to one database file, for reading from several threads at
+// once. The schema is loaded and validated once, and every reader shares that snapshot instead of
+// loading its own. A schema change made through another connection after the pool opens is not
+// picked up; open a new pool for that.
+//
+// Unless options.read_only is set, the pool first switches the file to WAL (a persistent setting)
+// through a short-lived writable connection, so a writer elsewhere does not block the readers.
+// With options.immutable the file is left as it is and every reader opens it immutable, which
+// suits an archived database that nothing writes anymore.
+// options.profile applies to every reader; its journal_mode is ignored, since readers cannot change it.
+//
+// Each reader is used by one thread at a time: acquire() hands one out as a Lease, which returns it
+// to the pool when destroyed. A Lease must not outlive its pool.
+class QUIVER_API DatabasePool {
+public:
+    class QUIVER_API Lease {
+    public:
+        ~Lease();
+
+        // Non-copyable
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        // Movable
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+
+        Database& operator*() const { return *reader_; }
+        Database* operator->() const { return reader_; }
+
+    private:
+        friend class DatabasePool;
+        Lease(DatabasePool* pool, Database* reader) : pool_(pool), reader_(reader) {}
+
+        DatabasePool* pool_ = nullptr;
+        Database* reader_ = nullptr;
+    };
+
+    DatabasePool(const std::string& path, size_t readers, const DatabaseOptions& options = {});
+    ~DatabasePool();
+
+    // Non-copyable, non-movable: outstanding leases point back at the pool
+    DatabasePool(const DatabasePool&) = delete;
+    DatabasePool& operator=(const DatabasePool&) = delete;
+    DatabasePool(DatabasePool&&) = delete;
+    DatabasePool& operator=(DatabasePool&&) = delete;
+
+    // Borrow a reader, blocking until one is free.
+    Lease acquire();
+    // Borrow a reader if one is free right now.
+    std::optional<Lease> try_acquire();
+
+    size_t size() const;
+    size_t available() const;
+
+    const std::string& path() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+
+    void release(Database* reader);
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_DATABASE_POOL_H
@@ -0,0 +1,48 @@
+#ifndef QUIVER_INDEX_ADVISOR_H
+#define QUIVER_INDEX_ADVISOR_H
+
+#include "export.h"
+#include "schema.h"
+
+#include <string>
+#include <vector>
+
+namespace quiver {
+
+// An index a Quiver access path relies on that the schema does not declare. columns is the
+// required leading key: any index (or the rowid primary key) whose columns start with it serves.
+struct MissingIndex {
+    std::string table;
+    std::vector<std::string> columns;
+    std::string reason;
+
+    // Deterministic index name: idx_<table>_<column>[_<column>...]
+    std::string index_name() const;
+    // CREATE INDEX IF NOT EXISTS statement for this index
+    std::string create_sql() const;
+};
+
+// Checks a schema against the lookups Quiver issues:
+// - Collections: label (label -> id resolution)
+// - Vector tables: (id, vector_index) (read_vector_* orders by it)
+// - Set tables: id (set reads filter by it)
+// - Time series tables: (id, <dimension>) (reads filter by id and order by the dimension)
+// - Every foreign-key column other than a group table's id: deleting or relabelling the
+//   referenced element looks up its referencing rows through it
+// Packed time series groups are skipped; their row table holds no rows.
+class QUIVER_API IndexAdvisor {
+public:
+    explicit IndexAdvisor(const Schema& schema);
+
+    // Ordered by table, then in the order listed above.
+    std::vector<MissingIndex> missing_indexes() const;
+
+private:
+    const Schema& schema_;
+
+    void check_table(const TableDefinition& table, std::vector<MissingIndex>& missing) const;
+};
+
+}  // namespace quiver
+
+#endif  // QUIVER_INDEX_ADVISOR_H
@@ -3,6 +3,7 @@
 
 #include "export.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <unordered_map>
@@ -17,9 +18,81 @@ enum class LogLevel {
     Off = 4,
 };
 
+// Where a file-backed database's quiver_database.log (next to the database file) is written from.
+// Sync writes each line on the calling thread. Async hands lines to a shared background thread
+// through a bounded ring; if writers outpace it, the oldest pending lines are dropped rather than
+// blocking. Off keeps no log file, so only the console level decides what is formatted at all.
+enum class FileLogMode {
+    Sync = 0,
+    Async = 1,
+    Off = 2,
+};
+
+// Connection tuning applied with PRAGMAs when a database is opened. Every field defaults to
+// "leave SQLite's setting alone", so a default profile issues no PRAGMA at all.
+enum class JournalMode {
+    Default = 0,
+    Delete = 1,
+    Wal = 2,
+    Memory = 3,
+    Off = 4,
+};
+
+enum class Synchronous {
+    Default = 0,
+    Off = 1,
+    Normal = 2,
+    Full = 3,
+    Extra = 4,
+};
+
+enum class TempStore {
+    Default = 0,
+    File = 1,
+    Memory = 2,
+};
+
+struct QUIVER_API ConnectionProfile {
+    JournalMode journal_mode = JournalMode::Default;
+    Synchronous synchronous = Synchronous::Default;
+    TempStore temp_store = TempStore::Default;
+    int64_t cache_size_kib = 0;  // page cache size in KiB; 0 = SQLite default
+    int64_t mmap_size = 0;       // memory-mapped I/O limit in bytes; 0 = SQLite default (off)
+
+    // Presets:
+    // bulk_load   - WAL, synchronous OFF, 256 MiB cache, temp tables in memory. Fastest writes;
+    //               an OS crash or power loss mid-load can corrupt the file, so rebuild it from
+    //               source if that happens.
+    // read_mostly - WAL, synchronous NORMAL, 64 MiB cache, 1 GiB mmap, temp tables in memory.
+    // durable     - WAL, synchronous FULL: every commit is on disk before it returns.
+    static ConnectionProfile bulk_load();
+    static ConnectionProfile read_mostly();
+    static ConnectionProfile durable();
+};
+
+// SQL statement trace (sqlite3_trace_v2, SQLITE_TRACE_PROFILE). Off by default. When enabled,
+// every statement that runs for at least slow_threshold_ns is logged at info level with its
+// expanded SQL, elapsed time, row count and the Database method that ran it, and kept in a
+// ring of the last ring_capacity entries (Database::traced_statements).
+struct QUIVER_API SqlTraceOptions {
+    bool enabled = false;
+    int64_t slow_threshold_ns = 0;  // 0 = every statement
+    size_t ring_capacity = 256;
+};
+
+// immutable opens an archived database that nothing will ever write again (implies read_only):
+// SQLite skips file locking and change detection (URI immutable=1), the whole file is
+// memory-mapped unless profile.mmap_size says otherwise, and the schema is loaded once at open.
+// Every write API throws before touching the file, and the Database may be used from several
+// threads at once; its calls are serialized on the one connection (use a DatabasePool with
+// immutable readers to read in parallel). Changing the file while it is open is undefined.
 struct QUIVER_API DatabaseOptions {
     bool read_only = false;
     LogLevel console_level = LogLevel::Info;
+    ConnectionProfile profile = {};
+    SqlTraceOptions trace = {};
+    FileLogMode file_log = FileLogMode::Sync;
+    bool immutable = false;
 };
 
 struct QUIVER_API CSVOptions {
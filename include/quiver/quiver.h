@@ -5,6 +5,7 @@
 #include "binary/binary_metadata.h"
 #include "binary/csv_converter.h"
 #include "database.h"
+#include "database_pool.h"
 #include "element.h"
 #include "export.h"
 
@@ -7,6 +7,7 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct sqlite3;
@@ -54,6 +55,21 @@ public:
     // Factory: loads schema from database
     static Schema from_database(sqlite3* db);
 
+    // Hash of every table, index, view and trigger definition in db, as 16 hex digits. It changes
+    // whenever the schema does, so a Database can tell that a schema it already validated is
+    // unchanged (see kFingerprintTable).
+    static std::string fingerprint(sqlite3* db);
+
+    // Table in which a Database records the fingerprint of the schema it last validated. It is not
+    // part of the schema: from_database and fingerprint leave it out.
+    static constexpr const char* kFingerprintTable = "quiver_schema_fingerprint";
+
+    // Copies rebuild the lookup index (it points into tables_); moves keep it.
+    Schema(const Schema& other);
+    Schema& operator=(const Schema& other);
+    Schema(Schema&& other) noexcept = default;
+    Schema& operator=(Schema&& other) noexcept = default;
+
     // Table lookup
     const TableDefinition* get_table(const std::string& name) const;
     bool has_table(const std::string& name) const;
@@ -66,6 +82,7 @@ public:
     static std::string set_table_name(const std::string& collection, const std::string& group);
     static std::string time_series_table_name(const std::string& collection, const std::string& group);
     static std::string time_series_files_table_name(const std::string& collection);
+    static std::string packed_time_series_table_name(const std::string& collection, const std::string& group);
 
     // Table classification
     bool is_collection(const std::string& table) const;
@@ -73,6 +90,7 @@ public:
     bool is_set_table(const std::string& table) const;
     bool is_time_series_table(const std::string& table) const;
     bool is_time_series_files_table(const std::string& table) const;
+    bool is_packed_time_series_table(const std::string& table) const;
     std::string get_parent_collection(const std::string& table) const;
     std::string get_time_series_files_parent_collection(const std::string& table) const;
 
@@ -82,29 +100,52 @@ public:
     std::string find_time_series_table(const std::string& collection, const std::string& group) const;
     std::string find_time_series_files_table(const std::string& collection) const;
 
-    // Find which group tables contain a given column (for routing in create_element/update_element)
+    // Find which group tables contain a given column (for routing in create_element/update_element).
+    // The Collection_vector_<column> table comes first when it exists, then the others by name.
     struct TableMatch {
         std::string table_name;
         GroupTableType type;
     };
-    std::vector<TableMatch> find_all_tables_for_column(const std::string& collection, const std::string& column) const;
+    const std::vector<TableMatch>& find_all_tables_for_column(const std::string& collection,
+                                                              const std::string& column) const;
 
     // Group names of a given type belonging to a collection (e.g. "values" for "Items_vector_values")
     bool is_group_table(const std::string& table, GroupTableType type) const;
-    std::vector<std::string> group_names(const std::string& collection, GroupTableType type) const;
+    const std::vector<std::string>& group_names(const std::string& collection, GroupTableType type) const;
 
     // All tables/collections
     std::vector<std::string> table_names() const;
     std::vector<std::string> collection_names() const;
 
+    // Packed time series storage. A group opts in by declaring Collection_time_series_<group>_packed,
+    // with columns id, chunk, start, step, count and data, next to its Collection_time_series_<group>
+    // table; any other table so named is an ordinary group. The time series table still declares the
+    // group's columns and types but holds no rows. Packed tables hold BLOB chunks, so they are kept
+    // out of get_table()/table_names() and listed here with their column names.
+    bool is_packed_time_series_group(const std::string& collection, const std::string& group) const;
+    const std::map<std::string, std::vector<std::string>>& packed_time_series_tables() const {
+        return packed_tables_;
+    }
+
 private:
     Schema() = default;
     std::map<std::string, TableDefinition> tables_;
+    std::map<std::string, std::vector<std::string>> packed_tables_;
+
+    // Derived from tables_ by build_index() once loading is done, so table lookups, group listings
+    // and column routing are hash lookups rather than scans over every table in the schema.
+    struct CollectionIndex {
+        std::vector<std::string> vector_groups;
+        std::vector<std::string> set_groups;
+        std::vector<std::string> time_series_groups;
+        // column -> the group tables holding it, in find_all_tables_for_column order
+        std::unordered_map<std::string, std::vector<TableMatch>> column_tables;
+    };
+    std::unordered_map<std::string, const TableDefinition*> table_index_;
+    std::unordered_map<std::string, CollectionIndex> collection_index_;
 
+    void build_index();
     void load_from_database(sqlite3* db);
-    static std::vector<ColumnDefinition> query_columns(sqlite3* db, const std::string& table);
-    static std::vector<ForeignKey> query_foreign_keys(sqlite3* db, const std::string& table);
-    static std::vector<Index> query_indexes(sqlite3* db, const std::string& table);
 };
 
 }  // namespace quiver
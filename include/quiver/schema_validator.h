@@ -19,6 +19,10 @@ class QUIVER_API SchemaValidator {
 public:
     explicit SchemaValidator(const Schema& schema);
 
+    // Bumped whenever the rules below change, so schemas validated under older rules (see
+    // Schema::kFingerprintTable) are validated again.
+    static constexpr int kRevision = 1;
+
     // Throws std::runtime_error on validation failure
     void validate();
 
@@ -33,6 +37,7 @@ private:
     void validate_vector_table(const std::string& name);
     void validate_set_table(const std::string& name);
     void validate_time_series_files_table(const std::string& name);
+    void validate_packed_time_series_table(const std::string& name);
     void validate_no_duplicate_attributes();
     void validate_foreign_keys();
 
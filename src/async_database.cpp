@@ -0,0 +1,252 @@
+#include "quiver/async_database.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace quiver {
+
+namespace {
+
+std::function<std::function<void()>(Database&)> callback_operation(std::function<void(Database&)> fn,
+                                                                   std::function<void(std::exception_ptr)> done) {
+    return [fn = std::move(fn), done = std::move(done)](Database& db) -> std::function<void()> {
+        fn(db);
+        return [done] { done(nullptr); };
+    };
+}
+
+}  // namespace
+
+struct AsyncDatabase::Impl {
+    struct Task {
+        Operation operation;
+        Failure failure;
+        bool write = false;
+    };
+
+    Database db;
+    AsyncDatabaseOptions options;
+    std::mutex mutex;
+    std::condition_variable queued;
+    // Tasks not yet taken by the worker, and whether the destructor is waiting on it; guarded by mutex.
+    std::deque<Task> tasks;
+    bool stopping = false;
+    std::thread worker;
+
+    Impl(Database database, const AsyncDatabaseOptions& async_options)
+        : db(std::move(database)), options(async_options) {}
+
+    void run();
+    void run_alone(Task& task);
+    void run_batch(Task first);
+    std::optional<Task> next_write(std::chrono::steady_clock::time_point deadline);
+};
+
+void AsyncDatabase::Impl::run() {
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock lock(mutex);
+            queued.wait(lock, [this] { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;  // stopping, and everything queued has run
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        if (task.write && options.max_batch_writes > 1 && !db.in_transaction()) {
+            run_batch(std::move(task));
+        } else {
+            run_alone(task);
+        }
+    }
+}
+
+void AsyncDatabase::Impl::run_alone(Task& task) {
+    try {
+        const auto resolve = task.operation(db);
+        resolve();
+    } catch (...) {
+        task.failure(std::current_exception());
+    }
+}
+
+// The next queued task if it is a write, waiting until deadline for one to arrive.
+std::optional<AsyncDatabase::Impl::Task>
+AsyncDatabase::Impl::next_write(std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock lock(mutex);
+    queued.wait_until(lock, deadline, [this] { return stopping || !tasks.empty(); });
+    if (tasks.empty() || !tasks.front().write) {
+        return std::nullopt;
+    }
+    auto task = std::move(tasks.front());
+    tasks.pop_front();
+    return task;
+}
+
+void AsyncDatabase::Impl::run_batch(Task first) {
+    std::vector<Task> batch;
+    batch.push_back(std::move(first));
+    try {
+        db.begin_transaction();
+    } catch (...) {
+        run_alone(batch.front());
+        return;
+    }
+
+    // Each write runs inside its own savepoint, so one that throws is undone on its own and the
+    // rest of the batch carries on. A write that failed has no resolve and its error in errors.
+    const auto deadline = std::chrono::steady_clock::now() + options.max_batch_delay;
+    std::vector<std::function<void()>> resolves;
+    std::vector<std::exception_ptr> errors;
+    std::exception_ptr batch_error;
+    for (;;) {
+        std::function<void()> resolve;
+        std::exception_ptr error;
+        try {
+            db.query_integer("SAVEPOINT quiver_async_write");
+            resolve = batch.back().operation(db);
+            db.query_integer("RELEASE quiver_async_write");
+        } catch (...) {
+            resolve = nullptr;
+            error = std::current_exception();
+            try {
+                db.query_integer("ROLLBACK TO quiver_async_write");
+                db.query_integer("RELEASE quiver_async_write");
+            } catch (...) {
+                // SQLite already rolled the whole transaction back (e.g. a full disk)
+                batch_error = error;
+            }
+        }
+        resolves.push_back(std::move(resolve));
+        errors.push_back(error);
+        if (batch_error) {
+            break;
+        }
+        if (batch.size() >= options.max_batch_writes) {
+            break;
+        }
+        auto next = next_write(deadline);
+        if (!next) {
+            break;
+        }
+        batch.push_back(std::move(*next));
+    }
+
+    if (!batch_error) {
+        try {
+            db.commit();
+        } catch (...) {
+            batch_error = std::current_exception();
+        }
+    }
+    if (batch_error && db.in_transaction()) {
+        try {
+            db.rollback();
+        } catch (...) {
+            // Nothing left to undo
+        }
+    }
+    for (size_t i = 0; i < resolves.size(); ++i) {
+        if (errors[i]) {
+            batch[i].failure(errors[i]);
+        } else if (batch_error) {
+            batch[i].failure(batch_error);
+        } else {
+            resolves[i]();
+        }
+    }
+}
+
+AsyncDatabase::AsyncDatabase(Database database, const AsyncDatabaseOptions& options)
+    : impl_(std::make_unique<Impl>(std::move(database), options)) {
+    impl_->worker = std::thread([impl = impl_.get()] { impl->run(); });
+}
+
+AsyncDatabase::AsyncDatabase(const std::string& path,
+                             const DatabaseOptions& db_options,
+                             const AsyncDatabaseOptions& options)
+    : AsyncDatabase(Database(path, db_options), options) {}
+
+AsyncDatabase::~AsyncDatabase() {
+    {
+        std::lock_guard lock(impl_->mutex);
+        impl_->stopping = true;
+    }
+    impl_->queued.notify_one();
+    impl_->worker.join();
+}
+
+void AsyncDatabase::enqueue(Operation operation, Failure failure, bool write) {
+    {
+        std::lock_guard lock(impl_->mutex);
+        impl_->tasks.push_back({std::move(operation), std::move(failure), write});
+    }
+    impl_->queued.notify_one();
+}
+
+void AsyncDatabase::submit(std::function<void(Database&)> fn, std::function<void(std::exception_ptr)> done) {
+    enqueue(callback_operation(std::move(fn), done), done, false);
+}
+
+void AsyncDatabase::submit_write(std::function<void(Database&)> fn, std::function<void(std::exception_ptr)> done) {
+    enqueue(callback_operation(std::move(fn), done), done, true);
+}
+
+std::future<int64_t> AsyncDatabase::create_element(const std::string& collection, const Element& element) {
+    return submit_write([collection, element](Database& db) { return db.create_element(collection, element); });
+}
+
+std::future<void> AsyncDatabase::update_element(const std::string& collection, int64_t id, const Element& element) {
+    return submit_write(
+        [collection, id, element](Database& db) { db.update_element(collection, id, element); });
+}
+
+std::future<void> AsyncDatabase::delete_element(const std::string& collection, int64_t id) {
+    return submit_write([collection, id](Database& db) { db.delete_element(collection, id); });
+}
+
+std::future<void> AsyncDatabase::import_csv(const std::string& collection,
+                                            const std::string& group,
+                                            const std::string& path,
+                                            const CSVOptions& options) {
+    // Not submit_write: import_csv manages its own transaction, so it cannot share a batch.
+    return submit(
+        [collection, group, path, options](Database& db) { db.import_csv(collection, group, path, options); });
+}
+
+std::future<std::vector<int64_t>> AsyncDatabase::read_element_ids(const std::string& collection) {
+    return submit([collection](Database& db) { return db.read_element_ids(collection); });
+}
+
+std::future<std::vector<std::optional<int64_t>>> AsyncDatabase::read_scalar_integers(const std::string& collection,
+                                                                                     const std::string& attribute) {
+    return submit([collection, attribute](Database& db) { return db.read_scalar_integers(collection, attribute); });
+}
+
+std::future<std::vector<std::optional<double>>> AsyncDatabase::read_scalar_floats(const std::string& collection,
+                                                                                  const std::string& attribute) {
+    return submit([collection, attribute](Database& db) { return db.read_scalar_floats(collection, attribute); });
+}
+
+std::future<std::vector<std::optional<std::string>>>
+AsyncDatabase::read_scalar_strings(const std::string& collection, const std::string& attribute) {
+    return submit([collection, attribute](Database& db) { return db.read_scalar_strings(collection, attribute); });
+}
+
+std::future<void> AsyncDatabase::export_csv(const std::string& collection,
+                                            const std::string& group,
+                                            const std::string& path,
+                                            const CSVOptions& options) {
+    return submit(
+        [collection, group, path, options](Database& db) { db.export_csv(collection, group, path, options); });
+}
+
+std::future<void> AsyncDatabase::flush() {
+    return submit([](Database&) {});
+}
+
+}  // namespace quiver
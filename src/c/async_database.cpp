@@ -0,0 +1,267 @@
+#include "quiver/c/async_database.h"
+
+#include "database_options.h"
+#include "internal.h"
+#include "quiver/async_database.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct quiver_async_database {
+    quiver::AsyncDatabase db;
+    quiver_async_database(const std::string& path,
+                          const quiver::DatabaseOptions& options,
+                          const quiver::AsyncDatabaseOptions& async_options)
+        : db(path, options, async_options) {}
+};
+
+namespace {
+
+std::string describe(const std::exception_ptr& error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const std::bad_alloc&) {
+        return "Memory allocation failed";
+    } catch (const std::exception& e) {
+        return e.what();
+    } catch (...) {
+        return "Unknown error";
+    }
+}
+
+// Adapts a C completion callback to AsyncDatabase's done(std::exception_ptr).
+std::function<void(std::exception_ptr)> completion(quiver_async_callback_t callback, void* user_data) {
+    return [callback, user_data](std::exception_ptr error) {
+        if (!callback) {
+            return;
+        }
+        if (!error) {
+            callback(user_data, QUIVER_OK, nullptr);
+            return;
+        }
+        const auto message = describe(error);
+        callback(user_data, QUIVER_ERROR, message.c_str());
+    };
+}
+
+quiver::AsyncDatabaseOptions convert_async_options(const quiver_async_database_options_t& c_opts) {
+    if (c_opts.max_batch_delay_us < 0) {
+        throw std::runtime_error("Cannot open async database: max_batch_delay_us must not be negative");
+    }
+    return {
+        .max_batch_writes = c_opts.max_batch_writes,
+        .max_batch_delay = std::chrono::microseconds(c_opts.max_batch_delay_us),
+    };
+}
+
+}  // namespace
+
+extern "C" {
+
+QUIVER_C_API quiver_async_database_options_t quiver_async_database_options_default(void) {
+    const quiver::AsyncDatabaseOptions defaults;
+    return {defaults.max_batch_writes, static_cast<int64_t>(defaults.max_batch_delay.count())};
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_open(const char* path,
+                                                       const quiver_database_options_t* options,
+                                                       const quiver_async_database_options_t* async_options,
+                                                       quiver_async_database_t** out_db) {
+    QUIVER_REQUIRE(path, out_db);
+
+    try {
+        const auto cpp_options = options ? convert_database_options(*options) : quiver::DatabaseOptions{};
+        const auto cpp_async_options =
+            async_options ? convert_async_options(*async_options) : quiver::AsyncDatabaseOptions{};
+        *out_db = new quiver_async_database(path, cpp_options, cpp_async_options);
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_close(quiver_async_database_t* db) {
+    delete db;
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_create_element(quiver_async_database_t* db,
+                                                                 const char* collection,
+                                                                 const quiver_element_t* element,
+                                                                 quiver_async_id_callback_t callback,
+                                                                 void* user_data) {
+    QUIVER_REQUIRE(db, collection, element);
+
+    try {
+        auto id = std::make_shared<int64_t>(0);
+        db->db.submit_write(
+            [collection = std::string(collection), element = element->element, id](quiver::Database& database) {
+                *id = database.create_element(collection, element);
+            },
+            [callback, user_data, id](std::exception_ptr error) {
+                if (!callback) {
+                    return;
+                }
+                if (!error) {
+                    callback(user_data, QUIVER_OK, *id, nullptr);
+                    return;
+                }
+                const auto message = describe(error);
+                callback(user_data, QUIVER_ERROR, 0, message.c_str());
+            });
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_update_element(quiver_async_database_t* db,
+                                                                 const char* collection,
+                                                                 int64_t id,
+                                                                 const quiver_element_t* element,
+                                                                 quiver_async_callback_t callback,
+                                                                 void* user_data) {
+    QUIVER_REQUIRE(db, collection, element);
+
+    try {
+        db->db.submit_write(
+            [collection = std::string(collection), id, element = element->element](quiver::Database& database) {
+                database.update_element(collection, id, element);
+            },
+            completion(callback, user_data));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_delete_element(quiver_async_database_t* db,
+                                                                 const char* collection,
+                                                                 int64_t id,
+                                                                 quiver_async_callback_t callback,
+                                                                 void* user_data) {
+    QUIVER_REQUIRE(db, collection);
+
+    try {
+        db->db.submit_write([collection = std::string(collection),
+                             id](quiver::Database& database) { database.delete_element(collection, id); },
+                            completion(callback, user_data));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_import_csv(quiver_async_database_t* db,
+                                                             const char* collection,
+                                                             const char* group,
+                                                             const char* path,
+                                                             const quiver_csv_options_t* options,
+                                                             quiver_async_callback_t callback,
+                                                             void* user_data) {
+    QUIVER_REQUIRE(db, collection, group, path);
+
+    try {
+        // NULL options means defaults, same convention as quiver_database_import_csv
+        auto cpp_options = options ? convert_csv_options(options) : quiver::default_csv_options();
+        // import_csv manages its own transaction, so it cannot share a batch with other writes
+        db->db.submit(
+            [collection = std::string(collection),
+             group = std::string(group),
+             path = std::string(path),
+             cpp_options](quiver::Database& database) { database.import_csv(collection, group, path, cpp_options); },
+            completion(callback, user_data));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_read_element_ids(quiver_async_database_t* db,
+                                                                   const char* collection,
+                                                                   quiver_async_ids_callback_t callback,
+                                                                   void* user_data) {
+    QUIVER_REQUIRE(db, collection);
+
+    try {
+        auto ids = std::make_shared<std::vector<int64_t>>();
+        db->db.submit(
+            [collection = std::string(collection), ids](quiver::Database& database) {
+                *ids = database.read_element_ids(collection);
+            },
+            [callback, user_data, ids](std::exception_ptr error) {
+                if (!callback) {
+                    return;
+                }
+                if (!error) {
+                    callback(user_data, QUIVER_OK, ids->empty() ? nullptr : ids->data(), ids->size(), nullptr);
+                    return;
+                }
+                const auto message = describe(error);
+                callback(user_data, QUIVER_ERROR, nullptr, 0, message.c_str());
+            });
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_export_csv(quiver_async_database_t* db,
+                                                             const char* collection,
+                                                             const char* group,
+                                                             const char* path,
+                                                             const quiver_csv_options_t* options,
+                                                             quiver_async_callback_t callback,
+                                                             void* user_data) {
+    QUIVER_REQUIRE(db, collection, group, path);
+
+    try {
+        auto cpp_options = options ? convert_csv_options(options) : quiver::default_csv_options();
+        db->db.submit(
+            [collection = std::string(collection),
+             group = std::string(group),
+             path = std::string(path),
+             cpp_options](quiver::Database& database) { database.export_csv(collection, group, path, cpp_options); },
+            completion(callback, user_data));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_async_database_flush(quiver_async_database_t* db,
+                                                        quiver_async_callback_t callback,
+                                                        void* user_data) {
+    QUIVER_REQUIRE(db);
+
+    try {
+        db->db.submit([](quiver::Database&) {}, completion(callback, user_data));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    }
+}
+
+}  // extern "C"
@@ -6,6 +6,41 @@
 
 #include <new>
 #include <string>
+#include <vector>
+
+namespace {
+
+void convert_missing_indexes(const std::vector<quiver::MissingIndex>& indexes,
+                             quiver_missing_index_t** out_indexes,
+                             size_t* out_count) {
+    *out_count = indexes.size();
+    if (indexes.empty()) {
+        *out_indexes = nullptr;
+        return;
+    }
+    // Value-initialized so a failed string copy leaves nullptrs for free_missing_indexes.
+    auto* result = new quiver_missing_index_t[indexes.size()]();
+    try {
+        for (size_t i = 0; i < indexes.size(); ++i) {
+            const auto& index = indexes[i];
+            std::string columns;
+            for (const auto& column : index.columns) {
+                columns += (columns.empty() ? "" : ",") + column;
+            }
+            result[i].table = quiver::string::new_c_str(index.table);
+            result[i].columns = quiver::string::new_c_str(columns);
+            result[i].reason = quiver::string::new_c_str(index.reason);
+            result[i].create_sql = quiver::string::new_c_str(index.create_sql());
+        }
+    } catch (...) {
+        quiver_database_free_missing_indexes(result, indexes.size());
+        *out_count = 0;
+        throw;
+    }
+    *out_indexes = result;
+}
+
+}  // namespace
 
 extern "C" {
 
@@ -109,6 +144,37 @@ QUIVER_C_API quiver_error_t quiver_database_from_schema(const char* db_path,
     }
 }
 
+QUIVER_C_API quiver_error_t quiver_database_open_in_memory_copy(const char* path,
+                                                                const quiver_database_options_t* options,
+                                                                quiver_database_t** out_db) {
+    QUIVER_REQUIRE(path, out_db);
+
+    try {
+        auto db = quiver::Database::open_in_memory_copy(
+            path, options ? convert_database_options(*options) : quiver::DatabaseOptions{});
+        *out_db = new quiver_database(std::move(db));
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_save_to(quiver_database_t* db, const char* path) {
+    QUIVER_REQUIRE(db, path);
+
+    try {
+        db->db.save_to(path);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
 // Schema inspection — human-readable text reports.
 
 QUIVER_C_API quiver_error_t quiver_database_describe(quiver_database_t* db, char** out_report) {
@@ -151,4 +217,53 @@ QUIVER_C_API quiver_error_t quiver_database_summarize_collection(quiver_database
     }
 }
 
+// Index advisor
+
+QUIVER_C_API quiver_error_t quiver_database_missing_indexes(quiver_database_t* db,
+                                                            quiver_missing_index_t** out_indexes,
+                                                            size_t* out_count) {
+    QUIVER_REQUIRE(db, out_indexes, out_count);
+
+    try {
+        convert_missing_indexes(db->db.missing_indexes(), out_indexes, out_count);
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_ensure_indexes(quiver_database_t* db,
+                                                           quiver_missing_index_t** out_created,
+                                                           size_t* out_count) {
+    QUIVER_REQUIRE(db, out_created, out_count);
+
+    try {
+        convert_missing_indexes(db->db.ensure_indexes(), out_created, out_count);
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_free_missing_indexes(quiver_missing_index_t* indexes, size_t count) {
+    if (indexes) {
+        for (size_t i = 0; i < count; ++i) {
+            delete[] indexes[i].table;
+            delete[] indexes[i].columns;
+            delete[] indexes[i].reason;
+            delete[] indexes[i].create_sql;
+        }
+        delete[] indexes;
+    }
+    return QUIVER_OK;
+}
+
 }  // extern "C"
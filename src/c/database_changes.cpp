@@ -0,0 +1,140 @@
+#include "database_helpers.h"
+#include "internal.h"
+#include "quiver/c/database.h"
+
+namespace {
+
+struct KindIds {
+    quiver_change_kind_t kind;
+    const std::vector<int64_t>* ids;
+};
+
+std::vector<KindIds> kind_ids(const quiver::TableChanges& changes) {
+    return {{QUIVER_CHANGE_CREATED, &changes.created},
+            {QUIVER_CHANGE_UPDATED, &changes.updated},
+            {QUIVER_CHANGE_DELETED, &changes.deleted}};
+}
+
+}  // namespace
+
+extern "C" {
+
+QUIVER_C_API quiver_error_t quiver_database_subscribe_changes(quiver_database_t* db,
+                                                              quiver_change_callback_t callback,
+                                                              void* user_data,
+                                                              int64_t* out_subscription) {
+    QUIVER_REQUIRE(db, out_subscription);
+
+    try {
+        quiver::ChangeCallback forward;
+        if (callback) {
+            forward = [callback, user_data](const quiver::ChangeBatch& batch) {
+                for (const auto& changes : batch.tables) {
+                    for (const auto& [kind, ids] : kind_ids(changes)) {
+                        if (!ids->empty()) {
+                            callback(user_data,
+                                     batch.sequence,
+                                     changes.table.c_str(),
+                                     changes.collection.c_str(),
+                                     kind,
+                                     ids->data(),
+                                     ids->size());
+                        }
+                    }
+                }
+            };
+        }
+        *out_subscription = db->db.subscribe_changes(std::move(forward));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_unsubscribe_changes(quiver_database_t* db, int64_t subscription) {
+    QUIVER_REQUIRE(db);
+
+    try {
+        db->db.unsubscribe_changes(subscription);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_poll_changes(quiver_database_t* db,
+                                                         int64_t subscription,
+                                                         int64_t** out_sequences,
+                                                         char*** out_tables,
+                                                         char*** out_collections,
+                                                         int** out_kinds,
+                                                         int64_t** out_ids,
+                                                         size_t* out_count) {
+    QUIVER_REQUIRE(db, out_sequences, out_tables, out_collections, out_kinds, out_ids, out_count);
+
+    try {
+        const auto batches = db->db.poll_changes(subscription);
+
+        size_t count = 0;
+        for (const auto& batch : batches) {
+            for (const auto& changes : batch.tables) {
+                count += changes.created.size() + changes.updated.size() + changes.deleted.size();
+            }
+        }
+        *out_count = count;
+        if (count == 0) {
+            *out_sequences = nullptr;
+            *out_tables = nullptr;
+            *out_collections = nullptr;
+            *out_kinds = nullptr;
+            *out_ids = nullptr;
+            return QUIVER_OK;
+        }
+
+        *out_sequences = new int64_t[count];
+        *out_tables = new char*[count];
+        *out_collections = new char*[count];
+        *out_kinds = new int[count];
+        *out_ids = new int64_t[count];
+        size_t i = 0;
+        for (const auto& batch : batches) {
+            for (const auto& changes : batch.tables) {
+                for (const auto& [kind, ids] : kind_ids(changes)) {
+                    for (const auto id : *ids) {
+                        (*out_sequences)[i] = batch.sequence;
+                        (*out_tables)[i] = quiver::string::new_c_str(changes.table);
+                        (*out_collections)[i] = quiver::string::new_c_str(changes.collection);
+                        (*out_kinds)[i] = kind;
+                        (*out_ids)[i] = id;
+                        ++i;
+                    }
+                }
+            }
+        }
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_free_changes(int64_t* sequences,
+                                                         char** tables,
+                                                         char** collections,
+                                                         int* kinds,
+                                                         int64_t* ids,
+                                                         size_t count) {
+    delete[] sequences;
+    quiver_database_free_string_array(tables, count);
+    quiver_database_free_string_array(collections, count);
+    delete[] kinds;
+    delete[] ids;
+    return QUIVER_OK;
+}
+
+}  // extern "C"
@@ -2,6 +2,10 @@
 #include "quiver/c/database.h"
 #include "quiver/c/element.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 extern "C" {
 
 QUIVER_C_API quiver_error_t quiver_database_create_element(quiver_database_t* db,
@@ -19,4 +23,33 @@ QUIVER_C_API quiver_error_t quiver_database_create_element(quiver_database_t* db
     }
 }
 
+QUIVER_C_API quiver_error_t quiver_database_create_elements(quiver_database_t* db,
+                                                            const char* collection,
+                                                            const quiver_element_t* const* elements,
+                                                            size_t element_count,
+                                                            int64_t* out_ids) {
+    QUIVER_REQUIRE(db, collection);
+    if (element_count > 0) {
+        QUIVER_REQUIRE(elements, out_ids);
+    }
+
+    try {
+        std::vector<quiver::Element> batch;
+        batch.reserve(element_count);
+        for (size_t i = 0; i < element_count; ++i) {
+            if (!elements[i]) {
+                quiver_set_last_error("Null argument: elements[" + std::to_string(i) + "]");
+                return QUIVER_ERROR;
+            }
+            batch.push_back(elements[i]->element);
+        }
+        auto ids = db->db.create_elements(collection, batch);
+        std::copy(ids.begin(), ids.end(), out_ids);
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
 }  // extern "C"
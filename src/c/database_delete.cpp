@@ -1,6 +1,36 @@
+#include "database_helpers.h"
 #include "internal.h"
 #include "quiver/c/database.h"
 
+#include <new>
+
+namespace {
+
+void convert_delete_result(const quiver::DeleteResult& result, quiver_delete_result_t* out_result) {
+    *out_result = {};
+    out_result->elements = result.elements;
+    if (result.group_rows.empty()) {
+        return;
+    }
+    // Value-initialized so a failed string copy leaves nullptrs for free_delete_result.
+    out_result->group_tables = new char*[result.group_rows.size()]();
+    out_result->group_count = result.group_rows.size();
+    try {
+        out_result->group_rows = new int64_t[result.group_rows.size()];
+        size_t i = 0;
+        for (const auto& [table, rows] : result.group_rows) {
+            out_result->group_tables[i] = quiver::string::new_c_str(table);
+            out_result->group_rows[i] = rows;
+            ++i;
+        }
+    } catch (...) {
+        quiver_database_free_delete_result(out_result);
+        throw;
+    }
+}
+
+}  // namespace
+
 extern "C" {
 
 QUIVER_C_API quiver_error_t quiver_database_delete_element(quiver_database_t* db, const char* collection, int64_t id) {
@@ -15,4 +45,67 @@ QUIVER_C_API quiver_error_t quiver_database_delete_element(quiver_database_t* db
     }
 }
 
+QUIVER_C_API quiver_error_t quiver_database_delete_elements(quiver_database_t* db,
+                                                            const char* collection,
+                                                            const int64_t* ids,
+                                                            size_t id_count,
+                                                            quiver_delete_result_t* out_result) {
+    QUIVER_REQUIRE(db, collection, out_result);
+    if (id_count > 0) {
+        QUIVER_REQUIRE(ids);
+    }
+
+    try {
+        const auto result = db->db.delete_elements(collection, std::span<const int64_t>(ids, id_count));
+        convert_delete_result(result, out_result);
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_delete_elements_where(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* predicate,
+                                                                  const int* param_types,
+                                                                  const void* const* param_values,
+                                                                  size_t param_count,
+                                                                  quiver_delete_result_t* out_result) {
+    QUIVER_REQUIRE(db, collection, predicate, out_result);
+    if (param_count > 0) {
+        QUIVER_REQUIRE(param_types, param_values);
+    }
+
+    try {
+        const auto parameters = convert_params(param_types, param_values, param_count);
+        const auto result = db->db.delete_elements_where(collection, predicate, parameters);
+        convert_delete_result(result, out_result);
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_free_delete_result(quiver_delete_result_t* result) {
+    QUIVER_REQUIRE(result);
+
+    if (result->group_tables) {
+        for (size_t i = 0; i < result->group_count; ++i) {
+            delete[] result->group_tables[i];
+        }
+    }
+    delete[] result->group_tables;
+    delete[] result->group_rows;
+    *result = {};
+    return QUIVER_OK;
+}
+
 }  // extern "C"
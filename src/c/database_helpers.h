@@ -6,6 +6,7 @@
 #include "quiver/database.h"
 #include "utils/string.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <map>
@@ -31,28 +32,22 @@ quiver_error_t read_scalars_impl(const std::vector<T>& values, T** out_values, s
 
 // Helper for reading nullable numeric scalars into a value array + parallel presence mask.
 // mask[i] == 0 means SQL NULL; the data slot then holds a placeholder (0 / 0.0) to be ignored.
+// The ScalarColumn is already in that layout, so each array is a single bulk copy.
 template <typename T>
-quiver_error_t read_scalars_masked_impl(const std::vector<std::optional<T>>& values,
+quiver_error_t read_scalars_masked_impl(const quiver::ScalarColumn<T>& column,
                                         T** out_values,
                                         uint8_t** out_mask,
                                         size_t* out_count) {
-    *out_count = values.size();
-    if (values.empty()) {
+    *out_count = column.values.size();
+    if (column.values.empty()) {
         *out_values = nullptr;
         *out_mask = nullptr;
         return QUIVER_OK;
     }
-    *out_values = new T[values.size()];
-    *out_mask = new uint8_t[values.size()];
-    for (size_t i = 0; i < values.size(); ++i) {
-        if (values[i]) {
-            (*out_values)[i] = *values[i];
-            (*out_mask)[i] = 1;
-        } else {
-            (*out_values)[i] = T{};
-            (*out_mask)[i] = 0;
-        }
-    }
+    *out_values = new T[column.values.size()];
+    *out_mask = new uint8_t[column.valid.size()];
+    std::copy(column.values.begin(), column.values.end(), *out_values);
+    std::copy(column.valid.begin(), column.valid.end(), *out_mask);
     return QUIVER_OK;
 }
 
@@ -392,4 +387,34 @@ inline void marshal_group_rows_to_c(const char* caller,
     *out_row_count = row_count;
 }
 
+// Helper to convert C parameter arrays (the *_params encoding) to std::vector<Value>
+inline std::vector<quiver::Value>
+convert_params(const int* param_types, const void* const* param_values, size_t param_count) {
+    std::vector<quiver::Value> parameters;
+    parameters.reserve(param_count);
+    for (size_t i = 0; i < param_count; ++i) {
+        switch (param_types[i]) {
+        case QUIVER_DATA_TYPE_INTEGER:
+            parameters.emplace_back(*static_cast<const int64_t*>(param_values[i]));
+            break;
+        case QUIVER_DATA_TYPE_FLOAT:
+            parameters.emplace_back(*static_cast<const double*>(param_values[i]));
+            break;
+        case QUIVER_DATA_TYPE_STRING:
+            if (!param_values[i]) {
+                throw std::runtime_error("Cannot query: parameter at index " + std::to_string(i) +
+                                         " has null string value");
+            }
+            parameters.emplace_back(std::string(static_cast<const char*>(param_values[i])));
+            break;
+        case QUIVER_DATA_TYPE_NULL:
+            parameters.emplace_back(nullptr);
+            break;
+        default:
+            throw std::runtime_error("Cannot query: unknown parameter type " + std::to_string(param_types[i]));
+        }
+    }
+    return parameters;
+}
+
 #endif  // QUIVER_C_DATABASE_HELPERS_H
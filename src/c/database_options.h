@@ -4,12 +4,45 @@
 #include "quiver/c/options.h"
 #include "quiver/options.h"
 
+#include <stdexcept>
 #include <string>
 
+inline quiver::ConnectionProfile convert_connection_profile(const quiver_connection_profile_t& c_profile) {
+    return {
+        .journal_mode = static_cast<quiver::JournalMode>(c_profile.journal_mode),
+        .synchronous = static_cast<quiver::Synchronous>(c_profile.synchronous),
+        .temp_store = static_cast<quiver::TempStore>(c_profile.temp_store),
+        .cache_size_kib = c_profile.cache_size_kib,
+        .mmap_size = c_profile.mmap_size,
+    };
+}
+
+inline quiver_connection_profile_t convert_connection_profile(const quiver::ConnectionProfile& profile) {
+    return {
+        static_cast<quiver_journal_mode_t>(profile.journal_mode),
+        static_cast<quiver_synchronous_t>(profile.synchronous),
+        static_cast<quiver_temp_store_t>(profile.temp_store),
+        profile.cache_size_kib,
+        profile.mmap_size,
+    };
+}
+
 inline quiver::DatabaseOptions convert_database_options(const quiver_database_options_t& c_opts) {
+    if (c_opts.trace.ring_capacity < 0) {
+        throw std::runtime_error("Cannot open database: trace ring_capacity must not be negative");
+    }
     return {
         .read_only = c_opts.read_only != 0,
         .console_level = static_cast<quiver::LogLevel>(c_opts.console_level),
+        .profile = convert_connection_profile(c_opts.profile),
+        .trace =
+            {
+                .enabled = c_opts.trace.enabled != 0,
+                .slow_threshold_ns = c_opts.trace.slow_threshold_ns,
+                .ring_capacity = static_cast<size_t>(c_opts.trace.ring_capacity),
+            },
+        .file_log = static_cast<quiver::FileLogMode>(c_opts.file_log),
+        .immutable = c_opts.immutable != 0,
     };
 }
 
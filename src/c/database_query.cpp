@@ -2,40 +2,13 @@
 #include "internal.h"
 #include "quiver/c/database.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
-// Helper to convert C parameter arrays to std::vector<Value>
-static std::vector<quiver::Value>
-convert_params(const int* param_types, const void* const* param_values, size_t param_count) {
-    std::vector<quiver::Value> parameters;
-    parameters.reserve(param_count);
-    for (size_t i = 0; i < param_count; ++i) {
-        switch (param_types[i]) {
-        case QUIVER_DATA_TYPE_INTEGER:
-            parameters.emplace_back(*static_cast<const int64_t*>(param_values[i]));
-            break;
-        case QUIVER_DATA_TYPE_FLOAT:
-            parameters.emplace_back(*static_cast<const double*>(param_values[i]));
-            break;
-        case QUIVER_DATA_TYPE_STRING:
-            if (!param_values[i]) {
-                throw std::runtime_error("Cannot query: parameter at index " + std::to_string(i) +
-                                         " has null string value");
-            }
-            parameters.emplace_back(std::string(static_cast<const char*>(param_values[i])));
-            break;
-        case QUIVER_DATA_TYPE_NULL:
-            parameters.emplace_back(nullptr);
-            break;
-        default:
-            throw std::runtime_error("Cannot query: unknown parameter type " + std::to_string(param_types[i]));
-        }
-    }
-    return parameters;
-}
-
 extern "C" {
 
 // Plain query functions
@@ -192,4 +165,210 @@ QUIVER_C_API quiver_error_t quiver_database_query_float_params(quiver_database_t
     }
 }
 
+// Whole-result query
+
+QUIVER_C_API quiver_error_t quiver_database_query_table(quiver_database_t* db,
+                                                        const char* sql,
+                                                        const int* param_types,
+                                                        const void* const* param_values,
+                                                        size_t param_count,
+                                                        char*** out_column_names,
+                                                        int** out_column_types,
+                                                        void*** out_column_data,
+                                                        uint8_t*** out_column_has_value,
+                                                        size_t* out_column_count,
+                                                        size_t* out_row_count) {
+    QUIVER_REQUIRE(db, sql, out_column_names, out_column_types, out_column_data, out_column_has_value);
+    QUIVER_REQUIRE(out_column_count, out_row_count);
+
+    if (param_count > 0) {
+        QUIVER_REQUIRE(param_types, param_values);
+    }
+    try {
+        auto parameters = convert_params(param_types, param_values, param_count);
+        auto table = db->db.query_table(sql, parameters);
+        const auto col_count = table.columns.size();
+        const auto row_count = table.row_count;
+
+        *out_column_names = nullptr;
+        *out_column_types = nullptr;
+        *out_column_data = nullptr;
+        *out_column_has_value = nullptr;
+        *out_column_count = 0;
+        *out_row_count = 0;
+        if (col_count == 0) {
+            return QUIVER_OK;
+        }
+
+        // Outer arrays value-initialized so the cleanup path can free a partial result
+        *out_column_names = new char*[col_count]();
+        *out_column_types = new int[col_count]();
+        *out_column_data = new void*[col_count]();
+        *out_column_has_value = new uint8_t*[col_count]();
+        try {
+            for (size_t c = 0; c < col_count; ++c) {
+                const auto& column = table.columns[c];
+                (*out_column_names)[c] = quiver::string::new_c_str(column.name);
+                auto* mask = new uint8_t[row_count];
+                (*out_column_has_value)[c] = mask;
+                std::copy(column.valid.begin(), column.valid.end(), mask);
+                std::visit(
+                    [&](const auto& values) {
+                        using T = typename std::decay_t<decltype(values)>::value_type;
+                        if constexpr (std::is_same_v<T, std::string>) {
+                            (*out_column_types)[c] = QUIVER_DATA_TYPE_STRING;
+                            auto** arr = new char*[row_count]();
+                            (*out_column_data)[c] = arr;
+                            for (size_t r = 0; r < row_count; ++r) {
+                                arr[r] = mask[r] ? quiver::string::new_c_str(values[r]) : nullptr;
+                            }
+                        } else {
+                            (*out_column_types)[c] =
+                                std::is_same_v<T, int64_t> ? QUIVER_DATA_TYPE_INTEGER : QUIVER_DATA_TYPE_FLOAT;
+                            auto* arr = new T[row_count];
+                            (*out_column_data)[c] = arr;
+                            std::copy(values.begin(), values.end(), arr);
+                        }
+                    },
+                    column.values);
+            }
+        } catch (...) {
+            quiver_database_free_time_series_data(
+                *out_column_names, *out_column_types, *out_column_data, *out_column_has_value, col_count, row_count);
+            *out_column_names = nullptr;
+            *out_column_types = nullptr;
+            *out_column_data = nullptr;
+            *out_column_has_value = nullptr;
+            throw;
+        }
+
+        *out_column_count = col_count;
+        *out_row_count = row_count;
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+// Streaming cursor
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_open(quiver_database_t* db,
+                                                        const char* sql,
+                                                        const int* param_types,
+                                                        const void* const* param_values,
+                                                        size_t param_count,
+                                                        quiver_database_cursor_t** out_cursor) {
+    QUIVER_REQUIRE(db, sql, out_cursor);
+
+    if (param_count > 0) {
+        QUIVER_REQUIRE(param_types, param_values);
+    }
+    try {
+        auto parameters = convert_params(param_types, param_values, param_count);
+        *out_cursor = new quiver_database_cursor(db->db.cursor(sql, parameters));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_next(quiver_database_cursor_t* cursor, int* out_has_row) {
+    QUIVER_REQUIRE(cursor, out_has_row);
+
+    try {
+        *out_has_row = cursor->cursor.next() ? 1 : 0;
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_column_count(quiver_database_cursor_t* cursor, size_t* out_count) {
+    QUIVER_REQUIRE(cursor, out_count);
+
+    *out_count = cursor->cursor.column_count();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_column_name(quiver_database_cursor_t* cursor,
+                                                               size_t index,
+                                                               const char** out_name) {
+    QUIVER_REQUIRE(cursor, out_name);
+
+    const auto& columns = cursor->cursor.columns();
+    if (index >= columns.size()) {
+        quiver_set_last_error("Cannot read cursor column: index " + std::to_string(index) + " out of range");
+        return QUIVER_ERROR;
+    }
+    *out_name = columns[index].c_str();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_get_integer(quiver_database_cursor_t* cursor,
+                                                               size_t index,
+                                                               int64_t* out_value,
+                                                               int* out_has_value) {
+    QUIVER_REQUIRE(cursor, out_value, out_has_value);
+
+    try {
+        auto value = cursor->cursor.get_integer(index);
+        *out_value = value.value_or(0);
+        *out_has_value = value.has_value() ? 1 : 0;
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_get_float(quiver_database_cursor_t* cursor,
+                                                             size_t index,
+                                                             double* out_value,
+                                                             int* out_has_value) {
+    QUIVER_REQUIRE(cursor, out_value, out_has_value);
+
+    try {
+        auto value = cursor->cursor.get_float(index);
+        *out_value = value.value_or(0.0);
+        *out_has_value = value.has_value() ? 1 : 0;
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_get_string(quiver_database_cursor_t* cursor,
+                                                              size_t index,
+                                                              char** out_value,
+                                                              int* out_has_value) {
+    QUIVER_REQUIRE(cursor, out_value, out_has_value);
+
+    try {
+        auto value = cursor->cursor.get_string(index);
+        if (value.has_value()) {
+            *out_value = quiver::string::new_c_str(*value);
+            *out_has_value = 1;
+        } else {
+            *out_value = nullptr;
+            *out_has_value = 0;
+        }
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_cursor_close(quiver_database_cursor_t* cursor) {
+    delete cursor;
+    return QUIVER_OK;
+}
+
 }  // extern "C"
@@ -16,7 +16,7 @@ QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers(quiver_database
 
     try {
         return read_scalars_masked_impl(
-            db->db.read_scalar_integers(collection, attribute), out_values, out_mask, out_count);
+            db->db.read_scalar_integers_column(collection, attribute), out_values, out_mask, out_count);
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR;
@@ -33,7 +33,7 @@ QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats(quiver_database_t
 
     try {
         return read_scalars_masked_impl(
-            db->db.read_scalar_floats(collection, attribute), out_values, out_mask, out_count);
+            db->db.read_scalar_floats_column(collection, attribute), out_values, out_mask, out_count);
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
         return QUIVER_ERROR;
@@ -289,6 +289,81 @@ QUIVER_C_API quiver_error_t quiver_database_read_scalar_string_by_id(quiver_data
     }
 }
 
+// Read scalars for a list of IDs
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_integers_by_ids(quiver_database_t* db,
+                                                                        const char* collection,
+                                                                        const char* attribute,
+                                                                        const int64_t* ids,
+                                                                        size_t id_count,
+                                                                        int64_t** out_values,
+                                                                        uint8_t** out_mask,
+                                                                        size_t* out_count) {
+    QUIVER_REQUIRE(db, collection, attribute, out_values, out_mask, out_count);
+    if (id_count > 0) {
+        QUIVER_REQUIRE(ids);
+    }
+
+    try {
+        return read_scalars_masked_impl(
+            db->db.read_scalar_integers_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count)),
+            out_values,
+            out_mask,
+            out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_floats_by_ids(quiver_database_t* db,
+                                                                      const char* collection,
+                                                                      const char* attribute,
+                                                                      const int64_t* ids,
+                                                                      size_t id_count,
+                                                                      double** out_values,
+                                                                      uint8_t** out_mask,
+                                                                      size_t* out_count) {
+    QUIVER_REQUIRE(db, collection, attribute, out_values, out_mask, out_count);
+    if (id_count > 0) {
+        QUIVER_REQUIRE(ids);
+    }
+
+    try {
+        return read_scalars_masked_impl(
+            db->db.read_scalar_floats_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count)),
+            out_values,
+            out_mask,
+            out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_scalar_strings_by_ids(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* attribute,
+                                                                       const int64_t* ids,
+                                                                       size_t id_count,
+                                                                       char*** out_values,
+                                                                       size_t* out_count) {
+    QUIVER_REQUIRE(db, collection, attribute, out_values, out_count);
+    if (id_count > 0) {
+        QUIVER_REQUIRE(ids);
+    }
+
+    try {
+        return copy_strings_to_c(
+            db->db.read_scalar_strings_by_ids(collection, attribute, std::span<const int64_t>(ids, id_count)),
+            out_values,
+            out_count);
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
 // Read vector by ID functions
 
 QUIVER_C_API quiver_error_t quiver_database_read_vector_integers_by_id(quiver_database_t* db,
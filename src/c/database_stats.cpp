@@ -0,0 +1,132 @@
+#include "database_helpers.h"
+#include "internal.h"
+#include "quiver/c/database.h"
+
+extern "C" {
+
+QUIVER_C_API quiver_error_t quiver_database_enable_stats(quiver_database_t* db, int enabled) {
+    QUIVER_REQUIRE(db);
+
+    db->db.enable_stats(enabled != 0);
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_stats(quiver_database_t* db,
+                                                  quiver_operation_stats_t** out_stats,
+                                                  size_t* out_count) {
+    QUIVER_REQUIRE(db, out_stats, out_count);
+
+    try {
+        const auto stats = db->db.stats();
+        *out_count = stats.size();
+        if (stats.empty()) {
+            *out_stats = nullptr;
+            return QUIVER_OK;
+        }
+        // Value-initialized so a failed name copy leaves nullptr operations for free_stats.
+        auto* result = new quiver_operation_stats_t[stats.size()]();
+        try {
+            for (size_t i = 0; i < stats.size(); ++i) {
+                const auto& op = stats[i];
+                result[i] = {quiver::string::new_c_str(op.operation),
+                             op.calls,
+                             op.total_ns,
+                             op.p50_ns,
+                             op.p99_ns,
+                             op.rows_read,
+                             op.rows_written,
+                             op.statements_prepared,
+                             op.statements_reused,
+                             op.bytes_bound};
+            }
+        } catch (...) {
+            quiver_database_free_stats(result, stats.size());
+            *out_count = 0;
+            throw;
+        }
+        *out_stats = result;
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_reset_stats(quiver_database_t* db) {
+    QUIVER_REQUIRE(db);
+
+    db->db.reset_stats();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_free_stats(quiver_operation_stats_t* stats, size_t count) {
+    if (stats) {
+        for (size_t i = 0; i < count; ++i) {
+            delete[] stats[i].operation;
+        }
+        delete[] stats;
+    }
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_traced_statements(quiver_database_t* db,
+                                                              quiver_traced_statement_t** out_statements,
+                                                              size_t* out_count) {
+    QUIVER_REQUIRE(db, out_statements, out_count);
+
+    try {
+        const auto traced = db->db.traced_statements();
+        *out_count = traced.size();
+        if (traced.empty()) {
+            *out_statements = nullptr;
+            return QUIVER_OK;
+        }
+        // Value-initialized so a failed string copy leaves nullptrs for free_traced_statements.
+        auto* result = new quiver_traced_statement_t[traced.size()]();
+        try {
+            for (size_t i = 0; i < traced.size(); ++i) {
+                const auto& statement = traced[i];
+                result[i].sql = quiver::string::new_c_str(statement.sql);
+                result[i].operation = quiver::string::new_c_str(statement.operation);
+                result[i].elapsed_ns = statement.elapsed_ns;
+                result[i].rows = statement.rows;
+            }
+        } catch (...) {
+            quiver_database_free_traced_statements(result, traced.size());
+            *out_count = 0;
+            throw;
+        }
+        *out_statements = result;
+        return QUIVER_OK;
+    } catch (const std::bad_alloc&) {
+        quiver_set_last_error("Memory allocation failed");
+        return QUIVER_ERROR;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_clear_traced_statements(quiver_database_t* db) {
+    QUIVER_REQUIRE(db);
+
+    db->db.clear_traced_statements();
+    return QUIVER_OK;
+}
+
+QUIVER_C_API quiver_error_t quiver_database_free_traced_statements(quiver_traced_statement_t* statements,
+                                                                   size_t count) {
+    if (statements) {
+        for (size_t i = 0; i < count; ++i) {
+            delete[] statements[i].sql;
+            delete[] statements[i].operation;
+        }
+        delete[] statements;
+    }
+    return QUIVER_OK;
+}
+
+}  // extern "C"
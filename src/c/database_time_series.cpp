@@ -3,6 +3,7 @@
 #include "quiver/c/database.h"
 #include "quiver/data_type.h"
 
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <optional>
@@ -10,6 +11,63 @@
 #include <variant>
 #include <vector>
 
+namespace {
+
+// Type of a time series value column as quiver_data_type_t. Callers run after the C++ read has
+// validated collection/group/attribute, so the lookup cannot miss.
+int time_series_attribute_c_type(quiver::Database& db,
+                                 const char* collection,
+                                 const char* group,
+                                 const char* attribute) {
+    auto metadata = db.get_time_series_metadata(collection, group);
+    for (const auto& vc : metadata.value_columns) {
+        if (vc.name == attribute) {
+            return to_c_data_type(vc.data_type);
+        }
+    }
+    return to_c_data_type(quiver::DataType{});
+}
+
+// Copies count Values of one column type into a new typed array (int64_t*, double* or char**).
+// A missing value becomes 0, NaN or a NULL string respectively.
+template <typename CellAt>
+void* values_to_c_array(const char* caller, int data_type, size_t count, CellAt cell_at) {
+    switch (data_type) {
+    case QUIVER_DATA_TYPE_INTEGER: {
+        auto* arr = new int64_t[count];
+        for (size_t i = 0; i < count; ++i) {
+            const auto& value = cell_at(i);
+            arr[i] = std::holds_alternative<int64_t>(value) ? std::get<int64_t>(value) : 0;
+        }
+        return arr;
+    }
+    case QUIVER_DATA_TYPE_FLOAT: {
+        auto* arr = new double[count];
+        for (size_t i = 0; i < count; ++i) {
+            const auto& value = cell_at(i);
+            arr[i] = std::holds_alternative<double>(value) ? std::get<double>(value)
+                                                           : std::numeric_limits<double>::quiet_NaN();
+        }
+        return arr;
+    }
+    case QUIVER_DATA_TYPE_STRING:
+    case QUIVER_DATA_TYPE_DATE_TIME: {
+        auto** arr = new char*[count]();
+        for (size_t i = 0; i < count; ++i) {
+            const auto& value = cell_at(i);
+            arr[i] = std::holds_alternative<std::string>(value)
+                         ? quiver::string::new_c_str(std::get<std::string>(value))
+                         : nullptr;
+        }
+        return arr;
+    }
+    default:
+        throw std::runtime_error(std::string("Cannot ") + caller + ": unknown data type " + std::to_string(data_type));
+    }
+}
+
+}  // namespace
+
 extern "C" {
 
 // Time series metadata
@@ -70,57 +128,58 @@ QUIVER_C_API quiver_error_t quiver_database_read_time_series_row(quiver_database
         // canonical errors; afterwards the metadata lookup below cannot miss.
         auto values = db->db.read_time_series_row(collection, group, attribute, date_time);
 
-        auto metadata = db->db.get_time_series_metadata(collection, group);
-        quiver::DataType attr_type{};
-        for (const auto& vc : metadata.value_columns) {
-            if (vc.name == attribute) {
-                attr_type = vc.data_type;
-                break;
-            }
-        }
-
         *out_count = values.size();
-        *out_data_type = to_c_data_type(attr_type);
+        *out_data_type = time_series_attribute_c_type(db->db, collection, group, attribute);
 
         if (values.empty()) {
             *out_values = nullptr;
             return QUIVER_OK;
         }
 
-        switch (*out_data_type) {
-        case QUIVER_DATA_TYPE_INTEGER: {
-            auto* arr = new int64_t[values.size()];
-            for (size_t i = 0; i < values.size(); ++i) {
-                arr[i] = std::holds_alternative<int64_t>(values[i]) ? std::get<int64_t>(values[i]) : 0;
-            }
-            *out_values = arr;
-            break;
-        }
-        case QUIVER_DATA_TYPE_FLOAT: {
-            auto* arr = new double[values.size()];
-            for (size_t i = 0; i < values.size(); ++i) {
-                arr[i] = std::holds_alternative<double>(values[i]) ? std::get<double>(values[i])
-                                                                   : std::numeric_limits<double>::quiet_NaN();
-            }
-            *out_values = arr;
-            break;
-        }
-        case QUIVER_DATA_TYPE_STRING:
-        case QUIVER_DATA_TYPE_DATE_TIME: {
-            auto** arr = new char*[values.size()];
-            for (size_t i = 0; i < values.size(); ++i) {
-                arr[i] = std::holds_alternative<std::string>(values[i])
-                             ? quiver::string::new_c_str(std::get<std::string>(values[i]))
-                             : nullptr;
-            }
-            *out_values = arr;
-            break;
-        }
-        default:
-            throw std::runtime_error("Cannot read_time_series_row: unknown data type " +
-                                     std::to_string(*out_data_type));
+        *out_values = values_to_c_array(
+            "read_time_series_row", *out_data_type, values.size(), [&values](size_t i) -> const quiver::Value& {
+                return values[i];
+            });
+
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
+QUIVER_C_API quiver_error_t quiver_database_read_time_series_rows(quiver_database_t* db,
+                                                                  const char* collection,
+                                                                  const char* group,
+                                                                  const char* attribute,
+                                                                  const char* const* date_times,
+                                                                  size_t date_time_count,
+                                                                  int* out_data_type,
+                                                                  void** out_values,
+                                                                  size_t* out_element_count) {
+    QUIVER_REQUIRE(db, collection, group, attribute, out_data_type, out_values, out_element_count);
+    if (date_time_count > 0) {
+        QUIVER_REQUIRE(date_times);
+    }
+
+    try {
+        std::vector<std::string> timestamps(date_times, date_times + date_time_count);
+        auto matrix = db->db.read_time_series_rows(collection, group, attribute, timestamps);
+
+        *out_element_count = matrix.size();
+        *out_data_type = time_series_attribute_c_type(db->db, collection, group, attribute);
+
+        if (matrix.empty() || date_time_count == 0) {
+            *out_values = nullptr;
+            return QUIVER_OK;
         }
 
+        *out_values = values_to_c_array("read_time_series_rows",
+                                        *out_data_type,
+                                        matrix.size() * date_time_count,
+                                        [&matrix, date_time_count](size_t i) -> const quiver::Value& {
+                                            return matrix[i / date_time_count][i % date_time_count];
+                                        });
         return QUIVER_OK;
     } catch (const std::exception& e) {
         quiver_set_last_error(e.what());
@@ -170,6 +229,104 @@ QUIVER_C_API quiver_error_t quiver_database_read_time_series_group(quiver_databa
     }
 }
 
+QUIVER_C_API quiver_error_t quiver_database_read_time_series_group_all(quiver_database_t* db,
+                                                                       const char* collection,
+                                                                       const char* group,
+                                                                       int64_t** out_ids,
+                                                                       char*** out_column_names,
+                                                                       int** out_column_types,
+                                                                       void*** out_column_data,
+                                                                       uint8_t*** out_column_has_value,
+                                                                       size_t* out_column_count,
+                                                                       size_t* out_row_count) {
+    QUIVER_REQUIRE(db, collection, group, out_ids, out_column_names, out_column_types);
+    QUIVER_REQUIRE(out_column_data, out_column_has_value, out_column_count, out_row_count);
+
+    try {
+        auto data = db->db.read_time_series_group_all(collection, group);
+        const auto col_count = data.columns.size();
+        const auto row_count = data.ids.size();
+
+        *out_ids = nullptr;
+        *out_column_names = nullptr;
+        *out_column_types = nullptr;
+        *out_column_data = nullptr;
+        *out_column_has_value = nullptr;
+        *out_column_count = 0;
+        *out_row_count = 0;
+        if (row_count == 0) {
+            return QUIVER_OK;
+        }
+
+        // Value columns report their schema type; dimension columns follow read_time_series_group,
+        // which reports them by storage type (a date_time dimension is STRING)
+        const auto metadata = db->db.get_time_series_metadata(collection, group);
+        auto c_type_of = [&metadata](const quiver::TimeSeriesColumn& column) -> int {
+            for (const auto& vc : metadata.value_columns) {
+                if (vc.name == column.name)
+                    return to_c_data_type(vc.data_type);
+            }
+            switch (column.values.index()) {
+            case 0:
+                return QUIVER_DATA_TYPE_INTEGER;
+            case 1:
+                return QUIVER_DATA_TYPE_FLOAT;
+            default:
+                return QUIVER_DATA_TYPE_STRING;
+            }
+        };
+
+        // Outer arrays value-initialized so the cleanup path can free a partial result
+        *out_column_names = new char*[col_count]();
+        *out_column_types = new int[col_count]();
+        *out_column_data = new void*[col_count]();
+        *out_column_has_value = new uint8_t*[col_count]();
+        try {
+            for (size_t c = 0; c < col_count; ++c) {
+                const auto& column = data.columns[c];
+                (*out_column_names)[c] = quiver::string::new_c_str(column.name);
+                (*out_column_types)[c] = c_type_of(column);
+                auto* mask = new uint8_t[row_count];
+                (*out_column_has_value)[c] = mask;
+                std::copy(column.valid.begin(), column.valid.end(), mask);
+                std::visit(
+                    [&](const auto& values) {
+                        using T = typename std::decay_t<decltype(values)>::value_type;
+                        if constexpr (std::is_same_v<T, std::string>) {
+                            auto** arr = new char*[row_count]();
+                            (*out_column_data)[c] = arr;
+                            for (size_t r = 0; r < row_count; ++r) {
+                                arr[r] = mask[r] ? quiver::string::new_c_str(values[r]) : nullptr;
+                            }
+                        } else {
+                            auto* arr = new T[row_count];
+                            (*out_column_data)[c] = arr;
+                            std::copy(values.begin(), values.end(), arr);
+                        }
+                    },
+                    column.values);
+            }
+            *out_ids = new int64_t[row_count];
+            std::copy(data.ids.begin(), data.ids.end(), *out_ids);
+        } catch (...) {
+            quiver_database_free_time_series_data(
+                *out_column_names, *out_column_types, *out_column_data, *out_column_has_value, col_count, row_count);
+            *out_column_names = nullptr;
+            *out_column_types = nullptr;
+            *out_column_data = nullptr;
+            *out_column_has_value = nullptr;
+            throw;
+        }
+
+        *out_column_count = col_count;
+        *out_row_count = row_count;
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
 QUIVER_C_API quiver_error_t quiver_database_update_time_series_group(quiver_database_t* db,
                                                                      const char* collection,
                                                                      const char* group,
@@ -243,6 +400,88 @@ QUIVER_C_API quiver_error_t quiver_database_upsert_time_series_row(quiver_databa
     }
 }
 
+QUIVER_C_API quiver_error_t quiver_database_write_time_series(quiver_database_t* db,
+                                                              const char* collection,
+                                                              const char* group,
+                                                              const int64_t* ids,
+                                                              const char* const* column_names,
+                                                              const int* column_types,
+                                                              const void* const* column_data,
+                                                              const uint8_t* const* column_has_value,
+                                                              size_t column_count,
+                                                              size_t row_count,
+                                                              int mode) {
+    QUIVER_REQUIRE(db, collection, group);
+    if (row_count > 0) {
+        QUIVER_REQUIRE(ids);
+    }
+    if (column_count > 0) {
+        QUIVER_REQUIRE(column_names, column_types, column_data);
+    }
+
+    try {
+        if (mode < QUIVER_TIME_SERIES_WRITE_APPEND || mode > QUIVER_TIME_SERIES_WRITE_UPSERT) {
+            throw std::runtime_error("Cannot write_time_series: unknown write mode " + std::to_string(mode));
+        }
+
+        std::vector<quiver::TimeSeriesColumn> columns(column_count);
+        for (size_t c = 0; c < column_count; ++c) {
+            auto& column = columns[c];
+            column.name = column_names[c];
+            const auto* mask = column_has_value ? column_has_value[c] : nullptr;
+            if (mask) {
+                column.valid.assign(mask, mask + row_count);
+            }
+            switch (column_types[c]) {
+            case QUIVER_DATA_TYPE_INTEGER: {
+                const auto* data = static_cast<const int64_t*>(column_data[c]);
+                column.values = std::vector<int64_t>(data, data + row_count);
+                break;
+            }
+            case QUIVER_DATA_TYPE_FLOAT: {
+                const auto* data = static_cast<const double*>(column_data[c]);
+                column.values = std::vector<double>(data, data + row_count);
+                break;
+            }
+            case QUIVER_DATA_TYPE_STRING:
+            case QUIVER_DATA_TYPE_DATE_TIME: {
+                const auto* data = static_cast<const char* const*>(column_data[c]);
+                std::vector<std::string> values(row_count);
+                for (size_t r = 0; r < row_count; ++r) {
+                    if (mask && !mask[r]) {
+                        continue;
+                    }
+                    if (data[r]) {
+                        values[r] = data[r];
+                    } else {
+                        // A NULL char* is a masked cell, as in update_time_series_group
+                        if (column.valid.empty()) {
+                            column.valid.assign(row_count, 1);
+                        }
+                        column.valid[r] = 0;
+                    }
+                }
+                column.values = std::move(values);
+                break;
+            }
+            default:
+                throw std::runtime_error("Cannot write_time_series: unknown column type " +
+                                         std::to_string(column_types[c]));
+            }
+        }
+
+        db->db.write_time_series(collection,
+                                 group,
+                                 std::vector<int64_t>(ids, ids + row_count),
+                                 columns,
+                                 static_cast<quiver::TimeSeriesWriteMode>(mode));
+        return QUIVER_OK;
+    } catch (const std::exception& e) {
+        quiver_set_last_error(e.what());
+        return QUIVER_ERROR;
+    }
+}
+
 // Time series free functions (co-located with read)
 
 QUIVER_C_API quiver_error_t quiver_database_free_time_series_data(char** column_names,
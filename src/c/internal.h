@@ -21,6 +21,11 @@ struct quiver_database {
     quiver_database(quiver::Database&& database) : db(std::move(database)) {}
 };
 
+struct quiver_database_cursor {
+    quiver::Cursor cursor;
+    quiver_database_cursor(quiver::Cursor&& c) : cursor(std::move(c)) {}
+};
+
 struct quiver_element {
     quiver::Element element;
 };
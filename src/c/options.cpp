@@ -1,9 +1,22 @@
+#include "database_options.h"
 #include "quiver/c/options.h"
 
 extern "C" {
 
 QUIVER_C_API quiver_database_options_t quiver_database_options_default(void) {
-    return {0, QUIVER_LOG_INFO};
+    return {0, QUIVER_LOG_INFO, {}, {0, 0, 256}, QUIVER_FILE_LOG_SYNC, 0};
+}
+
+QUIVER_C_API quiver_connection_profile_t quiver_connection_profile_bulk_load(void) {
+    return convert_connection_profile(quiver::ConnectionProfile::bulk_load());
+}
+
+QUIVER_C_API quiver_connection_profile_t quiver_connection_profile_read_mostly(void) {
+    return convert_connection_profile(quiver::ConnectionProfile::read_mostly());
+}
+
+QUIVER_C_API quiver_connection_profile_t quiver_connection_profile_durable(void) {
+    return convert_connection_profile(quiver::ConnectionProfile::durable());
 }
 
 QUIVER_C_API quiver_csv_options_t quiver_csv_options_default(void) {
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <argparse/argparse.hpp>
 #include <filesystem>
 #include <fstream>
@@ -36,6 +37,16 @@ static quiver::LogLevel parse_log_level(const std::string& level) {
     throw std::runtime_error("Unknown log level: " + level);
 }
 
+static quiver::FileLogMode parse_file_log_mode(const std::string& mode) {
+    if (mode == "sync")
+        return quiver::FileLogMode::Sync;
+    if (mode == "async")
+        return quiver::FileLogMode::Async;
+    if (mode == "off")
+        return quiver::FileLogMode::Off;
+    throw std::runtime_error("Unknown log file mode: " + mode);
+}
+
 int main(int argc, char* argv[]) {
     argparse::ArgumentParser program("quiver_cli", "quiver_cli " QUIVER_VERSION);
 
@@ -48,6 +59,7 @@ int main(int argc, char* argv[]) {
     program.add_argument("--migrations").help("create database from migrations directory");
 
     program.add_argument("--read-only").help("open database in read-only mode").flag();
+    program.add_argument("--immutable").help("open an archived database that is never written again").flag();
 
     program.add_argument("--dry-run")
         .help("run the script in a transaction and roll it back (scopes to the script only)")
@@ -57,6 +69,18 @@ int main(int argc, char* argv[]) {
         .help("set log verbosity (debug, info, warn, error, off)")
         .default_value(std::string("warn"));
 
+    program.add_argument("--log-file")
+        .help("how quiver_database.log is written (sync, async, off)")
+        .default_value(std::string("sync"));
+
+    program.add_argument("--trace-sql")
+        .help("log every SQL statement with its run time and row count (implies --log-level info or lower)")
+        .flag();
+
+    program.add_argument("--slow-sql-ms")
+        .help("with --trace-sql, only log statements that run at least this many milliseconds")
+        .scan<'g', double>();
+
     try {
         program.parse_args(argc, argv);
     } catch (const std::exception& e) {
@@ -77,6 +101,11 @@ int main(int argc, char* argv[]) {
         return 2;
     }
 
+    if (program.is_used("--slow-sql-ms") && !program.get<bool>("--trace-sql")) {
+        std::cerr << "Cannot use --slow-sql-ms without --trace-sql" << std::endl;
+        return 2;
+    }
+
     // Script required (for now) -- prepare for future REPL
     auto script_path = program.present<std::string>("script");
     if (!script_path) {
@@ -94,7 +123,17 @@ int main(int argc, char* argv[]) {
         // Configure database options
         quiver::DatabaseOptions options{};
         options.read_only = program.get<bool>("--read-only");
+        options.immutable = program.get<bool>("--immutable");
         options.console_level = parse_log_level(program.get<std::string>("--log-level"));
+        options.file_log = parse_file_log_mode(program.get<std::string>("--log-file"));
+        if (program.get<bool>("--trace-sql")) {
+            // Traced statements are logged at info level.
+            options.trace.enabled = true;
+            options.console_level = std::min(options.console_level, quiver::LogLevel::Info);
+            if (auto slow_ms = program.present<double>("--slow-sql-ms")) {
+                options.trace.slow_threshold_ns = static_cast<int64_t>(*slow_ms * 1e6);
+            }
+        }
 
         // Construct database (one of three modes)
         auto db_path = program.get<std::string>("database");
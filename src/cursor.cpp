@@ -0,0 +1,108 @@
+#include "quiver/cursor.h"
+
+#include "database_impl.h"
+
+#include <mutex>
+#include <sqlite3.h>
+#include <stdexcept>
+
+namespace quiver {
+
+Cursor::Cursor(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+Cursor::~Cursor() = default;
+
+Cursor::Cursor(Cursor&& other) noexcept = default;
+Cursor& Cursor::operator=(Cursor&& other) noexcept = default;
+
+bool Cursor::next() {
+    if (impl_->done) {
+        return false;
+    }
+    std::unique_lock<std::recursive_mutex> shared_access;
+    if (impl_->shared_access) {
+        shared_access = std::unique_lock(*impl_->shared_access);
+    }
+    const auto rc = sqlite3_step(impl_->stmt());
+    if (rc == SQLITE_ROW) {
+        impl_->has_row = true;
+        if (impl_->metrics) {
+            impl_->metrics->add_rows_read(1);
+        }
+        if (impl_->tracer) {
+            impl_->tracer->count_row(impl_->stmt());
+        }
+        return true;
+    }
+    impl_->has_row = false;
+    impl_->done = true;
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+    if (impl_->on_done) {
+        impl_->on_done();
+    }
+    return false;
+}
+
+const std::vector<std::string>& Cursor::columns() const {
+    return impl_->columns;
+}
+
+size_t Cursor::column_count() const {
+    return impl_->columns.size();
+}
+
+bool Cursor::is_null(size_t index) const {
+    return sqlite3_column_type(impl_->stmt(), impl_->column(index)) == SQLITE_NULL;
+}
+
+std::optional<int64_t> Cursor::get_integer(size_t index) const {
+    const auto col = impl_->column(index);
+    if (sqlite3_column_type(impl_->stmt(), col) == SQLITE_INTEGER) {
+        return sqlite3_column_int64(impl_->stmt(), col);
+    }
+    return std::nullopt;
+}
+
+std::optional<double> Cursor::get_float(size_t index) const {
+    const auto col = impl_->column(index);
+    // Same widening as Row::get_float: an INTEGER cell is accepted wherever a REAL is expected.
+    const auto type = sqlite3_column_type(impl_->stmt(), col);
+    if (type == SQLITE_FLOAT || type == SQLITE_INTEGER) {
+        return sqlite3_column_double(impl_->stmt(), col);
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> Cursor::get_string(size_t index) const {
+    const auto col = impl_->column(index);
+    if (sqlite3_column_type(impl_->stmt(), col) == SQLITE_TEXT) {
+        const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(impl_->stmt(), col));
+        const auto size = static_cast<size_t>(sqlite3_column_bytes(impl_->stmt(), col));
+        return std::string(text ? text : "", text ? size : 0);
+    }
+    return std::nullopt;
+}
+
+Value Cursor::get_value(size_t index) const {
+    const auto col = impl_->column(index);
+    switch (sqlite3_column_type(impl_->stmt(), col)) {
+    case SQLITE_INTEGER:
+        return sqlite3_column_int64(impl_->stmt(), col);
+    case SQLITE_FLOAT:
+        return sqlite3_column_double(impl_->stmt(), col);
+    case SQLITE_TEXT: {
+        const char* text = reinterpret_cast<const char*>(sqlite3_column_text(impl_->stmt(), col));
+        return std::string(text ? text : "");
+    }
+    case SQLITE_NULL:
+        return nullptr;
+    case SQLITE_BLOB:
+        throw std::runtime_error("Failed to execute statement: BLOB type not supported");
+    default:
+        throw std::runtime_error("Failed to execute statement: unknown column type");
+    }
+}
+
+}  // namespace quiver
@@ -4,9 +4,12 @@
 #include "utils/string.h"
 
 #include <atomic>
+#include <cctype>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <mutex>
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
@@ -40,7 +43,15 @@ spdlog::level::level_enum to_spdlog_level(quiver::LogLevel level) {
     }
 }
 
-std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_path, quiver::LogLevel console_level) {
+// Shared by every Async database logger: one writer thread behind a bounded ring of pending lines.
+std::shared_ptr<spdlog::details::thread_pool> async_log_pool() {
+    static constexpr size_t kQueueSize = 8192;
+    static const auto pool = std::make_shared<spdlog::details::thread_pool>(kQueueSize, 1);
+    return pool;
+}
+
+std::shared_ptr<spdlog::logger>
+create_database_logger(const std::string& db_path, quiver::LogLevel console_level, quiver::FileLogMode file_log) {
     namespace fs = std::filesystem;
 
     // Generate unique logger name for multiple Database instances
@@ -51,60 +62,233 @@ std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_pat
     auto console_sink = std::make_shared<spdlog::sinks::stderr_color_sink_mt>();
     console_sink->set_level(to_spdlog_level(console_level));
 
+    // Without a file sink the logger level is the console level, so the QLOG_* macros skip
+    // disabled levels before evaluating any argument.
+    const auto console_only = [&](const std::string& warning) {
+        auto logger = std::make_shared<spdlog::logger>(logger_name, console_sink);
+        logger->set_level(to_spdlog_level(console_level));
+        if (!warning.empty()) {
+            logger->warn(warning);
+        }
+        return logger;
+    };
+
     if (db_path == ":memory:") {
-        // In-memory database: no file logging
-        const auto logger = std::make_shared<spdlog::logger>(logger_name, console_sink);
+        return console_only("Database is in-memory only; no file logging will be performed.");
+    }
+    if (file_log == quiver::FileLogMode::Off) {
+        return console_only("");
+    }
+
+    // File-based database: use database directory
+    auto db_dir = fs::path(db_path).parent_path();
+    if (db_dir.empty()) {
+        // Database file in current directory (no path separator)
+        db_dir = fs::current_path();
+    }
+
+    // Create file sink (thread-safe)
+    try {
+        const auto log_file_path = (db_dir / "quiver_database.log").string();
+        auto file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_file_path, true);
+        file_sink->set_level(spdlog::level::debug);
+
+        std::vector<spdlog::sink_ptr> sinks{console_sink, file_sink};
+        std::shared_ptr<spdlog::logger> logger;
+        if (file_log == quiver::FileLogMode::Async) {
+            logger = std::make_shared<spdlog::async_logger>(logger_name,
+                                                            sinks.begin(),
+                                                            sinks.end(),
+                                                            async_log_pool(),
+                                                            spdlog::async_overflow_policy::overrun_oldest);
+        } else {
+            logger = std::make_shared<spdlog::logger>(logger_name, sinks.begin(), sinks.end());
+        }
         logger->set_level(spdlog::level::debug);
-        logger->warn("Database is in-memory only; no file logging will be performed.");
         return logger;
-    } else {
-        // File-based database: use database directory
-        auto db_dir = fs::path(db_path).parent_path();
-        if (db_dir.empty()) {
-            // Database file in current directory (no path separator)
-            db_dir = fs::current_path();
+    } catch (const spdlog::spdlog_ex& ex) {
+        // If file sink creation fails, continue with console-only logging
+        return console_only(std::string("Failed to create file sink: ") + ex.what() + ". Logging to console only.");
+    }
+}
+
+const char* journal_mode_pragma(quiver::JournalMode mode) {
+    switch (mode) {
+    case quiver::JournalMode::Delete:
+        return "DELETE";
+    case quiver::JournalMode::Wal:
+        return "WAL";
+    case quiver::JournalMode::Memory:
+        return "MEMORY";
+    case quiver::JournalMode::Off:
+        return "OFF";
+    default:
+        return nullptr;
+    }
+}
+
+const char* synchronous_pragma(quiver::Synchronous synchronous) {
+    switch (synchronous) {
+    case quiver::Synchronous::Off:
+        return "OFF";
+    case quiver::Synchronous::Normal:
+        return "NORMAL";
+    case quiver::Synchronous::Full:
+        return "FULL";
+    case quiver::Synchronous::Extra:
+        return "EXTRA";
+    default:
+        return nullptr;
+    }
+}
+
+const char* temp_store_pragma(quiver::TempStore temp_store) {
+    switch (temp_store) {
+    case quiver::TempStore::File:
+        return "FILE";
+    case quiver::TempStore::Memory:
+        return "MEMORY";
+    default:
+        return nullptr;
+    }
+}
+
+void exec_pragma(sqlite3* db, const std::string& pragma) {
+    char* err_msg = nullptr;
+    if (sqlite3_exec(db, pragma.c_str(), nullptr, nullptr, &err_msg) != SQLITE_OK) {
+        std::string error = err_msg ? err_msg : "Unknown error";
+        sqlite3_free(err_msg);
+        throw std::runtime_error("Failed to apply connection profile: " + pragma + ": " + error);
+    }
+}
+
+// path as a "file:" URI with immutable=1. The path is made absolute and follows an empty authority
+// ("file:///C:/...", "file:///home/...", "file:////server/share/..." for a UNC path): SQLite
+// rejects any authority but localhost, so a UNC host must stay in the path. Windows separators
+// become '/' and characters with a meaning in URIs are percent-encoded.
+std::string immutable_uri(const std::string& path) {
+    const auto absolute = std::filesystem::absolute(path).generic_string();
+    std::string uri = absolute.starts_with('/') ? "file://" : "file:///";
+    for (const auto c : absolute) {
+        switch (c) {
+        case '%':
+            uri += "%25";
+            break;
+        case '?':
+            uri += "%3f";
+            break;
+        case '#':
+            uri += "%23";
+            break;
+        default:
+            uri += c;
         }
+    }
+    return uri + "?immutable=1";
+}
 
-        // Create file sink (thread-safe)
-        std::shared_ptr<spdlog::sinks::basic_file_sink_mt> file_sink = nullptr;
-        try {
-            const auto log_file_path = (db_dir / "quiver_database.log").string();
-            file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_file_path, true);
-            file_sink->set_level(spdlog::level::debug);
-
-            std::vector<spdlog::sink_ptr> sinks{console_sink, file_sink};
-            auto logger = std::make_shared<spdlog::logger>(logger_name, sinks.begin(), sinks.end());
-            logger->set_level(spdlog::level::debug);
-
-            return logger;
-        } catch (const spdlog::spdlog_ex& ex) {
-            // If file sink creation fails, continue with console-only logging
-            const auto logger = std::make_shared<spdlog::logger>(logger_name, console_sink);
-            logger->set_level(spdlog::level::debug);
-            logger->warn("Failed to create file sink: {}. Logging to console only.", ex.what());
-            return logger;
+void apply_connection_profile(sqlite3* db,
+                              spdlog::logger& logger,
+                              const quiver::ConnectionProfile& profile,
+                              bool read_only) {
+    if (profile.cache_size_kib < 0 || profile.mmap_size < 0) {
+        throw std::runtime_error("Failed to apply connection profile: cache_size_kib and mmap_size must be >= 0");
+    }
+
+    // The journal mode is a property of the file and switching it needs a write, so a read-only
+    // connection keeps whatever the file already uses.
+    if (const auto* mode = journal_mode_pragma(profile.journal_mode); mode && !read_only) {
+        // journal_mode answers with the mode actually in effect: an in-memory database, for one,
+        // stays "memory" whatever is asked for.
+        sqlite3_stmt* raw_stmt = nullptr;
+        const auto sql = std::string("PRAGMA journal_mode = ") + mode + ";";
+        if (sqlite3_prepare_v2(db, sql.c_str(), -1, &raw_stmt, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Failed to apply connection profile: " + std::string(sqlite3_errmsg(db)));
+        }
+        quiver::StmtPtr stmt(raw_stmt, sqlite3_finalize);
+        if (sqlite3_step(stmt.get()) != SQLITE_ROW) {
+            throw std::runtime_error("Failed to apply connection profile: " + std::string(sqlite3_errmsg(db)));
+        }
+        const auto* applied = reinterpret_cast<const char*>(sqlite3_column_text(stmt.get(), 0));
+        if (!applied || sqlite3_stricmp(applied, mode) != 0) {
+            QLOG_WARN(logger, "journal_mode {} not applied; database reports {}", mode, applied ? applied : "unknown");
         }
     }
+    if (const auto* synchronous = synchronous_pragma(profile.synchronous)) {
+        exec_pragma(db, std::string("PRAGMA synchronous = ") + synchronous + ";");
+    }
+    if (const auto* temp_store = temp_store_pragma(profile.temp_store)) {
+        exec_pragma(db, std::string("PRAGMA temp_store = ") + temp_store + ";");
+    }
+    if (profile.cache_size_kib > 0) {
+        // A negative cache_size is a size in KiB rather than a page count.
+        exec_pragma(db, "PRAGMA cache_size = -" + std::to_string(profile.cache_size_kib) + ";");
+    }
+    if (profile.mmap_size > 0) {
+        exec_pragma(db, "PRAGMA mmap_size = " + std::to_string(profile.mmap_size) + ";");
+    }
 }
 
 }  // anonymous namespace
 
 namespace quiver {
 
-Database::Database(const std::string& path, const DatabaseOptions& options) : impl_(std::make_unique<Impl>()) {
+ConnectionProfile ConnectionProfile::bulk_load() {
+    return {
+        .journal_mode = JournalMode::Wal,
+        .synchronous = Synchronous::Off,
+        .temp_store = TempStore::Memory,
+        .cache_size_kib = 256 * 1024,
+        .mmap_size = 0,
+    };
+}
+
+ConnectionProfile ConnectionProfile::read_mostly() {
+    return {
+        .journal_mode = JournalMode::Wal,
+        .synchronous = Synchronous::Normal,
+        .temp_store = TempStore::Memory,
+        .cache_size_kib = 64 * 1024,
+        .mmap_size = int64_t{1} << 30,
+    };
+}
+
+ConnectionProfile ConnectionProfile::durable() {
+    return {
+        .journal_mode = JournalMode::Wal,
+        .synchronous = Synchronous::Full,
+        .temp_store = TempStore::Default,
+        .cache_size_kib = 0,
+        .mmap_size = 0,
+    };
+}
+
+Database::Database(const std::string& path, const DatabaseOptions& options) : Database(path, options, nullptr) {}
+
+Database::Database(const std::string& path, const DatabaseOptions& options, const Database* schema_source)
+    : impl_(std::make_unique<Impl>()) {
+    if (options.immutable && (path.empty() || path == ":memory:")) {
+        throw std::runtime_error("Cannot open database: an in-memory database cannot be immutable");
+    }
     impl_->path = path;
-    impl_->logger = create_database_logger(path, options.console_level);
+    impl_->logger = create_database_logger(path, options.console_level, options.file_log);
 
-    impl_->logger->debug("Opening database: {}", path);
+    QLOG_DEBUG(impl_->logger, "Opening database: {}", path);
 
     ensure_sqlite3_initialized();
 
-    auto flags = options.read_only ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
-    const auto rc = sqlite3_open_v2(path.c_str(), &impl_->db, flags, nullptr);
+    const auto read_only = options.read_only || options.immutable;
+    auto flags = read_only ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+    // The URI form carries immutable=1; a serialized connection is what lets threads share it.
+    const auto open_path = options.immutable ? immutable_uri(path) : path;
+    if (options.immutable) {
+        flags |= SQLITE_OPEN_URI | SQLITE_OPEN_FULLMUTEX;
+    }
+    const auto rc = sqlite3_open_v2(open_path.c_str(), &impl_->db, flags, nullptr);
 
     if (rc != SQLITE_OK) {
         std::string error_msg = impl_->db ? sqlite3_errmsg(impl_->db) : "Unknown error";
-        impl_->logger->error("Failed to open database: {}", error_msg);
+        QLOG_ERROR(impl_->logger, "Failed to open database: {}", error_msg);
         if (impl_->db) {
             sqlite3_close(impl_->db);
             impl_->db = nullptr;
@@ -114,9 +298,42 @@ Database::Database(const std::string& path, const DatabaseOptions& options) : im
 
     // Enable foreign keys
     sqlite3_exec(impl_->db, "PRAGMA foreign_keys = ON;", nullptr, nullptr, nullptr);
-    impl_->logger->debug("Database opened successfully, foreign keys enabled");
+    QLOG_DEBUG(impl_->logger, "Database opened successfully, foreign keys enabled");
+
+    auto profile = options.profile;
+    if (options.immutable && profile.mmap_size == 0) {
+        // Map the whole file: nothing will write to it, so reads can come straight from the page cache.
+        std::error_code ignored;
+        const auto file_size = std::filesystem::file_size(path, ignored);
+        profile.mmap_size = ignored ? 0 : static_cast<int64_t>(file_size);
+    }
+    apply_connection_profile(impl_->db, *impl_->logger, profile, read_only);
 
-    impl_->logger->info("Database opened successfully: {}", path);
+    // Keep the FK label cache and the change feed coherent with every write, commit and rollback on
+    // this connection.
+    sqlite3_update_hook(impl_->db, &Impl::on_row_change, impl_.get());
+    sqlite3_commit_hook(impl_->db, &Impl::on_commit, impl_.get());
+    sqlite3_rollback_hook(impl_->db, &Impl::on_rollback, impl_.get());
+
+    if (options.trace.enabled) {
+        impl_->tracer = std::make_unique<SqlTracer>(options.trace);
+        sqlite3_trace_v2(impl_->db, SQLITE_TRACE_PROFILE, &Impl::on_trace, impl_.get());
+        QLOG_DEBUG(impl_->logger, "SQL trace enabled, slow threshold {} ns", options.trace.slow_threshold_ns);
+    }
+
+    if (schema_source) {
+        impl_->schema = schema_source->impl_->schema;
+        impl_->type_validator = schema_source->impl_->type_validator;
+    }
+    if (options.immutable) {
+        // Loaded now rather than on first use: nothing can change it, and a const reader on another
+        // thread must never be the one to fill it in.
+        impl_->require_schema();
+        impl_->immutable = true;
+        QLOG_DEBUG(impl_->logger, "Database opened immutable, mmap_size {}", profile.mmap_size);
+    }
+
+    QLOG_INFO(impl_->logger, "Database opened successfully: {}", path);
 }
 
 Database::~Database() = default;
@@ -128,23 +345,41 @@ bool Database::is_healthy() const {
     return impl_ && impl_->db != nullptr;
 }
 
-Result Database::execute(const std::string& sql, const std::vector<Value>& parameters) {
-    sqlite3_stmt* raw_stmt = nullptr;
-    auto rc = sqlite3_prepare_v2(impl_->db, sql.c_str(), -1, &raw_stmt, nullptr);
-    if (rc != SQLITE_OK) {
-        throw std::runtime_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(impl_->db)));
-    }
-    StmtPtr stmt(raw_stmt, sqlite3_finalize);
+StatementCacheStats Database::statement_cache_stats() const {
+    const auto lock = impl_->lock_shared_access();
+    return {
+        .hits = impl_->statements.hits(),
+        .misses = impl_->statements.misses(),
+        .size = impl_->statements.size(),
+        .capacity = impl_->statements.capacity(),
+    };
+}
+
+LabelCacheStats Database::label_cache_stats() const {
+    const auto lock = impl_->lock_shared_access();
+    return {
+        .hits = impl_->labels.hits(),
+        .misses = impl_->labels.misses(),
+        .size = impl_->labels.size(),
+    };
+}
+
+namespace {
 
+// Bind parameters in order. Strings are trimmed by view and bound with the given lifetime:
+// SQLITE_STATIC when the caller guarantees parameters outlive every step of the statement (and
+// its release back to the cache, which clears the bindings), SQLITE_TRANSIENT otherwise.
+// Returns the bound payload in bytes, for Database::stats().
+int64_t bind_parameters(sqlite3_stmt* stmt, std::span<const Value> parameters, sqlite3_destructor_type text_lifetime) {
     // Reject a parameter-count mismatch loudly: too few would bind NULL to the trailing
     // placeholder, too many would silently ignore the extras.
-    const auto expected_parameters = static_cast<size_t>(sqlite3_bind_parameter_count(stmt.get()));
+    const auto expected_parameters = static_cast<size_t>(sqlite3_bind_parameter_count(stmt));
     if (expected_parameters != parameters.size()) {
         throw std::runtime_error("Failed to execute statement: expected " + std::to_string(expected_parameters) +
                                  " bound parameter(s) but got " + std::to_string(parameters.size()));
     }
 
-    // Bind parameters
+    int64_t bytes = 0;
     for (size_t i = 0; i < parameters.size(); ++i) {
         const auto idx = static_cast<int>(i + 1);
         const auto& parameter = parameters[i];
@@ -153,73 +388,149 @@ Result Database::execute(const std::string& sql, const std::vector<Value>& param
             [&](auto&& arg) {
                 using T = std::decay_t<decltype(arg)>;
                 if constexpr (std::is_same_v<T, std::nullptr_t>) {
-                    sqlite3_bind_null(stmt.get(), idx);
+                    sqlite3_bind_null(stmt, idx);
                 } else if constexpr (std::is_same_v<T, int64_t>) {
-                    sqlite3_bind_int64(stmt.get(), idx, arg);
+                    sqlite3_bind_int64(stmt, idx, arg);
+                    bytes += sizeof(arg);
                 } else if constexpr (std::is_same_v<T, double>) {
-                    sqlite3_bind_double(stmt.get(), idx, arg);
+                    sqlite3_bind_double(stmt, idx, arg);
+                    bytes += sizeof(arg);
                 } else if constexpr (std::is_same_v<T, std::string>) {
-                    auto trimmed = string::trim(arg);
-                    sqlite3_bind_text(stmt.get(),
-                                      idx,
-                                      trimmed.c_str(),
-                                      static_cast<int>(trimmed.size()),
-                                      SQLITE_TRANSIENT);  // NOLINT(performance-no-int-to-ptr) SQLite macro
+                    // An empty view may have a null data(), which SQLite would bind as NULL, not ''.
+                    const auto trimmed = string::trim_view(arg);
+                    const char* text = trimmed.empty() ? "" : trimmed.data();
+                    sqlite3_bind_text(stmt, idx, text, static_cast<int>(trimmed.size()), text_lifetime);
+                    bytes += static_cast<int64_t>(trimmed.size());
                 }
             },
             parameter);
     }
+    return bytes;
+}
+
+// The next whitespace-separated word of sql, consumed from it along with any whitespace and
+// comments before it; empty once sql is exhausted.
+std::string_view take_word(std::string_view& sql) {
+    while (true) {
+        sql = sql.substr(std::min(sql.size(), sql.find_first_not_of(" \t\n\r")));
+        if (sql.starts_with("--")) {
+            sql = sql.substr(std::min(sql.size(), sql.find('\n')));
+        } else if (sql.starts_with("/*")) {
+            const auto end = sql.find("*/", 2);
+            sql = end == std::string_view::npos ? std::string_view() : sql.substr(end + 2);
+        } else {
+            break;
+        }
+    }
+    const auto word = sql.substr(0, sql.find_first_of(" \t\n\r;"));
+    sql.remove_prefix(word.size());
+    return word;
+}
+
+bool is_keyword(std::string_view word, std::string_view keyword) {
+    return std::equal(word.begin(), word.end(), keyword.begin(), keyword.end(), [](char a, char b) {
+        return std::toupper(static_cast<unsigned char>(a)) == b;
+    });
+}
+
+}  // namespace
+
+std::optional<SavepointStatement> parse_savepoint(std::string_view sql) {
+    auto word = take_word(sql);
+    SavepointStatement statement{};
+    if (is_keyword(word, "SAVEPOINT")) {
+        statement.kind = SavepointStatement::Kind::Begin;
+    } else if (is_keyword(word, "RELEASE")) {
+        statement.kind = SavepointStatement::Kind::Release;
+    } else if (is_keyword(word, "ROLLBACK")) {
+        statement.kind = SavepointStatement::Kind::RollbackTo;
+        word = take_word(sql);
+        if (is_keyword(word, "TRANSACTION")) {
+            word = take_word(sql);
+        }
+        if (!is_keyword(word, "TO")) {
+            return std::nullopt;  // a plain ROLLBACK, which the rollback hook sees
+        }
+    } else {
+        return std::nullopt;
+    }
+
+    word = take_word(sql);
+    if (statement.kind != SavepointStatement::Kind::Begin && is_keyword(word, "SAVEPOINT")) {
+        word = take_word(sql);
+    }
+    if (word.size() >= 2 && (word.front() == '"' || word.front() == '`' || word.front() == '[' || word.front() == '\'')) {
+        word = word.substr(1, word.size() - 2);
+    }
+    if (word.empty()) {
+        return std::nullopt;
+    }
+    statement.name.reserve(word.size());
+    for (const auto c : word) {
+        statement.name.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+    return statement;
+}
 
-    // Get column info
-    std::vector<std::string> columns;
-    const auto col_count = sqlite3_column_count(stmt.get());
-    columns.reserve(col_count);
+Cursor Database::prepare_cursor(const std::string& sql, std::span<const Value> parameters, bool borrow_text) {
+    auto state = std::make_unique<Cursor::Impl>(impl_->statements, impl_->db, sql);
+    const auto text_lifetime =
+        borrow_text ? SQLITE_STATIC : SQLITE_TRANSIENT;  // NOLINT(performance-no-int-to-ptr) SQLite macro
+    impl_->metrics.add_bytes_bound(bind_parameters(state->stmt(), parameters, text_lifetime));
+    state->metrics = &impl_->metrics;
+    state->tracer = impl_->tracer.get();
+    if (impl_->immutable) {
+        state->shared_access = &impl_->shared_access;
+    }
+    if (auto savepoint = parse_savepoint(sql)) {
+        state->on_done = [impl = impl_.get(), savepoint = std::move(*savepoint)] { impl->on_savepoint(savepoint); };
+    }
+
+    const auto col_count = sqlite3_column_count(state->stmt());
+    state->columns.reserve(col_count);
     for (int i = 0; i < col_count; ++i) {
-        const char* name = sqlite3_column_name(stmt.get(), i);
-        columns.emplace_back(name ? name : "");
+        const char* name = sqlite3_column_name(state->stmt(), i);
+        state->columns.emplace_back(name ? name : "");
     }
+    return Cursor(std::move(state));
+}
+
+// The cursor outlives this call, and often the parameters too (a braced temporary), so its text
+// parameters are copied by SQLite.
+Cursor Database::cursor(const std::string& sql, const std::vector<Value>& parameters) {
+    const auto tracked = impl_->track("cursor");
+    return prepare_cursor(sql, parameters, false);
+}
+
+Result Database::execute(const std::string& sql, const std::vector<Value>& parameters) {
+    const auto tracked = impl_->track("execute");
+    return execute(sql, std::span<const Value>(parameters));
+}
+
+Result Database::execute(const std::string& sql, std::span<const Value> parameters) {
+    const auto tracked = impl_->track("execute");
+    // The cursor is drained and destroyed before returning, so parameters outlive it and text is
+    // bound in place instead of being copied into SQLite.
+    auto rows_cursor = prepare_cursor(sql, parameters, true);
+    const auto col_count = rows_cursor.column_count();
 
-    // Execute and fetch results
     std::vector<Row> rows;
-    while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+    while (rows_cursor.next()) {
         std::vector<Value> values;
         values.reserve(col_count);
-
-        for (int i = 0; i < col_count; ++i) {
-            auto type = sqlite3_column_type(stmt.get(), i);
-            switch (type) {
-            case SQLITE_INTEGER:
-                values.emplace_back(sqlite3_column_int64(stmt.get(), i));
-                break;
-            case SQLITE_FLOAT:
-                values.emplace_back(sqlite3_column_double(stmt.get(), i));
-                break;
-            case SQLITE_TEXT: {
-                const char* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt.get(), i));
-                values.emplace_back(std::string(text ? text : ""));
-                break;
-            }
-            case SQLITE_NULL:
-                values.emplace_back(nullptr);
-                break;
-            case SQLITE_BLOB:
-                throw std::runtime_error("Failed to execute statement: BLOB type not supported");
-            default:
-                throw std::runtime_error("Failed to execute statement: unknown column type");
-                break;
-            }
+        for (size_t i = 0; i < col_count; ++i) {
+            values.push_back(rows_cursor.get_value(i));
         }
         rows.emplace_back(std::move(values));
     }
+    // Outside a transaction the statement has just committed on its own.
+    impl_->publish_changes();
 
-    if (rc != SQLITE_DONE) {
-        throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(impl_->db)));
-    }
-
-    return {std::move(columns), std::move(rows)};
+    return {rows_cursor.columns(), std::move(rows)};
 }
 
 int64_t Database::current_version() const {
+    const auto tracked = impl_->track("current_version");
     sqlite3_stmt* raw_stmt = nullptr;
     const char* sql = "PRAGMA user_version;";
     auto rc = sqlite3_prepare_v2(impl_->db, sql, -1, &raw_stmt, nullptr);
@@ -243,7 +554,7 @@ Database Database::from_migrations(const std::string& db_path,
                                    const std::string& migrations_path,
                                    const DatabaseOptions& options) {
     namespace fs = std::filesystem;
-    if (options.read_only) {
+    if (options.read_only || options.immutable) {
         throw std::runtime_error("Cannot from_migrations: read_only mode (use Database constructor to open existing)");
     }
     if (!fs::exists(migrations_path)) {
@@ -260,7 +571,7 @@ Database Database::from_migrations(const std::string& db_path,
 Database
 Database::from_schema(const std::string& db_path, const std::string& schema_path, const DatabaseOptions& options) {
     namespace fs = std::filesystem;
-    if (options.read_only) {
+    if (options.read_only || options.immutable) {
         throw std::runtime_error("Cannot from_schema: read_only mode (use Database constructor to open existing)");
     }
     if (!fs::exists(schema_path)) {
@@ -274,6 +585,83 @@ Database::from_schema(const std::string& db_path, const std::string& schema_path
     return db;
 }
 
+namespace {
+
+// Copies every page of from's main database into to's with the SQLite backup API.
+void backup_database(sqlite3* from, sqlite3* to, const char* caller) {
+    auto* backup = sqlite3_backup_init(to, "main", from, "main");
+    if (!backup) {
+        throw std::runtime_error(std::string("Cannot ") + caller + ": " + sqlite3_errmsg(to));
+    }
+    const auto step_rc = sqlite3_backup_step(backup, -1);
+    const auto finish_rc = sqlite3_backup_finish(backup);
+    if (step_rc != SQLITE_DONE || finish_rc != SQLITE_OK) {
+        throw std::runtime_error(std::string("Cannot ") + caller + ": " + sqlite3_errmsg(to));
+    }
+}
+
+using ConnectionPtr = std::unique_ptr<sqlite3, decltype(&sqlite3_close)>;
+
+ConnectionPtr open_connection(const std::string& path, int flags, const char* caller) {
+    sqlite3* raw_db = nullptr;
+    const auto rc = sqlite3_open_v2(path.c_str(), &raw_db, flags, nullptr);
+    ConnectionPtr connection(raw_db, sqlite3_close);
+    if (rc != SQLITE_OK) {
+        std::string error = raw_db ? sqlite3_errmsg(raw_db) : "Unknown error";
+        throw std::runtime_error(std::string("Cannot ") + caller + ": failed to open " + path + ": " + error);
+    }
+    return connection;
+}
+
+}  // namespace
+
+Database Database::open_in_memory_copy(const std::string& path, const DatabaseOptions& options) {
+    namespace fs = std::filesystem;
+    if (!fs::exists(path)) {
+        throw std::runtime_error("Cannot open_in_memory_copy: file not found: " + path);
+    }
+
+    auto memory_options = options;
+    memory_options.read_only = false;
+    memory_options.immutable = false;
+    auto db = Database(":memory:", memory_options);
+    {
+        auto source = open_connection(path, SQLITE_OPEN_READONLY, "open_in_memory_copy");
+        backup_database(source.get(), db.impl_->db, "open_in_memory_copy");
+    }
+    if (options.read_only || options.immutable) {
+        sqlite3_exec(db.impl_->db, "PRAGMA query_only = ON;", nullptr, nullptr, nullptr);
+    }
+    db.impl_->require_schema();
+    db.impl_->immutable = options.immutable;
+    QLOG_INFO(db.impl_->logger, "Loaded in-memory copy of {}", path);
+    return db;
+}
+
+void Database::save_to(const std::string& path) {
+    const auto tracked = impl_->track("save_to");
+    namespace fs = std::filesystem;
+    // A backup taken mid-transaction would carry the uncommitted pages of this connection.
+    if (in_transaction()) {
+        throw std::runtime_error("Cannot save_to: transaction already active");
+    }
+
+    const auto temp_path = path + ".tmp";
+    fs::remove(temp_path);
+    try {
+        {
+            auto target = open_connection(temp_path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, "save_to");
+            backup_database(impl_->db, target.get(), "save_to");
+        }
+        fs::rename(temp_path, path);
+    } catch (...) {
+        std::error_code ignored;
+        fs::remove(temp_path, ignored);
+        throw;
+    }
+    QLOG_INFO(impl_->logger, "Saved database to {}", path);
+}
+
 void Database::set_version(int64_t version) {
     const auto sql = "PRAGMA user_version = " + std::to_string(version) + ";";
     char* err_msg = nullptr;
@@ -283,10 +671,11 @@ void Database::set_version(int64_t version) {
         sqlite3_free(err_msg);
         throw std::runtime_error("Failed to set user_version: " + error);
     }
-    impl_->logger->debug("Set database version to {}", version);
+    QLOG_DEBUG(impl_->logger, "Set database version to {}", version);
 }
 
 void Database::begin_transaction() {
+    const auto tracked = impl_->track("begin_transaction");
     if (impl_->dry_run) {
         return;  // absorbed: the dry run already owns the transaction
     }
@@ -294,7 +683,7 @@ void Database::begin_transaction() {
         throw std::runtime_error("Cannot begin_transaction: transaction already active");
     }
     impl_->begin_transaction();
-    impl_->logger->debug("User transaction started");
+    QLOG_DEBUG(impl_->logger, "User transaction started");
 }
 
 bool Database::in_transaction() const {
@@ -302,6 +691,7 @@ bool Database::in_transaction() const {
 }
 
 void Database::commit() {
+    const auto tracked = impl_->track("commit");
     if (impl_->dry_run) {
         return;  // absorbed: end_dry_run decides, and it always rolls back
     }
@@ -309,10 +699,11 @@ void Database::commit() {
         throw std::runtime_error("Cannot commit: no active transaction");
     }
     impl_->commit();
-    impl_->logger->debug("User transaction committed");
+    QLOG_DEBUG(impl_->logger, "User transaction committed");
 }
 
 void Database::rollback() {
+    const auto tracked = impl_->track("rollback");
     if (impl_->dry_run) {
         return;  // absorbed: end_dry_run undoes everything anyway
     }
@@ -320,10 +711,11 @@ void Database::rollback() {
         throw std::runtime_error("Cannot rollback: no active transaction");
     }
     impl_->rollback();
-    impl_->logger->debug("User transaction rolled back");
+    QLOG_DEBUG(impl_->logger, "User transaction rolled back");
 }
 
 void Database::begin_dry_run() {
+    const auto tracked = impl_->track("begin_dry_run");
     if (impl_->dry_run) {
         throw std::runtime_error("Cannot begin_dry_run: dry run already active");
     }
@@ -332,10 +724,11 @@ void Database::begin_dry_run() {
     }
     impl_->begin_transaction();
     impl_->dry_run = true;
-    impl_->logger->debug("Dry run started");
+    QLOG_DEBUG(impl_->logger, "Dry run started");
 }
 
 void Database::end_dry_run() {
+    const auto tracked = impl_->track("end_dry_run");
     if (!impl_->dry_run) {
         throw std::runtime_error("Cannot end_dry_run: no active dry run");
     }
@@ -350,7 +743,7 @@ void Database::end_dry_run() {
         }
     }
     impl_->dry_run = false;
-    impl_->logger->debug("Dry run rolled back");
+    QLOG_DEBUG(impl_->logger, "Dry run rolled back");
 }
 
 bool Database::in_dry_run() const {
@@ -358,6 +751,9 @@ bool Database::in_dry_run() const {
 }
 
 void Database::execute_raw(const std::string& sql) {
+    const auto tracked = impl_->track("execute_raw");
+    // Schema scripts and migrations can rename, drop or rewrite tables without firing the row hooks.
+    impl_->labels.clear();
     char* err_msg = nullptr;
     const auto rc = sqlite3_exec(impl_->db, sql.c_str(), nullptr, nullptr, &err_msg);
     if (rc != SQLITE_OK) {
@@ -365,12 +761,13 @@ void Database::execute_raw(const std::string& sql) {
         sqlite3_free(err_msg);
         throw std::runtime_error("Failed to execute SQL: " + error);
     }
+    impl_->publish_changes();
 }
 
 void Database::migrate_up(const std::string& migrations_path) {
     const auto migrations = Migrations(migrations_path);
     if (migrations.empty()) {
-        impl_->logger->debug("No migrations found in {}", migrations_path);
+        QLOG_DEBUG(impl_->logger, "No migrations found in {}", migrations_path);
         return;
     }
 
@@ -378,15 +775,21 @@ void Database::migrate_up(const std::string& migrations_path) {
     const auto pending = migrations.pending(current);
 
     if (pending.empty()) {
-        impl_->logger->debug("Database is up to date at version {}", current);
+        QLOG_DEBUG(impl_->logger, "Database is up to date at version {}", current);
         return;
     }
 
-    impl_->logger->info(
-        "Applying {} pending migration(s) from version {} to {}", pending.size(), current, migrations.latest_version());
+    QLOG_INFO(impl_->logger,
+              "Applying {} pending migration(s) from version {} to {}",
+              pending.size(),
+              current,
+              migrations.latest_version());
+
+    // Cached statements were compiled against the schema the migrations are about to change.
+    impl_->statements.clear();
 
     for (const auto& migration : pending) {
-        impl_->logger->info("Applying migration {}", migration.version());
+        QLOG_INFO(impl_->logger, "Applying migration {}", migration.version());
 
         const auto up_sql = migration.up_sql();
         if (up_sql.empty()) {
@@ -399,17 +802,21 @@ void Database::migrate_up(const std::string& migrations_path) {
             execute_raw(up_sql);
             set_version(migration.version());
             impl_->commit();
-            impl_->logger->info("Migration {} applied successfully", migration.version());
+            QLOG_INFO(impl_->logger, "Migration {} applied successfully", migration.version());
         } catch (const std::exception& e) {
             impl_->rollback();
-            impl_->logger->error("Migration {} failed: {}", migration.version(), e.what());
+            QLOG_ERROR(impl_->logger, "Migration {} failed: {}", migration.version(), e.what());
             throw std::runtime_error("Failed to migrate_up: migration " + std::to_string(migration.version()) + ": " +
                                      e.what());
         }
     }
 
-    impl_->load_schema_metadata();
-    impl_->logger->info("All migrations applied successfully. Database now at version {}", current_version());
+    {
+        Impl::TransactionGuard txn(*impl_);
+        impl_->load_schema_metadata(true);
+        txn.commit();
+    }
+    QLOG_INFO(impl_->logger, "All migrations applied successfully. Database now at version {}", current_version());
 }
 
 void Database::apply_schema(const std::string& schema_path) {
@@ -426,20 +833,49 @@ void Database::apply_schema(const std::string& schema_path) {
         throw std::runtime_error("Cannot apply_schema: schema file is empty: " + schema_path);
     }
 
-    impl_->logger->info("Applying schema from: {}", schema_path);
+    QLOG_INFO(impl_->logger, "Applying schema from: {}", schema_path);
+
+    impl_->statements.clear();
 
     impl_->begin_transaction();
     try {
         execute_raw(schema_sql);
-        impl_->load_schema_metadata();
+        impl_->load_schema_metadata(true);
         impl_->commit();
     } catch (const std::exception& e) {
         impl_->rollback();
-        impl_->logger->error("Failed to apply schema: {}", e.what());
+        QLOG_ERROR(impl_->logger, "Failed to apply schema: {}", e.what());
         throw;
     }
 
-    impl_->logger->info("Schema applied successfully");
+    QLOG_INFO(impl_->logger, "Schema applied successfully");
+}
+
+std::vector<MissingIndex> Database::missing_indexes() const {
+    const auto lock = impl_->lock_shared_access();
+    impl_->require_schema();
+    return IndexAdvisor(*impl_->schema).missing_indexes();
+}
+
+std::vector<MissingIndex> Database::ensure_indexes() {
+    const auto tracked = impl_->track("ensure_indexes");
+    impl_->require_writable("ensure_indexes");
+    auto missing = missing_indexes();
+    if (missing.empty()) {
+        return missing;
+    }
+    if (sqlite3_db_readonly(impl_->db, "main") == 1) {
+        throw std::runtime_error("Cannot ensure_indexes: database is read-only");
+    }
+
+    Impl::TransactionGuard txn(*impl_);
+    for (const auto& index : missing) {
+        execute_raw(index.create_sql());
+        QLOG_INFO(impl_->logger, "Created index {} on {}", index.index_name(), index.table);
+    }
+    impl_->load_schema_metadata(true);
+    txn.commit();
+    return missing;
 }
 
 }  // namespace quiver
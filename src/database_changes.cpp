@@ -0,0 +1,151 @@
+#include "database_impl.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+namespace quiver {
+
+ChangeBatch ChangeLog::to_batch(int64_t sequence, PendingTables&& tables) {
+    // Elements gone from their collection at commit: their group rows went with them.
+    std::map<std::string, std::unordered_set<int64_t>> removed;
+    for (const auto& [table, pending] : tables) {
+        if (table != pending.collection) {
+            continue;
+        }
+        for (const auto& [id, state] : pending.ids) {
+            if (state == State::Deleted || state == State::Vanished) {
+                removed[table].insert(id);
+            }
+        }
+    }
+
+    ChangeBatch batch;
+    batch.sequence = sequence;
+    for (auto& [table, pending] : tables) {
+        const auto removed_it = table != pending.collection ? removed.find(pending.collection) : removed.end();
+        TableChanges changes;
+        changes.table = table;
+        changes.collection = std::move(pending.collection);
+        for (const auto& [id, state] : pending.ids) {
+            if (removed_it != removed.end() && removed_it->second.count(id) > 0) {
+                continue;
+            }
+            switch (state) {
+            case State::Created:
+                changes.created.push_back(id);
+                break;
+            case State::Updated:
+                changes.updated.push_back(id);
+                break;
+            case State::Deleted:
+                changes.deleted.push_back(id);
+                break;
+            case State::Vanished:
+                break;
+            }
+        }
+        if (changes.created.empty() && changes.updated.empty() && changes.deleted.empty()) {
+            continue;  // every change netted out
+        }
+        std::sort(changes.created.begin(), changes.created.end());
+        std::sort(changes.updated.begin(), changes.updated.end());
+        std::sort(changes.deleted.begin(), changes.deleted.end());
+        batch.tables.push_back(std::move(changes));
+    }
+    return batch;
+}
+
+void ChangeLog::publish(spdlog::logger& logger) {
+    // Take everything first: a callback that writes seals (and publishes) its own batch.
+    auto sealed = std::move(sealed_);
+    sealed_.clear();
+    sealed_last_ = false;
+
+    for (auto& tables : sealed) {
+        auto batch = to_batch(sequence_ + 1, std::move(tables));
+        if (batch.tables.empty()) {
+            continue;
+        }
+        ++sequence_;
+
+        // Callbacks may subscribe or unsubscribe, so walk a snapshot of the ids.
+        std::vector<int64_t> ids;
+        ids.reserve(subscribers_.size());
+        for (const auto& [id, _] : subscribers_) {
+            ids.push_back(id);
+        }
+        for (const auto id : ids) {
+            auto it = subscribers_.find(id);
+            if (it == subscribers_.end()) {
+                continue;
+            }
+            if (!it->second.callback) {
+                it->second.queued.push_back(batch);
+                continue;
+            }
+            // The transaction has already committed, so a failing subscriber cannot undo it; report
+            // it and keep delivering to the others.
+            auto callback = it->second.callback;
+            try {
+                callback(batch);
+            } catch (const std::exception& e) {
+                QLOG_ERROR(logger, "Change feed subscriber {} failed on batch {}: {}", id, batch.sequence, e.what());
+            }
+        }
+    }
+}
+
+int64_t ChangeLog::subscribe(ChangeCallback callback) {
+    const auto id = next_subscription_++;
+    subscribers_.emplace(id, Subscriber{std::move(callback), {}});
+    return id;
+}
+
+void ChangeLog::unsubscribe(int64_t subscription) {
+    if (subscribers_.erase(subscription) == 0) {
+        throw std::runtime_error("Cannot unsubscribe_changes: subscription not found: " +
+                                 std::to_string(subscription));
+    }
+    if (subscribers_.empty()) {
+        // Nobody is listening any more: drop what the current transaction recorded so far.
+        pending_.clear();
+    }
+}
+
+std::vector<ChangeBatch> ChangeLog::poll(int64_t subscription) {
+    auto it = subscribers_.find(subscription);
+    if (it == subscribers_.end()) {
+        throw std::runtime_error("Cannot poll_changes: subscription not found: " + std::to_string(subscription));
+    }
+    if (it->second.callback) {
+        throw std::runtime_error("Cannot poll_changes: subscription " + std::to_string(subscription) +
+                                 " delivers to a callback");
+    }
+    return std::exchange(it->second.queued, {});
+}
+
+int64_t Database::subscribe_changes(ChangeCallback callback) {
+    const auto lock = impl_->lock_shared_access();
+    // Writes are only attributed to collections once the schema is known.
+    impl_->require_schema();
+    const auto id = impl_->changes.subscribe(std::move(callback));
+    QLOG_DEBUG(impl_->logger, "Change feed subscription {} added", id);
+    return id;
+}
+
+void Database::unsubscribe_changes(int64_t subscription) {
+    const auto lock = impl_->lock_shared_access();
+    impl_->changes.unsubscribe(subscription);
+    QLOG_DEBUG(impl_->logger, "Change feed subscription {} removed", subscription);
+}
+
+std::vector<ChangeBatch> Database::poll_changes(int64_t subscription) {
+    const auto lock = impl_->lock_shared_access();
+    // A cursor stepped to completion outside a transaction commits without passing through execute.
+    impl_->publish_changes();
+    return impl_->changes.poll(subscription);
+}
+
+}  // namespace quiver
@@ -1,9 +1,14 @@
 #include "database_impl.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace quiver {
 
 int64_t Database::create_element(const std::string& collection, const Element& element) {
-    impl_->logger->debug("Creating element in collection: {}", collection);
+    const auto tracked = impl_->track("create_element");
+    impl_->require_writable("create_element");
+    QLOG_DEBUG(impl_->logger, "Creating element in collection: {}", collection);
     impl_->require_collection(collection, "create_element");
 
     const auto& scalars = element.scalars();
@@ -41,14 +46,155 @@ int64_t Database::create_element(const std::string& collection, const Element& e
 
     execute(sql, parameters);
     const auto element_id = sqlite3_last_insert_rowid(impl_->db);
-    impl_->logger->debug("Inserted element with id: {}", element_id);
+    QLOG_DEBUG(impl_->logger, "Inserted element with id: {}", element_id);
 
     // Delegate group insertion to shared helper (empty arrays are skipped silently)
     impl_->insert_group_data("create_element", collection, element_id, resolved.arrays, false, *this);
 
     txn.commit();
-    impl_->logger->info("Created element {} in {}", element_id, collection);
+    QLOG_INFO(impl_->logger, "Created element {} in {}", element_id, collection);
     return element_id;
 }
 
+std::vector<int64_t> Database::create_elements(const std::string& collection, const std::vector<Element>& elements) {
+    const auto tracked = impl_->track("create_elements");
+    impl_->require_writable("create_elements");
+    QLOG_DEBUG(impl_->logger, "Creating {} elements in collection: {}", elements.size(), collection);
+    impl_->require_collection(collection, "create_elements");
+    if (elements.empty()) {
+        return {};
+    }
+
+    // Plan pass: resolve and validate every element before the first write. TransactionGuard
+    // no-ops inside a caller-owned transaction, so a late failure could not be rolled back here.
+    std::vector<ResolvedElement> resolved;
+    std::vector<std::map<std::string, Impl::GroupTableColumns>> groups;
+    resolved.reserve(elements.size());
+    groups.reserve(elements.size());
+    struct PackedRows {
+        size_t element;
+        Impl::PackedGroup group;
+        internal::PackedSeries series;
+    };
+    std::vector<PackedRows> packed;
+    const auto& packed_tables = impl_->schema->packed_time_series_tables();
+    auto explicit_ids = false;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        if (elements[i].scalars().empty()) {
+            throw std::runtime_error("Cannot create_elements: element at index " + std::to_string(i) +
+                                     " must have at least one scalar attribute");
+        }
+        // resolved is never reallocated (reserved above), so routed column pointers stay valid.
+        const auto& element = resolved.emplace_back(impl_->resolve_element_fk_labels(collection, elements[i], *this));
+        for (const auto& [name, value] : element.scalars) {
+            impl_->type_validator->validate_scalar("create_elements", collection, name, value);
+        }
+        explicit_ids = explicit_ids || element.scalars.count("id") > 0;
+
+        auto routed = impl_->route_group_data("create_elements", collection, element.arrays, false);
+        for (const auto& [table_name, entry] : routed) {
+            if (entry.type == GroupTableType::TimeSeries && packed_tables.count(table_name + "_packed") > 0) {
+                const auto& ts_def = *impl_->schema->get_table(table_name);
+                auto group = impl_->packed_group(ts_def);
+                auto series = impl_->packed_series_from_columns("create_elements", group, ts_def, entry.columns);
+                packed.push_back({i, std::move(group), std::move(series)});
+                continue;
+            }
+            impl_->validate_group_columns("create_elements", table_name, entry.type, entry.columns);
+        }
+        groups.push_back(std::move(routed));
+    }
+
+    Impl::TransactionGuard txn(*impl_);
+
+    std::vector<int64_t> ids;
+    ids.reserve(elements.size());
+    const auto max_rowid = query_integer("SELECT COALESCE(MAX(rowid), 0) FROM " + collection).value_or(0);
+    const auto total = static_cast<int64_t>(elements.size());
+    if (explicit_ids || max_rowid > std::numeric_limits<int64_t>::max() - total) {
+        // Caller-chosen ids, or a table near the top of the rowid range (where SQLite falls back to
+        // random rowids), defeat the consecutive-id inference: insert row by row.
+        for (const auto& element : resolved) {
+            Impl::InsertBatch row;
+            for (const auto& [name, value] : element.scalars) {
+                row.columns.push_back(name);
+                row.values.push_back(value);
+            }
+            impl_->insert_batch(collection, row, *this, &ids);
+        }
+    } else {
+        // Consecutive elements setting the same attributes share one multi-row INSERT.
+        size_t begin = 0;
+        while (begin < resolved.size()) {
+            Impl::InsertBatch batch;
+            for (const auto& [name, value] : resolved[begin].scalars) {
+                batch.columns.push_back(name);
+            }
+            auto same_attributes = [&batch](const ResolvedElement& element) {
+                return element.scalars.size() == batch.columns.size() &&
+                       std::equal(batch.columns.begin(),
+                                  batch.columns.end(),
+                                  element.scalars.begin(),
+                                  [](const std::string& column, const auto& scalar) { return column == scalar.first; });
+            };
+            auto end = begin;
+            for (; end < resolved.size() && same_attributes(resolved[end]); ++end) {
+                for (const auto& [name, value] : resolved[end].scalars) {
+                    batch.values.push_back(value);
+                }
+            }
+            impl_->insert_batch(collection, batch, *this, &ids);
+            begin = end;
+        }
+    }
+
+    // Group rows from every element, batched per (table, column list). Packed time series groups
+    // were converted in the plan pass and are stored per element below.
+    std::map<std::string, std::pair<std::string, Impl::InsertBatch>> group_batches;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        for (const auto& [table_name, entry] : groups[i]) {
+            if (entry.type == GroupTableType::TimeSeries && packed_tables.count(table_name + "_packed") > 0) {
+                continue;
+            }
+            std::vector<std::string> columns = {"id"};
+            if (entry.type == GroupTableType::Vector) {
+                columns.emplace_back("vector_index");
+            }
+            for (const auto& [col_name, values_ptr] : entry.columns) {
+                columns.push_back(col_name);
+            }
+            auto key = table_name;
+            for (const auto& column : columns) {
+                key += "|" + column;
+            }
+            auto& [table, batch] = group_batches[key];
+            if (batch.columns.empty()) {
+                table = table_name;
+                batch.columns = std::move(columns);
+            }
+
+            const auto num_rows = entry.columns.begin()->second->size();
+            for (size_t row = 0; row < num_rows; ++row) {
+                batch.values.emplace_back(ids[i]);
+                if (entry.type == GroupTableType::Vector) {
+                    batch.values.emplace_back(static_cast<int64_t>(row + 1));
+                }
+                for (const auto& [col_name, values_ptr] : entry.columns) {
+                    batch.values.push_back((*values_ptr)[row]);
+                }
+            }
+        }
+    }
+    for (const auto& [key, entry] : group_batches) {
+        impl_->insert_batch(entry.first, entry.second, *this);
+    }
+    for (const auto& rows : packed) {
+        impl_->store_packed_series("create_elements", rows.group, ids[rows.element], rows.series, *this);
+    }
+
+    txn.commit();
+    QLOG_INFO(impl_->logger, "Created {} elements in {}", ids.size(), collection);
+    return ids;
+}
+
 }  // namespace quiver
@@ -104,7 +104,7 @@ static void save_csv_document(rapidcsv::Document& doc, const std::string& path)
 
 // Render query results to a CSV file: create document, set headers, populate cells, save.
 // Column types are resolved once from type_map (invariant across rows).
-static void write_csv(const Result& data_result,
+static void write_csv(Cursor data,
                       const std::vector<std::string>& csv_columns,
                       const std::unordered_map<std::string, DataType>& type_map,
                       const CSVOptions& options,
@@ -124,11 +124,13 @@ static void write_csv(const Result& data_result,
         }
     }
 
+    // Rows are formatted as they are stepped; only the rendered document is held in memory.
     size_t row_idx = 0;
-    for (const auto& row : data_result) {
+    while (data.next()) {
         for (size_t i = 0; i < csv_columns.size(); ++i) {
+            const auto value = data.get_value(i);
             doc.SetCell<std::string>(
-                i, row_idx, value_to_csv_string(row[i], csv_columns[i], col_types[i], options, fk_labels));
+                i, row_idx, value_to_csv_string(value, csv_columns[i], col_types[i], options, fk_labels));
         }
         ++row_idx;
     }
@@ -140,6 +142,7 @@ void Database::export_csv(const std::string& collection,
                           const std::string& group,
                           const std::string& path,
                           const CSVOptions& options) {
+    const auto tracked = impl_->track("export_csv");
     namespace fs = std::filesystem;
 
     // Create parent directories (mkdir -p)
@@ -161,9 +164,10 @@ void Database::export_csv(const std::string& collection,
         IdLabelMap id_to_label;
         // One query, not two full-column reads. id (PK) and label (NOT NULL by schema convention)
         // are always present, so the guards are defensive only.
-        for (const auto& row : execute("SELECT id, label FROM " + to_table)) {
-            auto id = row.get_integer(0);
-            auto label = row.get_string(1);
+        auto rows = cursor("SELECT id, label FROM " + to_table);
+        while (rows.next()) {
+            auto id = rows.get_integer(0);
+            auto label = rows.get_string(1);
             if (id && label) {
                 id_to_label[*id] = *label;
             }
@@ -211,8 +215,12 @@ void Database::export_csv(const std::string& collection,
             fk_labels[fk.from_column] = &id_to_label_map(fk.to_table);
         }
 
-        auto data_result = execute("SELECT " + select_cols + " FROM " + collection + " ORDER BY rowid");
-        write_csv(data_result, csv_columns, type_map, options, fk_labels, path);
+        write_csv(cursor("SELECT " + select_cols + " FROM " + collection + " ORDER BY rowid"),
+                  csv_columns,
+                  type_map,
+                  options,
+                  fk_labels,
+                  path);
     } else {
         // Group export
         impl_->require_collection(collection, "export_csv");
@@ -232,6 +240,10 @@ void Database::export_csv(const std::string& collection,
             table_name = set_table;
             group_type = GroupTableType::Set;
         } else if (impl_->schema->has_table(ts_table)) {
+            if (impl_->schema->is_packed_time_series_group(collection, group)) {
+                throw std::runtime_error("Cannot export_csv: time series group '" + group + "' in collection '" +
+                                         collection + "' uses packed storage");
+            }
             table_name = ts_table;
             group_type = GroupTableType::TimeSeries;
         } else {
@@ -300,8 +312,7 @@ void Database::export_csv(const std::string& collection,
             }
         }
 
-        auto data_result = execute(query);
-        write_csv(data_result, csv_columns, type_map, options, fk_labels, path);
+        write_csv(cursor(query), csv_columns, type_map, options, fk_labels, path);
     }
 }
 
@@ -206,26 +206,18 @@ static std::vector<std::string> get_db_columns(const Result& schema_result, cons
     return cols;
 }
 
-// Build a label → id map from the parent collection.
-static std::unordered_map<std::string, int64_t> build_label_to_id_map(Database& db, const std::string& collection) {
-    std::unordered_map<std::string, int64_t> label_to_id;
-    auto ids = db.read_scalar_integers(collection, "id");
-    auto labels = db.read_scalar_strings(collection, "label");
-    for (size_t i = 0; i < ids.size(); ++i) {
-        // id (PK) and label (NOT NULL by schema convention) are always present; guard defensively.
-        if (ids[i] && labels[i]) {
-            label_to_id[*labels[i]] = *ids[i];
-        }
-    }
-    return label_to_id;
-}
-
 void Database::import_csv(const std::string& collection,
                           const std::string& group,
                           const std::string& path,
                           const CSVOptions& options) {
+    const auto tracked = impl_->track("import_csv");
+    impl_->require_writable("import_csv");
     impl_->require_collection(collection, "import_csv");
 
+    // label -> id for a whole collection, served from the FK label cache. Copied rather than
+    // borrowed: the import's own writes drop the cached entry it came from.
+    auto build_label_to_id_map = [&](const std::string& table) { return impl_->all_label_ids(table, *this); };
+
     // Import toggles PRAGMA foreign_keys, which is a no-op inside a transaction,
     // and manages its own transaction — so it cannot run inside an explicit one.
     if (in_transaction()) {
@@ -248,6 +240,10 @@ void Database::import_csv(const std::string& collection,
             table_name = set_table;
             group_type = GroupTableType::Set;
         } else if (impl_->schema->has_table(ts_table)) {
+            if (impl_->schema->is_packed_time_series_group(collection, group)) {
+                throw std::runtime_error("Cannot import_csv: time series group '" + group + "' in collection '" +
+                                         collection + "' uses packed storage");
+            }
             table_name = ts_table;
             group_type = GroupTableType::TimeSeries;
         } else {
@@ -284,6 +280,7 @@ void Database::import_csv(const std::string& collection,
     if (row_count == 0) {
         execute_raw("PRAGMA foreign_keys = OFF");
         try {
+            impl_->note_cleared_rows(table_name, *this);
             execute_raw("DELETE FROM " + table_name);
             execute_raw("PRAGMA foreign_keys = ON");
         } catch (...) {
@@ -308,7 +305,7 @@ void Database::import_csv(const std::string& collection,
 
         // Capture label -> id before the delete so re-inserted elements keep their
         // ids; otherwise foreign keys in other tables would silently re-point.
-        auto existing_label_to_id = build_label_to_id_map(*this, collection);
+        auto existing_label_to_id = build_label_to_id_map(collection);
 
         // Build FK map: column_name -> ForeignKey
         std::unordered_map<std::string, ForeignKey> fk_map;
@@ -320,7 +317,7 @@ void Database::import_csv(const std::string& collection,
         std::unordered_map<std::string, std::unordered_map<std::string, int64_t>> fk_label_maps;
         for (const auto& [col_name, fk] : fk_map) {
             if (fk.to_table != collection) {
-                fk_label_maps[col_name] = build_label_to_id_map(*this, fk.to_table);
+                fk_label_maps[col_name] = build_label_to_id_map(fk.to_table);
             }
         }
 
@@ -384,6 +381,7 @@ void Database::import_csv(const std::string& collection,
         try {
             impl_->begin_transaction();
 
+            impl_->note_cleared_rows(collection, *this);
             execute_raw("DELETE FROM " + collection);
 
             // Build INSERT statement; id is inserted explicitly (it is not one of db_cols).
@@ -465,7 +463,7 @@ void Database::import_csv(const std::string& collection,
             }
 
             if (!self_fk_cols.empty()) {
-                auto self_label_to_id = build_label_to_id_map(*this, collection);
+                auto self_label_to_id = build_label_to_id_map(collection);
 
                 for (const auto& col_name : self_fk_cols) {
                     for (size_t row = 0; row < row_count; ++row) {
@@ -504,7 +502,7 @@ void Database::import_csv(const std::string& collection,
         // Group import path
         // ================================================================
 
-        auto label_to_id = build_label_to_id_map(*this, collection);
+        auto label_to_id = build_label_to_id_map(collection);
 
         const auto* table_def = impl_->schema->get_table(table_name);
 
@@ -537,7 +535,7 @@ void Database::import_csv(const std::string& collection,
         // Build FK label→id lookup maps for non-id foreign keys
         std::unordered_map<std::string, std::unordered_map<std::string, int64_t>> fk_label_maps;
         for (const auto& [col_name, fk] : fk_map) {
-            fk_label_maps[col_name] = build_label_to_id_map(*this, fk.to_table);
+            fk_label_maps[col_name] = build_label_to_id_map(fk.to_table);
         }
 
         // Helper: resolve effective DataType for a group column
@@ -621,6 +619,7 @@ void Database::import_csv(const std::string& collection,
         try {
             impl_->begin_transaction();
 
+            impl_->note_cleared_rows(table_name, *this);
             execute_raw("DELETE FROM " + table_name);
 
             // Build INSERT statement
@@ -643,7 +642,9 @@ void Database::import_csv(const std::string& collection,
                     auto cell = read_cell(doc, csv_col_index[col_name], row);
 
                     if (col_name == "id") {
-                        parameters.emplace_back(label_to_id.at(cell));
+                        const auto element_id = label_to_id.at(cell);
+                        impl_->note_group_change(table_name, element_id);
+                        parameters.emplace_back(element_id);
                         continue;
                     }
 
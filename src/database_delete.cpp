@@ -2,8 +2,22 @@
 
 namespace quiver {
 
+namespace {
+
+// Ids a bulk delete is about to remove, one table per connection, created on first use. It is
+// emptied before staging as well as after deleting: a delete that throws inside a caller-owned
+// transaction leaves its ids behind.
+constexpr const char* kCreateStagedIds =
+    "CREATE TEMP TABLE IF NOT EXISTS quiver_delete_ids (id INTEGER PRIMARY KEY)";
+constexpr const char* kClearStagedIds = "DELETE FROM temp.quiver_delete_ids";
+constexpr const char* kStagedIds = "SELECT id FROM temp.quiver_delete_ids";
+
+}  // namespace
+
 void Database::delete_element(const std::string& collection, int64_t id) {
-    impl_->logger->debug("Deleting element {} from collection: {}", id, collection);
+    const auto tracked = impl_->track("delete_element");
+    impl_->require_writable("delete_element");
+    QLOG_DEBUG(impl_->logger, "Deleting element {} from collection: {}", id, collection);
     impl_->require_collection(collection, "delete_element");
 
     impl_->require_element(collection, id, *this);
@@ -11,7 +25,88 @@ void Database::delete_element(const std::string& collection, int64_t id) {
     auto sql = "DELETE FROM " + collection + " WHERE id = ?";
     execute(sql, {id});
 
-    impl_->logger->info("Deleted element {} from {}", id, collection);
+    QLOG_INFO(impl_->logger, "Deleted element {} from {}", id, collection);
+}
+
+DeleteResult Database::delete_elements(const std::string& collection, std::span<const int64_t> ids) {
+    const auto tracked = impl_->track("delete_elements");
+    impl_->require_writable("delete_elements");
+    QLOG_DEBUG(impl_->logger, "Deleting {} elements from collection: {}", ids.size(), collection);
+    impl_->require_collection(collection, "delete_elements");
+
+    Impl::TransactionGuard txn(*impl_);
+    execute(kCreateStagedIds);
+    execute(kClearStagedIds);
+    execute("INSERT OR IGNORE INTO temp.quiver_delete_ids (id) SELECT value FROM json_each(?)",
+            {array_parameter(ids)});
+
+    // One set query instead of a require_element per id; the smallest unknown id is reported.
+    const auto missing = execute("SELECT d.id FROM temp.quiver_delete_ids AS d WHERE NOT EXISTS (SELECT 1 FROM " +
+                                 collection + " WHERE " + collection + ".id = d.id) ORDER BY d.id LIMIT 1");
+    if (!missing.empty()) {
+        const auto id = missing[0].get_integer(0).value_or(0);
+        throw std::runtime_error("Element not found: " + std::to_string(id) + " in collection '" + collection + "'");
+    }
+
+    auto result = delete_staged_elements(collection);
+    txn.commit();
+
+    QLOG_INFO(impl_->logger, "Deleted {} elements from {}", result.elements, collection);
+    return result;
+}
+
+DeleteResult Database::delete_elements_where(const std::string& collection,
+                                             const std::string& predicate,
+                                             const std::vector<Value>& parameters) {
+    const auto tracked = impl_->track("delete_elements_where");
+    impl_->require_writable("delete_elements_where");
+    QLOG_DEBUG(impl_->logger, "Deleting elements from collection {} where {}", collection, predicate);
+    impl_->require_collection(collection, "delete_elements_where");
+    if (predicate.empty()) {
+        throw std::runtime_error("Cannot delete_elements_where: predicate must not be empty");
+    }
+
+    Impl::TransactionGuard txn(*impl_);
+    execute(kCreateStagedIds);
+    execute(kClearStagedIds);
+    execute("INSERT INTO temp.quiver_delete_ids (id) SELECT id FROM " + collection + " WHERE (" + predicate + ")",
+            parameters);
+
+    auto result = delete_staged_elements(collection);
+    txn.commit();
+
+    QLOG_INFO(impl_->logger, "Deleted {} elements from {}", result.elements, collection);
+    return result;
+}
+
+DeleteResult Database::delete_staged_elements(const std::string& collection) {
+    DeleteResult result;
+    // Counted before the DELETE: sqlite3_changes leaves out the rows a foreign-key cascade removes.
+    const auto count_group = [&](const std::string& table) {
+        const auto count = execute("SELECT COUNT(*) FROM " + table + " WHERE id IN (" + kStagedIds + ")");
+        result.group_rows[table] = count[0].get_integer(0).value_or(0);
+    };
+    for (const auto& group : impl_->schema->group_names(collection, GroupTableType::Vector)) {
+        count_group(Schema::vector_table_name(collection, group));
+    }
+    for (const auto& group : impl_->schema->group_names(collection, GroupTableType::Set)) {
+        count_group(Schema::set_table_name(collection, group));
+    }
+    for (const auto& group : impl_->schema->group_names(collection, GroupTableType::TimeSeries)) {
+        const auto table = Schema::time_series_table_name(collection, group);
+        if (impl_->schema->is_packed_time_series_group(collection, group)) {
+            // Listed under the time series table, in decoded rows: a chunk holds up to a year of rows.
+            result.group_rows[table] =
+                impl_->count_packed_rows(impl_->packed_group(*impl_->schema->get_table(table)), kStagedIds);
+        } else {
+            count_group(table);
+        }
+    }
+
+    execute("DELETE FROM " + collection + " WHERE id IN (" + kStagedIds + ")");
+    result.elements = sqlite3_changes(impl_->db);
+    execute(kClearStagedIds);
+    return result;
 }
 
 }  // namespace quiver
@@ -15,6 +15,39 @@ namespace {
 // (and float/text/primary-key columns) report coverage counts only.
 constexpr int64_t kMaxDistributionCardinality = 64;
 
+// The connection settings actually in effect (after DatabaseOptions::profile was applied), read
+// back from SQLite rather than echoed from the options.
+void write_connection_line(std::ostream& out, sqlite3* db) {
+    sqlite3_stmt* raw_stmt = nullptr;
+    std::string journal_mode = "unknown";
+    if (sqlite3_prepare_v2(db, "PRAGMA journal_mode;", -1, &raw_stmt, nullptr) == SQLITE_OK) {
+        StmtPtr stmt(raw_stmt, sqlite3_finalize);
+        if (sqlite3_step(stmt.get()) == SQLITE_ROW) {
+            const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt.get(), 0));
+            journal_mode = text ? text : "unknown";
+        }
+    }
+
+    static constexpr const char* kSynchronous[] = {"off", "normal", "full", "extra"};
+    static constexpr const char* kTempStore[] = {"default", "file", "memory"};
+    const auto synchronous = query_int_rows(db, "PRAGMA synchronous;")[0][0];
+    const auto temp_store = query_int_rows(db, "PRAGMA temp_store;")[0][0];
+    const auto cache_size = query_int_rows(db, "PRAGMA cache_size;")[0][0];
+    const auto mmap_rows = query_int_rows(db, "PRAGMA mmap_size;");
+
+    out << "Connection: journal_mode=" << journal_mode << ", synchronous="
+        << (synchronous >= 0 && synchronous < 4 ? kSynchronous[synchronous] : "unknown") << ", temp_store="
+        << (temp_store >= 0 && temp_store < 3 ? kTempStore[temp_store] : "unknown") << ", cache_size=";
+    // A negative cache_size is in KiB, a positive one in pages.
+    if (cache_size < 0) {
+        out << -cache_size << " KiB";
+    } else {
+        out << cache_size << " pages";
+    }
+    // mmap_size returns no row on builds without memory-mapped I/O.
+    out << ", mmap_size=" << (mmap_rows.empty() ? 0 : mmap_rows[0][0]) << "\n";
+}
+
 // Print a group's value columns in declaration order; time series dimension
 // columns are bracketed, vector tables hide their structural vector_index.
 void print_group_columns(std::ostream& out, const TableDefinition& table, GroupTableType type) {
@@ -78,7 +111,7 @@ void write_collection_section(std::ostream& out, const Schema& schema, const std
         {"  Time Series:", GroupTableType::TimeSeries},
     };
     for (const auto& [header, type] : sections) {
-        auto groups = schema.group_names(collection, type);
+        const auto& groups = schema.group_names(collection, type);
         if (groups.empty())
             continue;
         out << header << "\n";
@@ -93,11 +126,13 @@ void write_collection_section(std::ostream& out, const Schema& schema, const std
 }  // namespace
 
 std::string Database::describe() const {
+    const auto tracked = impl_->track("describe");
     impl_->require_schema();
 
     std::ostringstream out;
     out << "Database: " << impl_->path << "\n";
     out << "Version: " << current_version() << "\n";
+    write_connection_line(out, impl_->db);
 
     for (const auto& collection : impl_->schema->collection_names()) {
         out << "\n";
@@ -108,6 +143,7 @@ std::string Database::describe() const {
 }
 
 std::string Database::describe_collection(const std::string& collection) const {
+    const auto tracked = impl_->track("describe_collection");
     impl_->require_collection(collection, "describe_collection");
 
     std::ostringstream out;
@@ -116,6 +152,7 @@ std::string Database::describe_collection(const std::string& collection) const {
 }
 
 std::string Database::summarize_collection(const std::string& collection) const {
+    const auto tracked = impl_->track("summarize_collection");
     impl_->require_collection(collection, "summarize_collection");
 
     const int64_t element_count = number_of_elements(collection);
@@ -168,7 +205,7 @@ std::string Database::summarize_collection(const std::string& collection) const
         {"  Time Series:", GroupTableType::TimeSeries},
     };
     for (const auto& [header, type] : sections) {
-        auto groups = impl_->schema->group_names(collection, type);
+        const auto& groups = impl_->schema->group_names(collection, type);
         if (groups.empty())
             continue;
         out << header << "\n";
@@ -1,22 +1,543 @@
 #ifndef QUIVER_DATABASE_IMPL_H
 #define QUIVER_DATABASE_IMPL_H
 
+#include "packed_time_series.h"
+#include "quiver/cursor.h"
 #include "quiver/database.h"
+#include "quiver/index_advisor.h"
 #include "quiver/schema.h"
 #include "quiver/schema_validator.h"
 #include "quiver/type_validator.h"
+#include "utils/log.h"
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <spdlog/spdlog.h>
 #include <sqlite3.h>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace quiver {
 
 using StmtPtr = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>;
 
+// Bounded LRU of prepared statements keyed by SQL text, behind Database::execute(). Every CRUD
+// path builds the same few SQL strings per (collection, attribute), so per-element loops used to
+// re-parse and re-plan identical text on every call. A statement is checked *out* of the cache
+// while in use, so a re-entrant execute() of the same SQL simply prepares its own copy instead of
+// clobbering a statement mid-step; it goes back reset and with its bindings cleared.
+class StatementCache {
+public:
+    struct Entry {
+        std::string sql;
+        StmtPtr stmt{nullptr, sqlite3_finalize};
+    };
+
+    explicit StatementCache(size_t capacity) : capacity_(capacity) {}
+
+    Entry acquire(sqlite3* db, const std::string& sql) {
+        if (auto it = index_.find(sql); it != index_.end()) {
+            auto entry = std::move(*it->second);
+            entries_.erase(it->second);
+            index_.erase(it);
+            ++hits_;
+            return entry;
+        }
+
+        sqlite3_stmt* raw_stmt = nullptr;
+        if (sqlite3_prepare_v2(db, sql.c_str(), -1, &raw_stmt, nullptr) != SQLITE_OK) {
+            throw std::runtime_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(db)));
+        }
+        ++misses_;
+        return {sql, StmtPtr(raw_stmt, sqlite3_finalize)};
+    }
+
+    void release(Entry entry) {
+        // An empty statement (whitespace or a bare comment) prepares to nullptr - nothing to keep.
+        if (!entry.stmt || capacity_ == 0) {
+            return;
+        }
+        sqlite3_reset(entry.stmt.get());
+        sqlite3_clear_bindings(entry.stmt.get());
+        // A re-entrant copy of the same SQL came back first: keep that one, finalize this one.
+        if (index_.count(entry.sql) > 0) {
+            return;
+        }
+        entries_.push_front(std::move(entry));
+        index_.emplace(entries_.front().sql, entries_.begin());
+        if (entries_.size() > capacity_) {
+            index_.erase(entries_.back().sql);
+            entries_.pop_back();
+        }
+    }
+
+    // Finalize everything. Called on schema changes (apply_schema, migrate_up) and before the
+    // connection closes; statements checked out at that moment are finalized by their owner.
+    void clear() {
+        index_.clear();
+        entries_.clear();
+    }
+
+    int64_t hits() const { return hits_; }
+    int64_t misses() const { return misses_; }
+    size_t size() const { return entries_.size(); }
+    size_t capacity() const { return capacity_; }
+
+private:
+    size_t capacity_;
+    // Most recently released first. std::list nodes never move, so the index can key on views of
+    // the sql strings they own.
+    std::list<Entry> entries_;
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> index_;
+    int64_t hits_ = 0;
+    int64_t misses_ = 0;
+};
+
+// RAII checkout from a StatementCache: returns the statement on every exit path, including a
+// throwing bind or step, so the cache never keeps a statement that is mid-step.
+class CachedStatement {
+public:
+    CachedStatement(StatementCache& cache, sqlite3* db, const std::string& sql)
+        : cache_(cache), entry_(cache.acquire(db, sql)) {}
+    ~CachedStatement() { cache_.release(std::move(entry_)); }
+
+    CachedStatement(const CachedStatement&) = delete;
+    CachedStatement& operator=(const CachedStatement&) = delete;
+
+    sqlite3_stmt* get() const { return entry_.stmt.get(); }
+
+private:
+    StatementCache& cache_;
+    StatementCache::Entry entry_;
+};
+
+// to_table -> label -> id for foreign-key resolution, kept across operations so each distinct
+// label is looked up once however many writes reference it. Other connections (a DatabasePool,
+// another process) commit without this connection's hooks seeing it, so the cache is checked
+// against PRAGMA data_version before each use and dropped when that moves (sync). This
+// connection's own row changes drop the table's entry (the update hook), and a table written in
+// the open transaction is not cached again until it commits or rolls back: ROLLBACK TO fires no
+// hook, but can only undo rows of such tables.
+class LabelCache {
+public:
+    using Labels = std::unordered_map<std::string, int64_t>;
+
+    // The cached id of label in table. A table loaded whole by store_all() also answers "no such
+    // label" (std::nullopt) from the cache; otherwise std::nullopt means "ask the database".
+    std::optional<int64_t> find(const std::string& table, const std::string& label, bool& known) {
+        known = false;
+        auto it = tables_.find(table);
+        if (it == tables_.end()) {
+            return std::nullopt;
+        }
+        if (auto label_it = it->second.labels.find(label); label_it != it->second.labels.end()) {
+            known = true;
+            ++hits_;
+            return label_it->second;
+        }
+        if (it->second.complete) {
+            known = true;
+            ++hits_;
+        }
+        return std::nullopt;
+    }
+
+    void store(const std::string& table, const std::string& label, int64_t id) {
+        ++misses_;
+        if (!written(table)) {
+            tables_[table].labels.emplace(label, id);
+        }
+    }
+
+    // Every label of table, or nullptr unless it was loaded with store_all().
+    const Labels* all(const std::string& table) {
+        auto it = tables_.find(table);
+        if (it == tables_.end() || !it->second.complete) {
+            return nullptr;
+        }
+        ++hits_;
+        return &it->second.labels;
+    }
+
+    void store_all(const std::string& table, const Labels& labels) {
+        ++misses_;
+        if (!written(table)) {
+            auto& entry = tables_[table];
+            entry.labels = labels;
+            entry.complete = true;
+        }
+    }
+
+    // Update-hook path: runs for every row written on the connection, so it must stay cheap once
+    // the table is marked (a hash probe on a view, no allocation).
+    void invalidate(std::string_view table) {
+        if (!written(table)) {
+            written_.emplace(table);
+        }
+        if (tables_.empty()) {
+            return;
+        }
+        if (auto it = tables_.find(table); it != tables_.end()) {
+            tables_.erase(it);
+        }
+    }
+
+    // Commit hook: the transaction's writes are now what every later read sees.
+    void end_transaction() { written_.clear(); }
+
+    // Rollback hook and schema changes.
+    void clear() {
+        tables_.clear();
+        written_.clear();
+    }
+
+    // Drops everything when the database's data_version moved since the last call.
+    void sync(int64_t data_version) {
+        if (data_version != data_version_) {
+            tables_.clear();
+            data_version_ = data_version;
+        }
+    }
+
+    int64_t hits() const { return hits_; }
+    int64_t misses() const { return misses_; }
+    size_t size() const {
+        size_t count = 0;
+        for (const auto& [_, entry] : tables_) {
+            count += entry.labels.size();
+        }
+        return count;
+    }
+
+private:
+    struct TableHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+    };
+    struct Entry {
+        Labels labels;
+        bool complete = false;
+    };
+    bool written(std::string_view table) const { return !written_.empty() && written_.find(table) != written_.end(); }
+
+    std::unordered_map<std::string, Entry, TableHash, std::equal_to<>> tables_;
+    std::unordered_set<std::string, TableHash, std::equal_to<>> written_;
+    int64_t data_version_ = -1;
+    int64_t hits_ = 0;
+    int64_t misses_ = 0;
+};
+
+// Element changes behind the change feed (Database::subscribe_changes). Writes accumulate per table
+// until the transaction ends: the commit hook seals them into a batch and the rollback hook drops
+// them. Sealed batches reach subscribers through publish(), which runs after the commit has
+// returned - never inside a SQLite hook, so a callback may use the Database. Nothing is recorded
+// while there are no subscribers. ROLLBACK TO fires no hook, so savepoints keep a snapshot of the
+// pending changes to fall back to (see Database::Impl::on_savepoint).
+class ChangeLog {
+public:
+    bool active() const { return !subscribers_.empty(); }
+
+    // Hook and write-path entry: runs per changed row, so it only merges into the pending table.
+    void record(std::string_view table, std::string_view collection, ChangeKind kind, int64_t id) {
+        auto it = pending_.find(table);
+        if (it == pending_.end()) {
+            it = pending_.emplace(std::string(table), PendingTable{std::string(collection), {}}).first;
+        }
+        auto [entry, inserted] = it->second.ids.emplace(id, static_cast<State>(kind));
+        if (!inserted) {
+            entry->second = merge(entry->second, kind);
+        }
+    }
+
+    // Commit hook: the transaction's changes become one batch to publish.
+    void seal() {
+        savepoints_.clear();
+        sealed_last_ = !pending_.empty();
+        if (sealed_last_) {
+            sealed_.push_back(std::move(pending_));
+            pending_.clear();
+        }
+    }
+
+    // COMMIT failed after the commit hook ran. If the transaction is still open (SQLITE_BUSY) its
+    // changes go back to pending; if SQLite rolled it back they are dropped.
+    void abandon_commit(bool still_open) {
+        if (!sealed_last_) {
+            return;
+        }
+        if (still_open) {
+            pending_ = std::move(sealed_.back());
+        }
+        sealed_.pop_back();
+        sealed_last_ = false;
+    }
+
+    // Rollback hook.
+    void discard() {
+        pending_.clear();
+        savepoints_.clear();
+    }
+
+    // SAVEPOINT, RELEASE and ROLLBACK TO, by lowercased name. ROLLBACK TO keeps the savepoint open
+    // and drops the ones opened after it, as SQLite does; an unknown name is left to SQLite's error.
+    void savepoint(std::string name) { savepoints_.push_back({std::move(name), pending_}); }
+    void release(const std::string& name) {
+        if (auto it = find_savepoint(name); it != savepoints_.end()) {
+            savepoints_.erase(it, savepoints_.end());
+        }
+    }
+    void rollback_to(const std::string& name) {
+        if (auto it = find_savepoint(name); it != savepoints_.end()) {
+            pending_ = it->pending;
+            savepoints_.erase(std::next(it), savepoints_.end());
+        }
+    }
+
+    bool has_sealed() const { return !sealed_.empty(); }
+
+    void publish(spdlog::logger& logger);
+    int64_t subscribe(ChangeCallback callback);
+    void unsubscribe(int64_t subscription);
+    std::vector<ChangeBatch> poll(int64_t subscription);
+
+private:
+    // A ChangeKind, plus Vanished for an element created and deleted by the same transaction.
+    enum class State { Created, Updated, Deleted, Vanished };
+    struct PendingTable {
+        std::string collection;
+        std::unordered_map<int64_t, State> ids;
+    };
+    using PendingTables = std::map<std::string, PendingTable, std::less<>>;
+
+    struct Subscriber {
+        ChangeCallback callback;
+        std::vector<ChangeBatch> queued;
+    };
+
+    // Net effect of a further change to the same row within one transaction.
+    static State merge(State previous, ChangeKind next) {
+        switch (previous) {
+        case State::Created:
+            return next == ChangeKind::Deleted ? State::Vanished : State::Created;
+        case State::Vanished:
+            return next == ChangeKind::Created ? State::Created : State::Vanished;
+        case State::Deleted:
+            return next == ChangeKind::Created ? State::Updated : State::Deleted;
+        default:
+            return static_cast<State>(next);
+        }
+    }
+
+    struct Savepoint {
+        std::string name;
+        PendingTables pending;  // pending_ when the savepoint was opened
+    };
+
+    // The innermost open savepoint of that name.
+    std::vector<Savepoint>::iterator find_savepoint(const std::string& name) {
+        auto it = std::find_if(
+            savepoints_.rbegin(), savepoints_.rend(), [&](const Savepoint& open) { return open.name == name; });
+        return it == savepoints_.rend() ? savepoints_.end() : std::prev(it.base());
+    }
+
+    static ChangeBatch to_batch(int64_t sequence, PendingTables&& tables);
+
+    PendingTables pending_;
+    std::vector<Savepoint> savepoints_;
+    std::vector<PendingTables> sealed_;
+    bool sealed_last_ = false;
+    std::map<int64_t, Subscriber> subscribers_;
+    int64_t next_subscription_ = 1;
+    int64_t sequence_ = 0;
+};
+
+// Per-operation counters behind Database::stats(). Disabled, an operation costs one flag check.
+// Enabled, the outermost public operation in progress is the current one: Database::Impl::track
+// times it and charges it statement-cache and total_changes deltas, and the cursor and bind paths
+// add rows read and bytes bound to it directly.
+class OperationMetrics {
+public:
+    struct Counters {
+        int64_t calls = 0;
+        int64_t total_ns = 0;
+        int64_t rows_read = 0;
+        int64_t rows_written = 0;
+        int64_t statements_prepared = 0;
+        int64_t statements_reused = 0;
+        int64_t bytes_bound = 0;
+        // Ring of the last OperationStats::kLatencyWindow latencies; next is the slot to overwrite.
+        std::vector<int64_t> latencies;
+        size_t next = 0;
+    };
+
+    bool enabled() const { return enabled_; }
+    void set_enabled(bool enabled) { enabled_ = enabled; }
+
+    // The operation in progress, or nullptr when disabled or idle.
+    Counters* current() const { return current_; }
+
+    Counters* begin(std::string_view operation) {
+        auto it = operations_.find(operation);
+        if (it == operations_.end()) {
+            it = operations_.emplace(std::string(operation), Counters{}).first;
+        }
+        current_ = &it->second;
+        return current_;
+    }
+
+    void end(int64_t elapsed_ns) {
+        auto& counters = *current_;
+        current_ = nullptr;
+        ++counters.calls;
+        counters.total_ns += elapsed_ns;
+        if (counters.latencies.size() < OperationStats::kLatencyWindow) {
+            counters.latencies.push_back(elapsed_ns);
+        } else {
+            counters.latencies[counters.next] = elapsed_ns;
+            counters.next = (counters.next + 1) % OperationStats::kLatencyWindow;
+        }
+    }
+
+    void add_rows_read(int64_t rows) {
+        if (current_) {
+            current_->rows_read += rows;
+        }
+    }
+
+    void add_bytes_bound(int64_t bytes) {
+        if (current_) {
+            current_->bytes_bound += bytes;
+        }
+    }
+
+    std::vector<OperationStats> snapshot() const;
+
+    // Drops every operation; one in progress keeps counting into a fresh entry.
+    void reset();
+
+private:
+    bool enabled_ = false;
+    Counters* current_ = nullptr;
+    std::map<std::string, Counters, std::less<>> operations_;
+};
+
+// Statement trace behind DatabaseOptions::trace: SQLite reports each statement's run time
+// (SQLITE_TRACE_PROFILE) to Database::Impl::on_trace, and statements at or over the threshold are
+// logged and kept in a bounded ring. Rows are counted by the cursors stepping each statement.
+class SqlTracer {
+public:
+    explicit SqlTracer(const SqlTraceOptions& options)
+        : threshold_ns_(options.slow_threshold_ns), capacity_(options.ring_capacity) {}
+
+    void count_row(sqlite3_stmt* stmt) { ++rows_[stmt]; }
+
+    // The rows stepped on stmt since its last run finished.
+    int64_t take_rows(sqlite3_stmt* stmt) {
+        auto it = rows_.find(stmt);
+        if (it == rows_.end()) {
+            return 0;
+        }
+        const auto rows = it->second;
+        rows_.erase(it);
+        return rows;
+    }
+
+    bool is_slow(int64_t elapsed_ns) const { return elapsed_ns >= threshold_ns_; }
+
+    void keep(TracedStatement statement) {
+        if (capacity_ == 0) {
+            return;
+        }
+        if (ring_.size() < capacity_) {
+            ring_.push_back(std::move(statement));
+        } else {
+            ring_[next_] = std::move(statement);
+            next_ = (next_ + 1) % capacity_;
+        }
+    }
+
+    // Oldest first.
+    std::vector<TracedStatement> entries() const {
+        std::vector<TracedStatement> result(ring_.begin() + static_cast<std::ptrdiff_t>(next_), ring_.end());
+        result.insert(result.end(), ring_.begin(), ring_.begin() + static_cast<std::ptrdiff_t>(next_));
+        return result;
+    }
+
+    void clear() {
+        ring_.clear();
+        next_ = 0;
+    }
+
+private:
+    int64_t threshold_ns_;
+    size_t capacity_;
+    std::vector<TracedStatement> ring_;
+    size_t next_ = 0;
+    std::unordered_map<sqlite3_stmt*, int64_t> rows_;
+};
+
+// A SAVEPOINT, RELEASE or ROLLBACK TO statement, recognized by parse_savepoint so the change feed
+// the update and rollback hooks keep can follow savepoints too (SQLite reports those to no hook).
+// name is the savepoint's name, unquoted and lowercased, as SQLite matches it.
+struct SavepointStatement {
+    enum class Kind { Begin, Release, RollbackTo };
+    Kind kind;
+    std::string name;
+};
+
+// Cheap for any other statement: it gives up at the first keyword that does not match.
+std::optional<SavepointStatement> parse_savepoint(std::string_view sql);
+
+// State behind a quiver::Cursor: a statement checked out of the owning Database's cache, handed
+// back (reset, bindings cleared) when the cursor is destroyed.
+struct Cursor::Impl {
+    StatementCache* cache;
+    sqlite3* db;
+    StatementCache::Entry entry;
+    std::vector<std::string> columns;
+    OperationMetrics* metrics = nullptr;
+    SqlTracer* tracer = nullptr;  // set while DatabaseOptions::trace is on
+    std::recursive_mutex* shared_access = nullptr;  // set on an immutable Database; see Database::Impl
+    std::function<void()> on_done;  // runs once the statement has stepped to SQLITE_DONE
+    bool has_row = false;
+    bool done = false;
+
+    Impl(StatementCache& statements, sqlite3* connection, const std::string& sql)
+        : cache(&statements), db(connection), entry(statements.acquire(connection, sql)) {}
+    ~Impl() {
+        if (shared_access) {
+            std::lock_guard lock(*shared_access);
+            cache->release(std::move(entry));
+        } else {
+            cache->release(std::move(entry));
+        }
+    }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    sqlite3_stmt* stmt() const { return entry.stmt.get(); }
+
+    int column(size_t index) const {
+        if (!has_row) {
+            throw std::runtime_error("Cannot read cursor column: no current row");
+        }
+        if (index >= columns.size()) {
+            throw std::runtime_error("Cannot read cursor column: index " + std::to_string(index) + " out of range");
+        }
+        return static_cast<int>(index);
+    }
+};
+
 // Run a read-only query that yields integer columns and collect the rows. Prepares/steps
 // directly on the raw sqlite3* rather than through Database::execute(), which is non-const and
 // unusable from const methods (number_of_elements, current_version, describe/summarize_collection).
@@ -59,15 +580,36 @@ struct Database::Impl {
     sqlite3* db = nullptr;
     std::string path;
     std::shared_ptr<spdlog::logger> logger;
+    // Prepared statements behind Database::execute(), reused across calls with the same SQL text.
+    static constexpr size_t kStatementCacheCapacity = 128;
+    StatementCache statements{kStatementCacheCapacity};
+    // Foreign-key label -> id lookups, kept coherent by the hooks registered in the constructor.
+    LabelCache labels;
+    // Committed element changes for subscribe_changes, fed by the same hooks.
+    ChangeLog changes;
+    // Per-operation counters for Database::stats(); see track().
+    OperationMetrics metrics;
+    // The outermost public operation in progress (a string literal), or empty; see track().
+    std::string_view operation;
+    // Slow-statement trace; only set up when DatabaseOptions::trace is enabled.
+    std::unique_ptr<SqlTracer> tracer;
     // Loaded lazily by require_schema: the Database(path, options) constructor opens an existing
     // database without reading its schema, and every metadata/CRUD path goes through
     // require_schema. mutable so the const readers (get_*_metadata, describe, ...) can trigger it.
-    mutable std::unique_ptr<Schema> schema;
-    mutable std::unique_ptr<TypeValidator> type_validator;
+    // Shared and const once loaded, so a DatabasePool can hand one validated snapshot to all of its
+    // reader connections.
+    mutable std::shared_ptr<const Schema> schema;
+    mutable std::shared_ptr<const TypeValidator> type_validator;
     // A dry run holds one real transaction open and absorbs the public begin/commit/rollback so
     // nested callers compose. TransactionGuard needs no flag - it already no-ops when a
     // transaction is active.
     bool dry_run = false;
+    // DatabaseOptions::immutable: writes are rejected by require_writable, and every tracked
+    // operation (and cursor step) holds shared_access, as do the accessors behind
+    // lock_shared_access, so threads sharing the Database take turns on the connection, statement
+    // cache and counters. Recursive because operations nest.
+    bool immutable = false;
+    std::recursive_mutex shared_access;
 
     // Takes no operation name: reading an existing database's schema on first use is what makes
     // open() usable, and a database that is not a quiver database throws the validator's own
@@ -94,6 +636,12 @@ struct Database::Impl {
         }
     }
 
+    void require_writable(const char* operation) const {
+        if (immutable) {
+            throw std::runtime_error(std::string("Cannot ") + operation + ": database is immutable");
+        }
+    }
+
     void require_column(const std::string& table, const std::string& column, const char* operation) const {
         require_schema();
         const auto* table_def = schema->get_table(table);
@@ -106,8 +654,220 @@ struct Database::Impl {
         }
     }
 
-    Value
-    resolve_fk_label(const TableDefinition& table_def, const std::string& column, const Value& value, Database& db) {
+    // Marks the outermost public operation in progress - the method name the SQL trace reports -
+    // and, with stats enabled, times it for Database::stats() (see OperationMetrics). Nested
+    // operations leave both to the outer one.
+    class OperationScope {
+    public:
+        OperationScope(Impl& impl, std::string_view operation) {
+            if (impl.immutable) {
+                shared_access_ = std::unique_lock(impl.shared_access);
+            }
+            if (!impl.operation.empty()) {
+                return;
+            }
+            impl_ = &impl;
+            impl.operation = operation;
+            if (!impl.metrics.enabled()) {
+                return;
+            }
+            counters_ = impl.metrics.begin(operation);
+            hits_ = impl.statements.hits();
+            misses_ = impl.statements.misses();
+            changes_ = sqlite3_total_changes(impl.db);
+            start_ = std::chrono::steady_clock::now();
+        }
+
+        ~OperationScope() {
+            if (!impl_) {
+                return;
+            }
+            impl_->operation = {};
+            if (!counters_ || impl_->metrics.current() != counters_) {
+                return;
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start_;
+            counters_->statements_reused += impl_->statements.hits() - hits_;
+            counters_->statements_prepared += impl_->statements.misses() - misses_;
+            counters_->rows_written += sqlite3_total_changes(impl_->db) - changes_;
+            impl_->metrics.end(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+        OperationScope(const OperationScope&) = delete;
+        OperationScope& operator=(const OperationScope&) = delete;
+
+    private:
+        std::unique_lock<std::recursive_mutex> shared_access_;  // released after the destructor body
+        Impl* impl_ = nullptr;
+        OperationMetrics::Counters* counters_ = nullptr;
+        int64_t hits_ = 0;
+        int64_t misses_ = 0;
+        int64_t changes_ = 0;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    [[nodiscard]] OperationScope track(std::string_view operation) { return OperationScope(*this, operation); }
+
+    // shared_access on an immutable Database, for the accessors that are not operations themselves
+    // (stats, cache counters, the change feed) but read or reset state that operations mutate.
+    [[nodiscard]] std::unique_lock<std::recursive_mutex> lock_shared_access() {
+        return immutable ? std::unique_lock(shared_access) : std::unique_lock<std::recursive_mutex>();
+    }
+
+    // The id of the element labelled label in table, through the label cache.
+    std::optional<int64_t> find_label_id(const std::string& table, const std::string& label, Database& db) {
+        sync_label_cache();
+        bool known = false;
+        if (auto id = labels.find(table, label, known); known) {
+            return id;
+        }
+        auto lookup_result = db.execute("SELECT id FROM " + table + " WHERE label = ?", {label});
+        if (lookup_result.empty() || !lookup_result[0].get_integer(0)) {
+            return std::nullopt;
+        }
+        const auto id = lookup_result[0].get_integer(0).value();
+        labels.store(table, label, id);
+        return id;
+    }
+
+    // Every label -> id of table, loaded whole into the label cache on first use.
+    LabelCache::Labels all_label_ids(const std::string& table, Database& db) {
+        sync_label_cache();
+        if (const auto* cached = labels.all(table)) {
+            return *cached;
+        }
+        LabelCache::Labels label_to_id;
+        auto rows = db.cursor("SELECT id, label FROM " + table);
+        while (rows.next()) {
+            auto id = rows.get_integer(0);
+            auto label = rows.get_string(1);
+            // id (PK) and label (NOT NULL by schema convention) are always present; guard defensively.
+            if (id && label) {
+                label_to_id[*label] = *id;
+            }
+        }
+        labels.store_all(table, label_to_id);
+        return label_to_id;
+    }
+
+    // PRAGMA data_version moves when another connection commits to the database file.
+    void sync_label_cache() {
+        CachedStatement stmt(statements, db, "PRAGMA data_version");
+        if (sqlite3_step(stmt.get()) != SQLITE_ROW) {
+            throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(db)));
+        }
+        labels.sync(sqlite3_column_int64(stmt.get(), 0));
+    }
+
+    // SQLite row-change, commit and rollback hooks, registered on the connection by the constructor.
+    // A collection row's rowid is its element id (id INTEGER PRIMARY KEY); group rows have no such
+    // link, so the write paths report them through note_group_change instead.
+    static void on_row_change(void* self, int operation, const char*, const char* table, sqlite3_int64 rowid) {
+        auto* impl = static_cast<Impl*>(self);
+        impl->labels.invalidate(table);
+        if (impl->changes.active() && impl->schema && impl->schema->is_collection(table)) {
+            const auto kind = operation == SQLITE_INSERT   ? ChangeKind::Created
+                              : operation == SQLITE_DELETE ? ChangeKind::Deleted
+                                                           : ChangeKind::Updated;
+            impl->changes.record(table, table, kind, rowid);
+        }
+    }
+    static int on_commit(void* self) {
+        auto* impl = static_cast<Impl*>(self);
+        impl->labels.end_transaction();
+        impl->changes.seal();
+        return 0;
+    }
+    // SQLITE_TRACE_PROFILE: stmt has just finished a run that took *elapsed_ns.
+    static int on_trace(unsigned, void* self, void* stmt, void* elapsed_ns) {
+        auto& impl = *static_cast<Impl*>(self);
+        auto* statement = static_cast<sqlite3_stmt*>(stmt);
+        const auto elapsed = static_cast<int64_t>(*static_cast<sqlite3_int64*>(elapsed_ns));
+        // Rows stepped for a query, rows changed for a write.
+        auto rows = impl.tracer->take_rows(statement);
+        if (!sqlite3_stmt_readonly(statement)) {
+            rows = sqlite3_changes(impl.db);
+        }
+        if (!impl.tracer->is_slow(elapsed)) {
+            return 0;
+        }
+        char* expanded = sqlite3_expanded_sql(statement);
+        TracedStatement traced{
+            expanded ? expanded : sqlite3_sql(statement), elapsed, rows, std::string(impl.operation)};
+        sqlite3_free(expanded);
+        QLOG_INFO(impl.logger,
+                  "SQL {:.3f} ms, {} rows [{}]: {}",
+                  static_cast<double>(elapsed) / 1e6,
+                  rows,
+                  traced.operation.empty() ? "-" : traced.operation,
+                  traced.sql);
+        impl.tracer->keep(std::move(traced));
+        return 0;
+    }
+
+    static void on_rollback(void* self) {
+        auto* impl = static_cast<Impl*>(self);
+        impl->labels.clear();
+        impl->changes.discard();
+    }
+
+    // A savepoint statement has just run (see prepare_cursor). ROLLBACK TO undoes rows without
+    // firing the update or rollback hook, so the change feed falls back to what was pending when
+    // the savepoint was opened.
+    void on_savepoint(const SavepointStatement& statement) {
+        switch (statement.kind) {
+        case SavepointStatement::Kind::Begin:
+            changes.savepoint(statement.name);
+            break;
+        case SavepointStatement::Kind::Release:
+            changes.release(statement.name);
+            break;
+        case SavepointStatement::Kind::RollbackTo:
+            changes.rollback_to(statement.name);
+            break;
+        }
+    }
+
+    // Record that element id's rows in group table `table` were written (change feed only).
+    void note_group_change(const std::string& table, int64_t id) {
+        if (changes.active()) {
+            changes.record(table, schema->get_parent_collection(table), ChangeKind::Updated, id);
+        }
+    }
+
+    // Record every element with rows in `table` ahead of a statement that clears it (change feed
+    // only). A DELETE without WHERE takes SQLite's truncate path, which fires no update hook, so a
+    // collection's ids are recorded as Deleted here - an id inserted again then nets to Updated - and
+    // a group table's elements as Updated.
+    void note_cleared_rows(const std::string& table, Database& db) {
+        if (!changes.active()) {
+            return;
+        }
+        const bool collection = schema->is_collection(table);
+        auto rows = db.cursor(collection ? "SELECT id FROM " + table : "SELECT DISTINCT id FROM " + table);
+        while (rows.next()) {
+            if (auto id = rows.get_integer(0)) {
+                if (collection) {
+                    changes.record(table, table, ChangeKind::Deleted, *id);
+                } else {
+                    note_group_change(table, *id);
+                }
+            }
+        }
+    }
+
+    // Hand batches sealed by the commit hook to subscribers. Called once a commit has returned:
+    // after Impl::commit and after every statement that may have committed on its own.
+    void publish_changes() {
+        if (changes.has_sealed()) {
+            changes.publish(*logger);
+        }
+    }
+
+    Value resolve_fk_label(const TableDefinition& table_def,
+                           const std::string& column,
+                           const Value& value,
+                           Database& db) {
         if (!std::holds_alternative<std::string>(value)) {
             return value;
         }
@@ -117,13 +877,12 @@ struct Database::Impl {
         // Check if column is a foreign key
         for (const auto& fk : table_def.foreign_keys) {
             if (fk.from_column == column) {
-                auto lookup_sql = "SELECT id FROM " + fk.to_table + " WHERE label = ?";
-                auto lookup_result = db.execute(lookup_sql, {str_val});
-                if (lookup_result.empty() || !lookup_result[0].get_integer(0)) {
+                auto id = find_label_id(fk.to_table, str_val, db);
+                if (!id) {
                     throw std::runtime_error("Failed to resolve label '" + str_val + "' to ID in table '" +
                                              fk.to_table + "'");
                 }
-                return lookup_result[0].get_integer(0).value();
+                return *id;
             }
         }
 
@@ -149,7 +908,7 @@ struct Database::Impl {
 
         // Resolve arrays against their respective group table FK metadata
         for (const auto& [array_name, values] : element.arrays()) {
-            auto matches = schema->find_all_tables_for_column(collection, array_name);
+            const auto& matches = schema->find_all_tables_for_column(collection, array_name);
 
             // Find the first table match for FK resolution
             // (FK columns have unique names per schema design, so first match is correct;
@@ -203,13 +962,62 @@ struct Database::Impl {
                            const std::vector<std::map<std::string, Value>>& rows,
                            Database& db);
 
-    void insert_rows_into_group_table(const char* caller,
-                                      const std::string& table_name,
-                                      GroupTableType type,
-                                      const std::map<std::string, const std::vector<Value>*>& columns,
-                                      int64_t element_id,
-                                      bool delete_existing,
-                                      Database& db) {
+    // Storage of a packed time series group (Schema::is_packed_time_series_group). The methods
+    // below are defined in database_time_series_packed.cpp; the time series methods of Database
+    // switch to them once they have resolved and validated the group.
+    struct PackedGroup {
+        std::string table;
+        std::string time_series_table;
+        std::string dim_col;
+        std::vector<const ColumnDefinition*> value_columns;
+    };
+    PackedGroup packed_group(const TableDefinition& ts_def) const;
+    // One element's rows; empty when it has none.
+    internal::PackedSeries load_packed_series(const PackedGroup& group, int64_t id);
+    // Every element with rows, in id order, decoded one element at a time.
+    void scan_packed_series(const PackedGroup& group,
+                            const std::function<void(int64_t, internal::PackedSeries&&)>& visit);
+    // Rows stored for the elements `id_query` selects, counted from the chunks' presence bitmaps.
+    int64_t count_packed_rows(const PackedGroup& group, const std::string& id_query);
+    // Replaces all of an element's chunks with the packed form of `series`.
+    void store_packed_series(const char* caller,
+                             const PackedGroup& group,
+                             int64_t id,
+                             const internal::PackedSeries& series,
+                             Database& db);
+    // Conversions between the row maps of the public API and a decoded series. These parse and
+    // sort the dimension, reject duplicate times and values of the wrong type.
+    internal::PackedSeries packed_series_from_rows(const char* caller,
+                                                   const PackedGroup& group,
+                                                   const std::vector<std::map<std::string, Value>>& rows) const;
+    std::vector<std::map<std::string, Value>> packed_series_to_rows(const PackedGroup& group,
+                                                                    const internal::PackedSeries& series) const;
+    // read_time_series_row(s) over a packed group: result[element][t] is the last non-null value
+    // of `attribute` at or before date_times[t], for elements in element_ids order.
+    std::vector<std::vector<Value>> read_packed_as_of(const char* caller,
+                                                      const PackedGroup& group,
+                                                      const std::string& attribute,
+                                                      const std::vector<int64_t>& element_ids,
+                                                      const std::vector<std::string>& date_times);
+    // Arrays routed to a packed group, validated as insert_rows_into_group_table does and
+    // converted to a series.
+    internal::PackedSeries packed_series_from_columns(const char* caller,
+                                                      const PackedGroup& group,
+                                                      const TableDefinition& ts_def,
+                                                      const std::map<std::string, const std::vector<Value>*>& columns);
+    // create_element / update_element arrays routed to a packed group: the element's series is
+    // replaced as a whole.
+    void insert_rows_into_packed_table(const char* caller,
+                                       const TableDefinition& ts_def,
+                                       const std::map<std::string, const std::vector<Value>*>& columns,
+                                       int64_t element_id,
+                                       Database& db);
+
+    // Validates the columns bound for one group table and returns their common row count.
+    size_t validate_group_columns(const char* caller,
+                                  const std::string& table_name,
+                                  GroupTableType type,
+                                  const std::map<std::string, const std::vector<Value>*>& columns) const {
         const char* noun = group_table_noun(type);
 
         // Validate types and verify same-length arrays *before* the DELETE: TransactionGuard
@@ -228,10 +1036,25 @@ struct Database::Impl {
                                          table_name + "' must have the same length");
             }
         }
+        return num_rows;
+    }
+
+    void insert_rows_into_group_table(const char* caller,
+                                      const std::string& table_name,
+                                      GroupTableType type,
+                                      const std::map<std::string, const std::vector<Value>*>& columns,
+                                      int64_t element_id,
+                                      bool delete_existing,
+                                      Database& db) {
+        const char* noun = group_table_noun(type);
+        const auto num_rows = validate_group_columns(caller, table_name, type, columns);
 
         if (delete_existing) {
             db.execute("DELETE FROM " + table_name + " WHERE id = ?", {element_id});
         }
+        if (delete_existing || num_rows > 0) {
+            note_group_change(table_name, element_id);
+        }
 
         // Insert rows (vector tables get a 1-based vector_index column)
         for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
@@ -254,21 +1077,21 @@ struct Database::Impl {
             sql += ") VALUES (" + placeholders + ")";
             db.execute(sql, parameters);
         }
-        logger->debug("Inserted {} {} rows into {}", num_rows, noun, table_name);
+        QLOG_DEBUG(logger, "Inserted {} {} rows into {}", num_rows, noun, table_name);
     }
 
-    void insert_group_data(const char* caller,
-                           const std::string& collection,
-                           int64_t element_id,
-                           const std::map<std::string, std::vector<Value>>& arrays,
-                           bool delete_existing,
-                           Database& db) {
-        // Route arrays to their target tables
-        struct TableColumns {
-            GroupTableType type;
-            std::map<std::string, const std::vector<Value>*> columns;
-        };
-        std::map<std::string, TableColumns> table_columns;
+    struct GroupTableColumns {
+        GroupTableType type;
+        std::map<std::string, const std::vector<Value>*> columns;
+    };
+
+    // Route an element's arrays to their target group tables (table name -> columns). The
+    // returned pointers borrow from `arrays`.
+    std::map<std::string, GroupTableColumns> route_group_data(const char* caller,
+                                                              const std::string& collection,
+                                                              const std::map<std::string, std::vector<Value>>& arrays,
+                                                              bool delete_existing) const {
+        std::map<std::string, GroupTableColumns> table_columns;
 
         for (const auto& [array_name, values] : arrays) {
             // Empty array handling: create skips silently, update still routes (for DELETE)
@@ -276,7 +1099,7 @@ struct Database::Impl {
                 continue;
             }
 
-            auto matches = schema->find_all_tables_for_column(collection, array_name);
+            const auto& matches = schema->find_all_tables_for_column(collection, array_name);
             if (matches.empty()) {
                 throw std::runtime_error(std::string("Cannot ") + caller + ": array '" + array_name +
                                          "' does not match any vector, set, or time series table in collection '" +
@@ -293,12 +1116,13 @@ struct Database::Impl {
                 for (const auto& match : matches) {
                     table_list += (table_list.empty() ? "" : ", ") + match.table_name;
                 }
-                logger->warn("{}: array '{}' matches {} group tables ({}) and will be written to all of "
-                             "them; use update_vector_group/update_set_group to target one group",
-                             caller,
-                             array_name,
-                             matches.size(),
-                             table_list);
+                QLOG_WARN(logger,
+                          "{}: array '{}' matches {} group tables ({}) and will be written to all of "
+                          "them; use update_vector_group/update_set_group to target one group",
+                          caller,
+                          array_name,
+                          matches.size(),
+                          table_list);
             }
 
             for (const auto& match : matches) {
@@ -307,29 +1131,204 @@ struct Database::Impl {
                 entry.columns[array_name] = &values;
             }
         }
+        return table_columns;
+    }
 
-        for (const auto& [table_name, entry] : table_columns) {
+    void insert_group_data(const char* caller,
+                           const std::string& collection,
+                           int64_t element_id,
+                           const std::map<std::string, std::vector<Value>>& arrays,
+                           bool delete_existing,
+                           Database& db) {
+        for (const auto& [table_name, entry] : route_group_data(caller, collection, arrays, delete_existing)) {
+            if (entry.type == GroupTableType::TimeSeries &&
+                schema->packed_time_series_tables().count(table_name + "_packed") > 0) {
+                insert_rows_into_packed_table(caller, *schema->get_table(table_name), entry.columns, element_id, db);
+                continue;
+            }
             insert_rows_into_group_table(
                 caller, table_name, entry.type, entry.columns, element_id, delete_existing, db);
         }
     }
 
+    // Row-major values bound for one table and column list (columns.size() values per row).
+    // replace writes INSERT OR REPLACE.
+    struct InsertBatch {
+        std::vector<std::string> columns;
+        std::vector<Value> values;
+        bool replace = false;
+    };
+
+    // Write a batch with as few multi-row INSERTs as SQLite's bound-parameter limit allows. With
+    // `rowids`, appends the rowid of every inserted row: rows of one statement without an explicit
+    // rowid get consecutive ids (max(rowid) + 1, or the AUTOINCREMENT sequence + 1, per row), so
+    // each statement's range ends at sqlite3_last_insert_rowid.
+    void insert_batch(const std::string& table,
+                      const InsertBatch& batch,
+                      Database& db,
+                      std::vector<int64_t>* rowids = nullptr) {
+        const auto width = batch.columns.size();
+        if (width == 0 || batch.values.empty()) {
+            return;
+        }
+        const auto row_count = batch.values.size() / width;
+        const auto id_column =
+            static_cast<size_t>(std::find(batch.columns.begin(), batch.columns.end(), "id") - batch.columns.begin());
+        if (changes.active() && id_column < width && !schema->is_collection(table)) {
+            for (size_t r = 0; r < row_count; ++r) {
+                if (const auto* id = std::get_if<int64_t>(&batch.values[r * width + id_column])) {
+                    note_group_change(table, *id);
+                }
+            }
+        }
+        const auto max_variables = static_cast<size_t>(sqlite3_limit(this->db, SQLITE_LIMIT_VARIABLE_NUMBER, -1));
+        const auto rows_per_statement = std::max<size_t>(1, max_variables / width);
+
+        std::string prefix = (batch.replace ? "INSERT OR REPLACE INTO " : "INSERT INTO ") + table + " (";
+        std::string row_placeholders = "(";
+        for (size_t c = 0; c < width; ++c) {
+            prefix += (c > 0 ? ", " : "") + batch.columns[c];
+            row_placeholders += c > 0 ? ", ?" : "?";
+        }
+        prefix += ") VALUES ";
+        row_placeholders += ")";
+
+        for (size_t first = 0; first < row_count; first += rows_per_statement) {
+            const auto count = std::min(rows_per_statement, row_count - first);
+            auto sql = prefix;
+            sql.reserve(prefix.size() + count * (row_placeholders.size() + 2));
+            for (size_t r = 0; r < count; ++r) {
+                if (r > 0) {
+                    sql += ", ";
+                }
+                sql += row_placeholders;
+            }
+            db.execute(sql, std::span<const Value>(batch.values).subspan(first * width, count * width));
+            if (rowids) {
+                const auto last = sqlite3_last_insert_rowid(this->db);
+                for (auto id = last - static_cast<int64_t>(count) + 1; id <= last; ++id) {
+                    rowids->push_back(id);
+                }
+            }
+        }
+    }
+
     // Nothing is published until validation passes: a half-loaded state (schema set,
     // type_validator null) would survive a failed lazy load and crash the next call.
-    void load_schema_metadata() const {
-        auto loaded = std::make_unique<Schema>(Schema::from_database(db));
-        SchemaValidator(*loaded).validate();
-        // TypeValidator holds a reference to the Schema; moving the unique_ptr keeps the pointee.
-        type_validator = std::make_unique<TypeValidator>(*loaded);
+    // A lazy load skips validation when the stored fingerprint still matches and writes nothing;
+    // the fingerprint, the stored copy and the schema are read in one transaction so they agree.
+    // With `record`, the caller has just written the schema (apply_schema, migrate_up,
+    // ensure_indexes) in its own transaction: it is always validated and its fingerprint stored.
+    void load_schema_metadata(bool record = false) const {
+        auto run = [this](const char* sql) {
+            char* err_msg = nullptr;
+            if (sqlite3_exec(db, sql, nullptr, nullptr, &err_msg) != SQLITE_OK) {
+                std::string error = err_msg ? err_msg : "Unknown error";
+                sqlite3_free(err_msg);
+                throw std::runtime_error("Failed to load schema: " + std::string(sql) + ": " + error);
+            }
+        };
+
+        const bool snapshot = sqlite3_get_autocommit(db) != 0;
+        if (snapshot) {
+            run("BEGIN");
+        }
+        std::string fingerprint;
+        std::string stored;
+        std::shared_ptr<const Schema> loaded;
+        try {
+            fingerprint = std::to_string(SchemaValidator::kRevision) + ":" + Schema::fingerprint(db);
+            if (!record) {
+                stored = stored_schema_fingerprint();
+            }
+            loaded = std::make_shared<const Schema>(Schema::from_database(db));
+            if (snapshot) {
+                run("COMMIT");
+            }
+        } catch (...) {
+            // Also after a failed COMMIT, which would leave the read transaction open and make the
+            // next begin_transaction() fail.
+            if (snapshot && !sqlite3_get_autocommit(db)) {
+                sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+            }
+            throw;
+        }
+
+        if (!record && stored == fingerprint) {
+            QLOG_DEBUG(logger, "Schema unchanged since last validated ({}), skipping validation", fingerprint);
+        } else {
+            SchemaValidator(*loaded).validate();
+        }
+        if (record) {
+            store_schema_fingerprint(fingerprint);
+        }
+        // TypeValidator holds a reference to the Schema; moving the shared_ptr keeps the pointee.
+        type_validator = std::make_shared<const TypeValidator>(*loaded);
+        // Debug level: a schema that deliberately skips an index would otherwise warn on every open.
+        for (const auto& missing : IndexAdvisor(*loaded).missing_indexes()) {
+            QLOG_DEBUG(logger,
+                       "Missing index on {}: {}; ensure_indexes would run: {}",
+                       missing.table,
+                       missing.reason,
+                       missing.create_sql());
+        }
         schema = std::move(loaded);
     }
 
+    // The fingerprint recorded by the last validation, or empty when there is none.
+    std::string stored_schema_fingerprint() const {
+        const auto sql = std::string("SELECT fingerprint FROM ") + Schema::kFingerprintTable;
+        sqlite3_stmt* raw_stmt = nullptr;
+        if (sqlite3_prepare_v2(db, sql.c_str(), -1, &raw_stmt, nullptr) != SQLITE_OK) {
+            return {};  // no table yet
+        }
+        StmtPtr stmt(raw_stmt, sqlite3_finalize);
+        if (sqlite3_step(stmt.get()) != SQLITE_ROW) {
+            return {};
+        }
+        const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt.get(), 0));
+        return text ? text : "";
+    }
+
+    // Runs in the schema writer's transaction, so it commits or rolls back with the schema. Best
+    // effort: on a read-only, immutable or in-memory connection, in a dry run, or when a statement
+    // fails, nothing is stored and the next open validates again.
+    void store_schema_fingerprint(const std::string& fingerprint) const {
+        const auto* file = sqlite3_db_filename(db, "main");
+        if (immutable || dry_run || sqlite3_db_readonly(db, "main") != 0 || !file || *file == '\0') {
+            return;
+        }
+        const std::string table = Schema::kFingerprintTable;
+        const auto reset_sql = "CREATE TABLE IF NOT EXISTS " + table + " (fingerprint TEXT NOT NULL);"
+                               "DELETE FROM " + table + ";";
+        char* err_msg = nullptr;
+        if (sqlite3_exec(db, reset_sql.c_str(), nullptr, nullptr, &err_msg) != SQLITE_OK) {
+            QLOG_DEBUG(logger, "Schema fingerprint not stored: {}", err_msg ? err_msg : "unknown error");
+            sqlite3_free(err_msg);
+            return;
+        }
+        const auto insert_sql = "INSERT INTO " + table + " (fingerprint) VALUES (?)";
+        sqlite3_stmt* raw_stmt = nullptr;
+        if (sqlite3_prepare_v2(db, insert_sql.c_str(), -1, &raw_stmt, nullptr) != SQLITE_OK) {
+            QLOG_DEBUG(logger, "Schema fingerprint not stored: {}", sqlite3_errmsg(db));
+            return;
+        }
+        StmtPtr stmt(raw_stmt, sqlite3_finalize);
+        sqlite3_bind_text(stmt.get(), 1, fingerprint.c_str(), static_cast<int>(fingerprint.size()), SQLITE_STATIC);
+        if (sqlite3_step(stmt.get()) != SQLITE_DONE) {
+            QLOG_DEBUG(logger, "Schema fingerprint not stored: {}", sqlite3_errmsg(db));
+        }
+    }
+
     ~Impl() {
         if (db) {
-            logger->debug("Closing database: {}", path);
+            QLOG_DEBUG(logger, "Closing database: {}", path);
+            statements.clear();
+            // Cursors still open finalize after this Impl is gone.
+            sqlite3_trace_v2(db, 0, nullptr, nullptr);
             sqlite3_close_v2(db);
             db = nullptr;
-            logger->info("Database closed");
+            QLOG_INFO(logger, "Database closed");
         }
     }
 
@@ -341,7 +1340,7 @@ struct Database::Impl {
             sqlite3_free(err_msg);
             throw std::runtime_error("Failed to begin transaction: " + error);
         }
-        logger->debug("Transaction started");
+        QLOG_DEBUG(logger, "Transaction started");
     }
 
     void commit() {
@@ -350,9 +1349,11 @@ struct Database::Impl {
         if (rc != SQLITE_OK) {
             std::string error = err_msg ? err_msg : "Unknown error";
             sqlite3_free(err_msg);
+            changes.abandon_commit(!sqlite3_get_autocommit(db));
             throw std::runtime_error("Failed to commit transaction: " + error);
         }
-        logger->debug("Transaction committed");
+        QLOG_DEBUG(logger, "Transaction committed");
+        publish_changes();
     }
 
     void rollback() {
@@ -361,10 +1362,10 @@ struct Database::Impl {
         if (rc != SQLITE_OK) {
             std::string error = err_msg ? err_msg : "Unknown error";
             sqlite3_free(err_msg);
-            logger->error("Failed to rollback transaction: {}", error);
+            QLOG_ERROR(logger, "Failed to rollback transaction: {}", error);
             // Don't throw - rollback is often called in error recovery
         } else {
-            logger->debug("Transaction rolled back");
+            QLOG_DEBUG(logger, "Transaction rolled back");
         }
     }
 
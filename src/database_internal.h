@@ -2,6 +2,8 @@
 #define QUIVER_DATABASE_INTERNAL_H
 
 #include "quiver/attribute_metadata.h"
+#include "quiver/cursor.h"
+#include "quiver/database.h"
 #include "quiver/result.h"
 #include "quiver/schema.h"
 #include "quiver/value.h"
@@ -15,28 +17,31 @@
 
 namespace quiver::internal {
 
-// Type-specific Row value extractors for template implementations
-inline std::optional<int64_t> get_row_value(const Row& row, size_t index, int64_t*) {
-    return row.get_integer(index);
+// Type-specific cursor value extractors for template implementations
+inline std::optional<int64_t> get_cursor_value(const Cursor& cursor, size_t index, int64_t*) {
+    return cursor.get_integer(index);
 }
 
-inline std::optional<double> get_row_value(const Row& row, size_t index, double*) {
-    return row.get_float(index);
+inline std::optional<double> get_cursor_value(const Cursor& cursor, size_t index, double*) {
+    return cursor.get_float(index);
 }
 
-inline std::optional<std::string> get_row_value(const Row& row, size_t index, std::string*) {
-    return row.get_string(index);
+inline std::optional<std::string> get_cursor_value(const Cursor& cursor, size_t index, std::string*) {
+    return cursor.get_string(index);
 }
 
+// The readers below step a Cursor instead of taking a materialized Result, so each row is
+// converted straight into the output vector and never exists as a Row of Values.
+
 // Template for reading grouped values (vectors or sets) for all elements
 template <typename T>
-std::vector<std::vector<T>> read_grouped_values_all(const Result& result) {
+std::vector<std::vector<T>> read_grouped_values_all(Cursor cursor) {
     std::vector<std::vector<T>> groups;
     int64_t current_id = -1;
 
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        auto id = result[i].get_integer(0);
-        auto val = get_row_value(result[i], 1, static_cast<T*>(nullptr));
+    while (cursor.next()) {
+        auto id = cursor.get_integer(0);
+        auto val = get_cursor_value(cursor, 1, static_cast<T*>(nullptr));
 
         if (!id)
             continue;
@@ -57,11 +62,10 @@ std::vector<std::vector<T>> read_grouped_values_all(const Result& result) {
 // Drops NULLs — used by group readers (vector/set by id) and read_element_ids,
 // where the columns are NOT NULL / PK by schema convention so no NULL ever appears.
 template <typename T>
-std::vector<T> read_column_values(const Result& result) {
+std::vector<T> read_column_values(Cursor cursor) {
     std::vector<T> values;
-    values.reserve(result.row_count());
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        auto val = get_row_value(result[i], 0, static_cast<T*>(nullptr));
+    while (cursor.next()) {
+        auto val = get_cursor_value(cursor, 0, static_cast<T*>(nullptr));
         if (val) {
             values.push_back(*val);
         }
@@ -73,22 +77,35 @@ std::vector<T> read_column_values(const Result& result) {
 // One entry per result row (positional) — used only by the scalar bulk readers,
 // where ORDER BY rowid alignment with the element list must be preserved.
 template <typename T>
-std::vector<std::optional<T>> read_column_values_nullable(const Result& result) {
+std::vector<std::optional<T>> read_column_values_nullable(Cursor cursor) {
     std::vector<std::optional<T>> values;
-    values.reserve(result.row_count());
-    for (size_t i = 0; i < result.row_count(); ++i) {
-        values.push_back(get_row_value(result[i], 0, static_cast<T*>(nullptr)));
+    while (cursor.next()) {
+        values.push_back(get_cursor_value(cursor, 0, static_cast<T*>(nullptr)));
     }
     return values;
 }
 
-// Template for reading a single optional value (column 0, row 0) from query results
+// Template for reading column 0 into a ScalarColumn: same rows as read_column_values_nullable,
+// but each cell lands directly in the contiguous value buffer and validity mask.
+template <typename T>
+ScalarColumn<T> read_column_values_masked(Cursor cursor) {
+    ScalarColumn<T> column;
+    while (cursor.next()) {
+        auto val = get_cursor_value(cursor, 0, static_cast<T*>(nullptr));
+        column.values.push_back(val ? *val : T{});
+        column.valid.push_back(val ? 1 : 0);
+    }
+    return column;
+}
+
+// Template for reading a single optional value (column 0, row 0) from query results.
+// Only the first row is stepped; the rest of the statement is never evaluated.
 template <typename T>
-std::optional<T> read_single_value(const Result& result) {
-    if (result.empty()) {
+std::optional<T> read_single_value(Cursor cursor) {
+    if (!cursor.next()) {
         return std::nullopt;
     }
-    return get_row_value(result[0], 0, static_cast<T*>(nullptr));
+    return get_cursor_value(cursor, 0, static_cast<T*>(nullptr));
 }
 
 // Find the dimension/ordering column in a time series table
@@ -4,6 +4,7 @@
 namespace quiver {
 
 ScalarMetadata Database::get_scalar_metadata(const std::string& collection, const std::string& attribute) const {
+    const auto tracked = impl_->track("get_scalar_metadata");
     impl_->require_collection(collection, "get_scalar_metadata");
 
     const auto* table_def = impl_->schema->get_table(collection);
@@ -16,6 +17,7 @@ ScalarMetadata Database::get_scalar_metadata(const std::string& collection, cons
 }
 
 GroupMetadata Database::get_vector_metadata(const std::string& collection, const std::string& group_name) const {
+    const auto tracked = impl_->track("get_vector_metadata");
     impl_->require_collection(collection, "get_vector_metadata");
 
     // Find the vector table for this group
@@ -42,6 +44,7 @@ GroupMetadata Database::get_vector_metadata(const std::string& collection, const
 }
 
 GroupMetadata Database::get_set_metadata(const std::string& collection, const std::string& group_name) const {
+    const auto tracked = impl_->track("get_set_metadata");
     impl_->require_collection(collection, "get_set_metadata");
 
     // Find the set table for this group
@@ -68,6 +71,7 @@ GroupMetadata Database::get_set_metadata(const std::string& collection, const st
 }
 
 std::vector<ScalarMetadata> Database::list_scalar_attributes(const std::string& collection) const {
+    const auto tracked = impl_->track("list_scalar_attributes");
     impl_->require_collection(collection, "list_scalar_attributes");
 
     const auto* table_def = impl_->schema->get_table(collection);
@@ -80,6 +84,7 @@ std::vector<ScalarMetadata> Database::list_scalar_attributes(const std::string&
 }
 
 std::vector<GroupMetadata> Database::list_vector_groups(const std::string& collection) const {
+    const auto tracked = impl_->track("list_vector_groups");
     impl_->require_schema();
 
     std::vector<GroupMetadata> result;
@@ -90,6 +95,7 @@ std::vector<GroupMetadata> Database::list_vector_groups(const std::string& colle
 }
 
 std::vector<GroupMetadata> Database::list_set_groups(const std::string& collection) const {
+    const auto tracked = impl_->track("list_set_groups");
     impl_->require_schema();
 
     std::vector<GroupMetadata> result;
@@ -0,0 +1,118 @@
+#include "quiver/database_pool.h"
+
+#include "database_impl.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace quiver {
+
+struct DatabasePool::Impl {
+    std::string path;
+    std::vector<std::unique_ptr<Database>> readers;
+    // Readers not currently leased out; guarded by mutex.
+    std::vector<Database*> idle;
+    mutable std::mutex mutex;
+    std::condition_variable released;
+};
+
+DatabasePool::DatabasePool(const std::string& path, size_t readers, const DatabaseOptions& options)
+    : impl_(std::make_unique<Impl>()) {
+    // Each connection to ":memory:" is its own private database, so there is nothing to share.
+    if (path.empty() || path == ":memory:") {
+        throw std::runtime_error(
+            "Cannot open DatabasePool: an in-memory database cannot be shared between connections");
+    }
+    if (readers == 0) {
+        throw std::runtime_error("Cannot open DatabasePool: reader count must be at least 1");
+    }
+    impl_->path = path;
+
+    // Load and validate the schema once, through the connection that also switches the file to WAL
+    // (or through a read-only one when the caller asked not to touch the file).
+    auto setup_options = options;
+    if (!options.read_only && !options.immutable) {
+        setup_options.profile.journal_mode = JournalMode::Wal;
+    }
+    const Database setup(path, setup_options);
+    setup.impl_->require_schema();
+
+    auto reader_options = options;
+    reader_options.read_only = true;
+    impl_->readers.reserve(readers);
+    impl_->idle.reserve(readers);
+    for (size_t i = 0; i < readers; ++i) {
+        auto reader = std::unique_ptr<Database>(new Database(path, reader_options, &setup));
+        impl_->idle.push_back(reader.get());
+        impl_->readers.push_back(std::move(reader));
+    }
+}
+
+DatabasePool::~DatabasePool() = default;
+
+DatabasePool::Lease DatabasePool::acquire() {
+    std::unique_lock lock(impl_->mutex);
+    impl_->released.wait(lock, [this] { return !impl_->idle.empty(); });
+    auto* reader = impl_->idle.back();
+    impl_->idle.pop_back();
+    return Lease(this, reader);
+}
+
+std::optional<DatabasePool::Lease> DatabasePool::try_acquire() {
+    std::lock_guard lock(impl_->mutex);
+    if (impl_->idle.empty()) {
+        return std::nullopt;
+    }
+    auto* reader = impl_->idle.back();
+    impl_->idle.pop_back();
+    return Lease(this, reader);
+}
+
+size_t DatabasePool::size() const {
+    return impl_->readers.size();
+}
+
+size_t DatabasePool::available() const {
+    std::lock_guard lock(impl_->mutex);
+    return impl_->idle.size();
+}
+
+const std::string& DatabasePool::path() const {
+    return impl_->path;
+}
+
+void DatabasePool::release(Database* reader) {
+    {
+        std::lock_guard lock(impl_->mutex);
+        impl_->idle.push_back(reader);
+    }
+    impl_->released.notify_one();
+}
+
+DatabasePool::Lease::~Lease() {
+    if (pool_) {
+        pool_->release(reader_);
+    }
+}
+
+DatabasePool::Lease::Lease(Lease&& other) noexcept : pool_(other.pool_), reader_(other.reader_) {
+    other.pool_ = nullptr;
+    other.reader_ = nullptr;
+}
+
+DatabasePool::Lease& DatabasePool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        if (pool_) {
+            pool_->release(reader_);
+        }
+        pool_ = other.pool_;
+        reader_ = other.reader_;
+        other.pool_ = nullptr;
+        other.reader_ = nullptr;
+    }
+    return *this;
+}
+
+}  // namespace quiver
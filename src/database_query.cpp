@@ -1,30 +1,183 @@
 #include "database_impl.h"
+#include "database_internal.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <string_view>
 
 namespace quiver {
 
-std::optional<std::string> Database::query_string(const std::string& sql, const std::vector<Value>& parameters) {
-    auto result = execute(sql, parameters);
-    if (result.empty()) {
-        return std::nullopt;
+namespace {
+
+// Builds one QueryTable column cell by cell. The storage type is fixed by the first non-NULL cell
+// (NULLs before it are counted and back-filled), except that a REAL cell widens an INTEGER column.
+class QueryColumnBuilder {
+public:
+    explicit QueryColumnBuilder(std::string name) { column_.name = std::move(name); }
+
+    void append(sqlite3_stmt* stmt, int index) {
+        const auto type = sqlite3_column_type(stmt, index);
+        if (type == SQLITE_NULL) {
+            column_.valid.push_back(0);
+            if (type_ != SQLITE_NULL) {
+                std::visit([](auto& values) { values.emplace_back(); }, column_.values);
+            }
+            return;
+        }
+        column_.valid.push_back(1);
+        switch (type) {
+        case SQLITE_INTEGER:
+            if (type_ == SQLITE_FLOAT) {
+                std::get<std::vector<double>>(column_.values)
+                    .push_back(static_cast<double>(sqlite3_column_int64(stmt, index)));
+            } else {
+                values_as<int64_t>(SQLITE_INTEGER).push_back(sqlite3_column_int64(stmt, index));
+            }
+            break;
+        case SQLITE_FLOAT:
+            if (type_ == SQLITE_INTEGER) {
+                widen_to_float();
+            }
+            values_as<double>(SQLITE_FLOAT).push_back(sqlite3_column_double(stmt, index));
+            break;
+        case SQLITE_TEXT: {
+            const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, index));
+            values_as<std::string>(SQLITE_TEXT).emplace_back(text, sqlite3_column_bytes(stmt, index));
+            break;
+        }
+        default:
+            throw std::runtime_error("Cannot query_table: column '" + column_.name + "' holds a BLOB value");
+        }
+    }
+
+    // An all-NULL column has no cell to type it, so it follows the declared type's affinity.
+    TypedColumn finish(const char* decltype_name) {
+        if (type_ == SQLITE_NULL) {
+            std::string declared = decltype_name ? decltype_name : "";
+            std::transform(declared.begin(), declared.end(), declared.begin(), [](unsigned char c) {
+                return static_cast<char>(std::toupper(c));
+            });
+            const auto has = [&declared](std::string_view part) { return declared.find(part) != std::string::npos; };
+            const auto rows = column_.valid.size();
+            if (has("INT")) {
+                column_.values = std::vector<int64_t>(rows);
+            } else if (has("CHAR") || has("CLOB") || has("TEXT")) {
+                column_.values = std::vector<std::string>(rows);
+            } else if (has("REAL") || has("FLOA") || has("DOUB")) {
+                column_.values = std::vector<double>(rows);
+            } else {
+                column_.values = std::vector<int64_t>(rows);
+            }
+        }
+        return std::move(column_);
+    }
+
+private:
+    TypedColumn column_;
+    int type_ = SQLITE_NULL;
+
+    template <typename T>
+    std::vector<T>& values_as(int type) {
+        if (type_ == SQLITE_NULL) {
+            type_ = type;
+            column_.values = std::vector<T>(column_.valid.size() - 1);
+        } else if (type_ != type) {
+            throw std::runtime_error("Cannot query_table: column '" + column_.name + "' mixes TEXT and numeric values");
+        }
+        return std::get<std::vector<T>>(column_.values);
+    }
+
+    void widen_to_float() {
+        const auto& integers = std::get<std::vector<int64_t>>(column_.values);
+        std::vector<double> widened(integers.begin(), integers.end());
+        column_.values = std::move(widened);
+        type_ = SQLITE_FLOAT;
     }
-    return result[0].get_string(0);
+};
+
+}  // namespace
+
+// Each query_* drains its cursor before returning, while the caller's parameters are still alive,
+// so text parameters are bound in place rather than copied.
+
+std::optional<std::string> Database::query_string(const std::string& sql, const std::vector<Value>& parameters) {
+    const auto tracked = impl_->track("query_string");
+    return internal::read_single_value<std::string>(prepare_cursor(sql, parameters, true));
 }
 
 std::optional<int64_t> Database::query_integer(const std::string& sql, const std::vector<Value>& parameters) {
-    auto result = execute(sql, parameters);
-    if (result.empty()) {
-        return std::nullopt;
-    }
-    return result[0].get_integer(0);
+    const auto tracked = impl_->track("query_integer");
+    return internal::read_single_value<int64_t>(prepare_cursor(sql, parameters, true));
 }
 
 std::optional<double> Database::query_float(const std::string& sql, const std::vector<Value>& parameters) {
-    auto result = execute(sql, parameters);
-    if (result.empty()) {
-        return std::nullopt;
+    const auto tracked = impl_->track("query_float");
+    // Cursor::get_float widens an INTEGER result (the one scalar typing policy) - see src/row.cpp.
+    return internal::read_single_value<double>(prepare_cursor(sql, parameters, true));
+}
+
+QueryTable Database::query_table(const std::string& sql, const std::vector<Value>& parameters) {
+    const auto tracked = impl_->track("query_table");
+    auto cursor = prepare_cursor(sql, parameters, true);
+    auto* stmt = cursor.impl_->stmt();
+
+    std::vector<QueryColumnBuilder> builders;
+    builders.reserve(cursor.column_count());
+    for (const auto& name : cursor.columns()) {
+        builders.emplace_back(name);
+    }
+
+    // Cells are read straight off the statement into the typed columns: no Row or Value per cell.
+    QueryTable table;
+    while (cursor.next()) {
+        for (size_t c = 0; c < builders.size(); ++c) {
+            builders[c].append(stmt, static_cast<int>(c));
+        }
+        ++table.row_count;
+    }
+
+    table.columns.reserve(builders.size());
+    for (size_t c = 0; c < builders.size(); ++c) {
+        table.columns.push_back(builders[c].finish(sqlite3_column_decltype(stmt, static_cast<int>(c))));
+    }
+    return table;
+}
+
+namespace {
+
+template <typename T>
+Value to_json_array(std::span<const T> values) {
+    std::string json = "[";
+    json.reserve(values.size() * 8 + 2);
+    char buffer[32];
+    for (size_t i = 0; i < values.size(); ++i) {
+        if constexpr (std::is_same_v<T, double>) {
+            if (!std::isfinite(values[i])) {
+                throw std::runtime_error("Cannot array_parameter: value at index " + std::to_string(i) +
+                                         " is not finite");
+            }
+        }
+        if (i > 0) {
+            json += ',';
+        }
+        // Shortest round-trip form, independent of the locale.
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), values[i]);
+        json.append(buffer, result.ptr);
     }
-    // Row::get_float widens an INTEGER result (the one scalar typing policy) - see src/row.cpp.
-    return result[0].get_float(0);
+    json += ']';
+    return json;
+}
+
+}  // namespace
+
+Value array_parameter(std::span<const int64_t> values) {
+    return to_json_array(values);
+}
+
+Value array_parameter(std::span<const double> values) {
+    return to_json_array(values);
 }
 
 }  // namespace quiver
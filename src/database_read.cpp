@@ -3,160 +3,249 @@
 
 namespace quiver {
 
+namespace {
+
+template <typename Column>
+struct ScalarColumnReader;
+
+template <typename T>
+struct ScalarColumnReader<std::vector<std::optional<T>>> {
+    static std::vector<std::optional<T>> read(Cursor cursor) {
+        return internal::read_column_values_nullable<T>(std::move(cursor));
+    }
+};
+
+template <typename T>
+struct ScalarColumnReader<ScalarColumn<T>> {
+    static ScalarColumn<T> read(Cursor cursor) { return internal::read_column_values_masked<T>(std::move(cursor)); }
+};
+
+}  // namespace
+
+template <typename Column>
+Column
+Database::read_scalar_column(const char* operation, const std::string& collection, const std::string& attribute) {
+    const auto tracked = impl_->track(operation);
+    impl_->require_collection(collection, operation);
+    impl_->require_column(collection, attribute, operation);
+    auto sql = "SELECT " + attribute + " FROM " + collection + " ORDER BY rowid";
+    return ScalarColumnReader<Column>::read(cursor(sql));
+}
+
 std::vector<std::optional<int64_t>> Database::read_scalar_integers(const std::string& collection,
                                                                    const std::string& attribute) {
-    impl_->require_collection(collection, "read_scalar_integers");
-    impl_->require_column(collection, attribute, "read_scalar_integers");
-    auto sql = "SELECT " + attribute + " FROM " + collection + " ORDER BY rowid";
-    return internal::read_column_values_nullable<int64_t>(execute(sql));
+    return read_scalar_column<std::vector<std::optional<int64_t>>>("read_scalar_integers", collection, attribute);
 }
 
 std::vector<std::optional<double>> Database::read_scalar_floats(const std::string& collection,
                                                                 const std::string& attribute) {
-    impl_->require_collection(collection, "read_scalar_floats");
-    impl_->require_column(collection, attribute, "read_scalar_floats");
-    auto sql = "SELECT " + attribute + " FROM " + collection + " ORDER BY rowid";
-    return internal::read_column_values_nullable<double>(execute(sql));
+    return read_scalar_column<std::vector<std::optional<double>>>("read_scalar_floats", collection, attribute);
 }
 
 std::vector<std::optional<std::string>> Database::read_scalar_strings(const std::string& collection,
                                                                       const std::string& attribute) {
-    impl_->require_collection(collection, "read_scalar_strings");
-    impl_->require_column(collection, attribute, "read_scalar_strings");
-    auto sql = "SELECT " + attribute + " FROM " + collection + " ORDER BY rowid";
-    return internal::read_column_values_nullable<std::string>(execute(sql));
+    return read_scalar_column<std::vector<std::optional<std::string>>>("read_scalar_strings", collection, attribute);
+}
+
+ScalarColumn<int64_t> Database::read_scalar_integers_column(const std::string& collection,
+                                                            const std::string& attribute) {
+    return read_scalar_column<ScalarColumn<int64_t>>("read_scalar_integers_column", collection, attribute);
+}
+
+ScalarColumn<double> Database::read_scalar_floats_column(const std::string& collection,
+                                                         const std::string& attribute) {
+    return read_scalar_column<ScalarColumn<double>>("read_scalar_floats_column", collection, attribute);
 }
 
 std::optional<int64_t>
 Database::read_scalar_integer_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_scalar_integer_by_id");
     impl_->require_collection(collection, "read_scalar_integer_by_id");
     impl_->require_column(collection, attribute, "read_scalar_integer_by_id");
     auto sql = "SELECT " + attribute + " FROM " + collection + " WHERE id = ?";
-    return internal::read_single_value<int64_t>(execute(sql, {id}));
+    return internal::read_single_value<int64_t>(cursor(sql, {id}));
 }
 
 std::optional<double>
 Database::read_scalar_float_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_scalar_float_by_id");
     impl_->require_collection(collection, "read_scalar_float_by_id");
     impl_->require_column(collection, attribute, "read_scalar_float_by_id");
     auto sql = "SELECT " + attribute + " FROM " + collection + " WHERE id = ?";
-    return internal::read_single_value<double>(execute(sql, {id}));
+    return internal::read_single_value<double>(cursor(sql, {id}));
 }
 
 std::optional<std::string>
 Database::read_scalar_string_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_scalar_string_by_id");
     impl_->require_collection(collection, "read_scalar_string_by_id");
     impl_->require_column(collection, attribute, "read_scalar_string_by_id");
     auto sql = "SELECT " + attribute + " FROM " + collection + " WHERE id = ?";
-    return internal::read_single_value<std::string>(execute(sql, {id}));
+    return internal::read_single_value<std::string>(cursor(sql, {id}));
+}
+
+namespace {
+
+// One statement for the whole id list: json_each walks the ids in order and each one probes the
+// collection's primary key, so the output lines up with the input (missing ids join to NULL).
+std::string by_ids_sql(const std::string& collection, const std::string& attribute) {
+    return "SELECT c." + attribute + " FROM json_each(?) AS ids LEFT JOIN " + collection +
+           " AS c ON c.id = ids.value ORDER BY ids.key";
+}
+
+}  // namespace
+
+ScalarColumn<int64_t> Database::read_scalar_integers_by_ids(const std::string& collection,
+                                                            const std::string& attribute,
+                                                            std::span<const int64_t> ids) {
+    const auto tracked = impl_->track("read_scalar_integers_by_ids");
+    impl_->require_collection(collection, "read_scalar_integers_by_ids");
+    impl_->require_column(collection, attribute, "read_scalar_integers_by_ids");
+    const std::vector<Value> parameters{array_parameter(ids)};
+    return internal::read_column_values_masked<int64_t>(
+        prepare_cursor(by_ids_sql(collection, attribute), parameters, true));
+}
+
+ScalarColumn<double> Database::read_scalar_floats_by_ids(const std::string& collection,
+                                                         const std::string& attribute,
+                                                         std::span<const int64_t> ids) {
+    const auto tracked = impl_->track("read_scalar_floats_by_ids");
+    impl_->require_collection(collection, "read_scalar_floats_by_ids");
+    impl_->require_column(collection, attribute, "read_scalar_floats_by_ids");
+    const std::vector<Value> parameters{array_parameter(ids)};
+    return internal::read_column_values_masked<double>(
+        prepare_cursor(by_ids_sql(collection, attribute), parameters, true));
+}
+
+std::vector<std::optional<std::string>> Database::read_scalar_strings_by_ids(const std::string& collection,
+                                                                             const std::string& attribute,
+                                                                             std::span<const int64_t> ids) {
+    const auto tracked = impl_->track("read_scalar_strings_by_ids");
+    impl_->require_collection(collection, "read_scalar_strings_by_ids");
+    impl_->require_column(collection, attribute, "read_scalar_strings_by_ids");
+    const std::vector<Value> parameters{array_parameter(ids)};
+    return internal::read_column_values_nullable<std::string>(
+        prepare_cursor(by_ids_sql(collection, attribute), parameters, true));
 }
 
 std::vector<std::vector<int64_t>> Database::read_vector_integers(const std::string& collection,
                                                                  const std::string& attribute) {
+    const auto tracked = impl_->track("read_vector_integers");
     impl_->require_collection(collection, "read_vector_integers");
     auto vector_table = impl_->schema->find_vector_table(collection, attribute);
     impl_->require_column(vector_table, attribute, "read_vector_integers");
     auto sql = "SELECT id, " + attribute + " FROM " + vector_table + " ORDER BY id, vector_index";
-    return internal::read_grouped_values_all<int64_t>(execute(sql));
+    return internal::read_grouped_values_all<int64_t>(cursor(sql));
 }
 
 std::vector<std::vector<double>> Database::read_vector_floats(const std::string& collection,
                                                               const std::string& attribute) {
+    const auto tracked = impl_->track("read_vector_floats");
     impl_->require_collection(collection, "read_vector_floats");
     auto vector_table = impl_->schema->find_vector_table(collection, attribute);
     impl_->require_column(vector_table, attribute, "read_vector_floats");
     auto sql = "SELECT id, " + attribute + " FROM " + vector_table + " ORDER BY id, vector_index";
-    return internal::read_grouped_values_all<double>(execute(sql));
+    return internal::read_grouped_values_all<double>(cursor(sql));
 }
 
 std::vector<std::vector<std::string>> Database::read_vector_strings(const std::string& collection,
                                                                     const std::string& attribute) {
+    const auto tracked = impl_->track("read_vector_strings");
     impl_->require_collection(collection, "read_vector_strings");
     auto vector_table = impl_->schema->find_vector_table(collection, attribute);
     impl_->require_column(vector_table, attribute, "read_vector_strings");
     auto sql = "SELECT id, " + attribute + " FROM " + vector_table + " ORDER BY id, vector_index";
-    return internal::read_grouped_values_all<std::string>(execute(sql));
+    return internal::read_grouped_values_all<std::string>(cursor(sql));
 }
 
 std::vector<int64_t>
 Database::read_vector_integers_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_vector_integers_by_id");
     impl_->require_collection(collection, "read_vector_integers_by_id");
     auto vector_table = impl_->schema->find_vector_table(collection, attribute);
     impl_->require_column(vector_table, attribute, "read_vector_integers_by_id");
     auto sql = "SELECT " + attribute + " FROM " + vector_table + " WHERE id = ? ORDER BY vector_index";
-    return internal::read_column_values<int64_t>(execute(sql, {id}));
+    return internal::read_column_values<int64_t>(cursor(sql, {id}));
 }
 
 std::vector<double>
 Database::read_vector_floats_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_vector_floats_by_id");
     impl_->require_collection(collection, "read_vector_floats_by_id");
     auto vector_table = impl_->schema->find_vector_table(collection, attribute);
     impl_->require_column(vector_table, attribute, "read_vector_floats_by_id");
     auto sql = "SELECT " + attribute + " FROM " + vector_table + " WHERE id = ? ORDER BY vector_index";
-    return internal::read_column_values<double>(execute(sql, {id}));
+    return internal::read_column_values<double>(cursor(sql, {id}));
 }
 
 std::vector<std::string>
 Database::read_vector_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_vector_strings_by_id");
     impl_->require_collection(collection, "read_vector_strings_by_id");
     auto vector_table = impl_->schema->find_vector_table(collection, attribute);
     impl_->require_column(vector_table, attribute, "read_vector_strings_by_id");
     auto sql = "SELECT " + attribute + " FROM " + vector_table + " WHERE id = ? ORDER BY vector_index";
-    return internal::read_column_values<std::string>(execute(sql, {id}));
+    return internal::read_column_values<std::string>(cursor(sql, {id}));
 }
 
 std::vector<std::vector<int64_t>> Database::read_set_integers(const std::string& collection,
                                                               const std::string& attribute) {
+    const auto tracked = impl_->track("read_set_integers");
     impl_->require_collection(collection, "read_set_integers");
     auto set_table = impl_->schema->find_set_table(collection, attribute);
     impl_->require_column(set_table, attribute, "read_set_integers");
     auto sql = "SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id";
-    return internal::read_grouped_values_all<int64_t>(execute(sql));
+    return internal::read_grouped_values_all<int64_t>(cursor(sql));
 }
 
 std::vector<std::vector<double>> Database::read_set_floats(const std::string& collection,
                                                            const std::string& attribute) {
+    const auto tracked = impl_->track("read_set_floats");
     impl_->require_collection(collection, "read_set_floats");
     auto set_table = impl_->schema->find_set_table(collection, attribute);
     impl_->require_column(set_table, attribute, "read_set_floats");
     auto sql = "SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id";
-    return internal::read_grouped_values_all<double>(execute(sql));
+    return internal::read_grouped_values_all<double>(cursor(sql));
 }
 
 std::vector<std::vector<std::string>> Database::read_set_strings(const std::string& collection,
                                                                  const std::string& attribute) {
+    const auto tracked = impl_->track("read_set_strings");
     impl_->require_collection(collection, "read_set_strings");
     auto set_table = impl_->schema->find_set_table(collection, attribute);
     impl_->require_column(set_table, attribute, "read_set_strings");
     auto sql = "SELECT id, " + attribute + " FROM " + set_table + " ORDER BY id";
-    return internal::read_grouped_values_all<std::string>(execute(sql));
+    return internal::read_grouped_values_all<std::string>(cursor(sql));
 }
 
 std::vector<int64_t>
 Database::read_set_integers_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_set_integers_by_id");
     impl_->require_collection(collection, "read_set_integers_by_id");
     auto set_table = impl_->schema->find_set_table(collection, attribute);
     impl_->require_column(set_table, attribute, "read_set_integers_by_id");
     auto sql = "SELECT " + attribute + " FROM " + set_table + " WHERE id = ?";
-    return internal::read_column_values<int64_t>(execute(sql, {id}));
+    return internal::read_column_values<int64_t>(cursor(sql, {id}));
 }
 
 std::vector<double>
 Database::read_set_floats_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_set_floats_by_id");
     impl_->require_collection(collection, "read_set_floats_by_id");
     auto set_table = impl_->schema->find_set_table(collection, attribute);
     impl_->require_column(set_table, attribute, "read_set_floats_by_id");
     auto sql = "SELECT " + attribute + " FROM " + set_table + " WHERE id = ?";
-    return internal::read_column_values<double>(execute(sql, {id}));
+    return internal::read_column_values<double>(cursor(sql, {id}));
 }
 
 std::vector<std::string>
 Database::read_set_strings_by_id(const std::string& collection, const std::string& attribute, int64_t id) {
+    const auto tracked = impl_->track("read_set_strings_by_id");
     impl_->require_collection(collection, "read_set_strings_by_id");
     auto set_table = impl_->schema->find_set_table(collection, attribute);
     impl_->require_column(set_table, attribute, "read_set_strings_by_id");
     auto sql = "SELECT " + attribute + " FROM " + set_table + " WHERE id = ?";
-    return internal::read_column_values<std::string>(execute(sql, {id}));
+    return internal::read_column_values<std::string>(cursor(sql, {id}));
 }
 
 namespace {
@@ -189,6 +278,7 @@ std::vector<std::map<std::string, Value>> group_rows_from_result(const GroupMeta
 
 std::vector<std::map<std::string, Value>>
 Database::read_vector_group_by_id(const std::string& collection, const std::string& group, int64_t id) {
+    const auto tracked = impl_->track("read_vector_group_by_id");
     impl_->require_collection(collection, "read_vector_group_by_id");
     auto metadata = get_vector_metadata(collection, group);
     if (metadata.value_columns.empty()) {
@@ -200,6 +290,7 @@ Database::read_vector_group_by_id(const std::string& collection, const std::stri
 
 std::vector<std::map<std::string, Value>>
 Database::read_set_group_by_id(const std::string& collection, const std::string& group, int64_t id) {
+    const auto tracked = impl_->track("read_set_group_by_id");
     impl_->require_collection(collection, "read_set_group_by_id");
     auto metadata = get_set_metadata(collection, group);
     if (metadata.value_columns.empty()) {
@@ -210,12 +301,14 @@ Database::read_set_group_by_id(const std::string& collection, const std::string&
 }
 
 std::vector<int64_t> Database::read_element_ids(const std::string& collection) {
+    const auto tracked = impl_->track("read_element_ids");
     impl_->require_collection(collection, "read_element_ids");
     auto sql = "SELECT id FROM " + collection + " ORDER BY rowid";
-    return internal::read_column_values<int64_t>(execute(sql));
+    return internal::read_column_values<int64_t>(cursor(sql));
 }
 
 int64_t Database::number_of_elements(const std::string& collection) const {
+    const auto tracked = impl_->track("number_of_elements");
     impl_->require_collection(collection, "number_of_elements");
     return query_int_rows(impl_->db, "SELECT COUNT(*) FROM \"" + collection + "\"")[0][0];
 }
@@ -0,0 +1,86 @@
+#include "database_impl.h"
+
+#include <algorithm>
+
+namespace quiver {
+
+namespace {
+
+// Nearest-rank percentile of an already sorted, non-empty sample.
+int64_t percentile(const std::vector<int64_t>& sorted, size_t percent) {
+    const auto rank = (sorted.size() * percent + 99) / 100;
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+}  // namespace
+
+std::vector<OperationStats> OperationMetrics::snapshot() const {
+    std::vector<OperationStats> result;
+    result.reserve(operations_.size());
+    for (const auto& [name, counters] : operations_) {
+        if (counters.calls == 0) {
+            continue;  // reset while in progress
+        }
+        auto sorted = counters.latencies;
+        std::sort(sorted.begin(), sorted.end());
+        result.push_back({
+            .operation = name,
+            .calls = counters.calls,
+            .total_ns = counters.total_ns,
+            .p50_ns = percentile(sorted, 50),
+            .p99_ns = percentile(sorted, 99),
+            .rows_read = counters.rows_read,
+            .rows_written = counters.rows_written,
+            .statements_prepared = counters.statements_prepared,
+            .statements_reused = counters.statements_reused,
+            .bytes_bound = counters.bytes_bound,
+        });
+    }
+    return result;
+}
+
+void OperationMetrics::reset() {
+    for (auto it = operations_.begin(); it != operations_.end();) {
+        if (&it->second == current_) {
+            it->second = Counters{};
+            ++it;
+        } else {
+            it = operations_.erase(it);
+        }
+    }
+}
+
+void Database::enable_stats(bool enabled) {
+    const auto lock = impl_->lock_shared_access();
+    impl_->metrics.set_enabled(enabled);
+    QLOG_DEBUG(impl_->logger, "Operation stats {}", enabled ? "enabled" : "disabled");
+}
+
+bool Database::stats_enabled() const {
+    const auto lock = impl_->lock_shared_access();
+    return impl_->metrics.enabled();
+}
+
+std::vector<OperationStats> Database::stats() const {
+    const auto lock = impl_->lock_shared_access();
+    return impl_->metrics.snapshot();
+}
+
+void Database::reset_stats() {
+    const auto lock = impl_->lock_shared_access();
+    impl_->metrics.reset();
+}
+
+std::vector<TracedStatement> Database::traced_statements() const {
+    const auto lock = impl_->lock_shared_access();
+    return impl_->tracer ? impl_->tracer->entries() : std::vector<TracedStatement>{};
+}
+
+void Database::clear_traced_statements() {
+    const auto lock = impl_->lock_shared_access();
+    if (impl_->tracer) {
+        impl_->tracer->clear();
+    }
+}
+
+}  // namespace quiver
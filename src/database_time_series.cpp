@@ -1,6 +1,10 @@
 #include "database_impl.h"
 #include "database_internal.h"
 
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
 namespace quiver {
 
 namespace {
@@ -15,6 +19,24 @@ std::map<std::string, DataType> time_series_schema_types(const TableDefinition&
     return types;
 }
 
+// The dimension an as-of read (read_time_series_row / read_time_series_rows) walks. "Last value at
+// or before a timestamp" has no single answer when further dimension columns (a block, a scenario)
+// split each timestamp into several rows, so such groups are rejected rather than answered from
+// whichever row the scan happens to meet last.
+std::string as_of_dimension_column(const std::string& caller,
+                                   const TableDefinition& table_def,
+                                   const std::string& collection,
+                                   const std::string& group) {
+    const auto key_columns = std::count_if(table_def.columns.begin(), table_def.columns.end(), [](const auto& entry) {
+        return entry.first != "id" && entry.second.primary_key;
+    });
+    if (key_columns > 1) {
+        throw std::runtime_error("Cannot " + caller + ": group '" + group + "' of collection '" + collection +
+                                 "' has more than one dimension column; use read_time_series_group instead");
+    }
+    return internal::find_dimension_column(table_def);
+}
+
 // Shared validation for update_time_series_group / upsert_time_series_row: every
 // dimension column must be present, all caller columns must exist in the
 // schema, and values must match column types.
@@ -46,6 +68,7 @@ void validate_time_series_row(const std::string& caller,
 }  // namespace
 
 std::vector<GroupMetadata> Database::list_time_series_groups(const std::string& collection) const {
+    const auto tracked = impl_->track("list_time_series_groups");
     impl_->require_schema();
 
     std::vector<GroupMetadata> result;
@@ -56,6 +79,7 @@ std::vector<GroupMetadata> Database::list_time_series_groups(const std::string&
 }
 
 GroupMetadata Database::get_time_series_metadata(const std::string& collection, const std::string& group_name) const {
+    const auto tracked = impl_->track("get_time_series_metadata");
     impl_->require_collection(collection, "get_time_series_metadata");
 
     // Find the time series table for this group
@@ -85,6 +109,7 @@ GroupMetadata Database::get_time_series_metadata(const std::string& collection,
 
 std::vector<std::map<std::string, Value>>
 Database::read_time_series_group(const std::string& collection, const std::string& group, int64_t id) {
+    const auto tracked = impl_->track("read_time_series_group");
     impl_->require_collection(collection, "read_time_series_group");
 
     auto ts_table = impl_->schema->find_time_series_table(collection, group);
@@ -94,6 +119,11 @@ Database::read_time_series_group(const std::string& collection, const std::strin
     }
     auto dim_col = internal::find_dimension_column(*table_def);
 
+    if (impl_->schema->is_packed_time_series_group(collection, group)) {
+        const auto packed = impl_->packed_group(*table_def);
+        return impl_->packed_series_to_rows(packed, impl_->load_packed_series(packed, id));
+    }
+
     // Build column list (excluding id)
     std::vector<std::string> columns;
     columns.push_back(dim_col);
@@ -128,11 +158,100 @@ Database::read_time_series_group(const std::string& collection, const std::strin
     return rows;
 }
 
+TimeSeriesData Database::read_time_series_group_all(const std::string& collection, const std::string& group) {
+    const auto tracked = impl_->track("read_time_series_group_all");
+    impl_->require_collection(collection, "read_time_series_group_all");
+
+    auto ts_table = impl_->schema->find_time_series_table(collection, group);
+    const auto* table_def = impl_->schema->get_table(ts_table);
+    if (!table_def) {
+        throw std::runtime_error("Time series table not found: " + ts_table);
+    }
+    const auto dim_cols = internal::find_dimension_columns(*table_def);
+
+    std::vector<const ColumnDefinition*> column_defs;
+    for (const auto& dim_col : dim_cols) {
+        column_defs.push_back(table_def->get_column(dim_col));
+    }
+    for (const auto& col_name : table_def->column_order) {
+        if (col_name != "id" && std::find(dim_cols.begin(), dim_cols.end(), col_name) == dim_cols.end()) {
+            column_defs.push_back(table_def->get_column(col_name));
+        }
+    }
+
+    TimeSeriesData data;
+    std::string sql = "SELECT id";
+    for (const auto* col_def : column_defs) {
+        sql += ", " + col_def->name;
+        auto& column = data.columns.emplace_back();
+        column.name = col_def->name;
+        if (col_def->type == DataType::Integer) {
+            column.values = std::vector<int64_t>{};
+        } else if (col_def->type == DataType::Real) {
+            column.values = std::vector<double>{};
+        } else {
+            column.values = std::vector<std::string>{};
+        }
+    }
+    if (impl_->schema->is_packed_time_series_group(collection, group)) {
+        // Packed groups have a single DATE_TIME dimension, read back as formatted strings.
+        const auto packed = impl_->packed_group(*table_def);
+        impl_->scan_packed_series(packed, [&data](int64_t id, internal::PackedSeries&& series) {
+            auto& times = data.columns.front();
+            for (auto time : series.times) {
+                data.ids.push_back(id);
+                std::get<std::vector<std::string>>(times.values).push_back(internal::format_packed_time(time));
+                times.valid.push_back(1);
+            }
+            for (size_t c = 0; c < series.columns.size(); ++c) {
+                auto& column = data.columns[c + 1];
+                std::visit(
+                    [&](auto& values) {
+                        using Values = std::decay_t<decltype(values)>;
+                        const auto& decoded = std::get<Values>(series.columns[c].values);
+                        values.insert(values.end(), decoded.begin(), decoded.end());
+                    },
+                    column.values);
+                column.valid.insert(column.valid.end(), series.columns[c].valid.begin(), series.columns[c].valid.end());
+            }
+        });
+        return data;
+    }
+
+    // The (id, dimensions...) primary key index serves this ORDER BY, so no sort step runs.
+    sql += " FROM " + ts_table + " ORDER BY id";
+    for (const auto& dim_col : dim_cols) {
+        sql += ", " + dim_col;
+    }
+
+    auto rows = cursor(sql);
+    while (rows.next()) {
+        auto id = rows.get_integer(0);
+        if (!id)
+            continue;
+        data.ids.push_back(*id);
+        for (size_t c = 0; c < data.columns.size(); ++c) {
+            auto& column = data.columns[c];
+            std::visit(
+                [&](auto& values) {
+                    using T = typename std::decay_t<decltype(values)>::value_type;
+                    auto val = internal::get_cursor_value(rows, c + 1, static_cast<T*>(nullptr));
+                    values.push_back(val ? std::move(*val) : T{});
+                    column.valid.push_back(val ? 1 : 0);
+                },
+                column.values);
+        }
+    }
+    return data;
+}
+
 void Database::update_time_series_group(const std::string& collection,
                                         const std::string& group,
                                         int64_t id,
                                         const std::vector<std::map<std::string, Value>>& rows) {
-    impl_->logger->debug("Updating time series {}.{} for id {} with {} rows", collection, group, id, rows.size());
+    const auto tracked = impl_->track("update_time_series_group");
+    impl_->require_writable("update_time_series_group");
+    QLOG_DEBUG(impl_->logger, "Updating time series {}.{} for id {} with {} rows", collection, group, id, rows.size());
     impl_->require_collection(collection, "update_time_series_group");
 
     auto ts_table = impl_->schema->find_time_series_table(collection, group);
@@ -149,11 +268,23 @@ void Database::update_time_series_group(const std::string& collection,
         validate_time_series_row("update_time_series_group", schema_types, dim_cols, collection, group, row);
     }
 
+    if (impl_->schema->is_packed_time_series_group(collection, group)) {
+        const auto packed = impl_->packed_group(*table_def);
+        const auto series = impl_->packed_series_from_rows("update_time_series_group", packed, rows);
+        Impl::TransactionGuard txn(*impl_);
+        impl_->store_packed_series("update_time_series_group", packed, id, series, *this);
+        txn.commit();
+        QLOG_INFO(
+            impl_->logger, "Updated time series {}.{} for id {} with {} rows", collection, group, id, rows.size());
+        return;
+    }
+
     Impl::TransactionGuard txn(*impl_);
 
     // Delete existing time series data for this element
     auto delete_sql = "DELETE FROM " + ts_table + " WHERE id = ?";
     execute(delete_sql, {id});
+    impl_->note_group_change(ts_table, id);
 
     if (rows.empty()) {
         txn.commit();
@@ -198,14 +329,21 @@ void Database::update_time_series_group(const std::string& collection,
     }
 
     txn.commit();
-    impl_->logger->info("Updated time series {}.{} for id {} with {} rows", collection, group, id, rows.size());
+    QLOG_INFO(impl_->logger, "Updated time series {}.{} for id {} with {} rows", collection, group, id, rows.size());
 }
 
 void Database::upsert_time_series_row(const std::string& collection,
                                       const std::string& group,
                                       int64_t id,
                                       const std::map<std::string, Value>& row) {
-    impl_->logger->debug("Upserting time series row {}.{} for id {} ({} columns)", collection, group, id, row.size());
+    const auto tracked = impl_->track("upsert_time_series_row");
+    impl_->require_writable("upsert_time_series_row");
+    QLOG_DEBUG(impl_->logger,
+               "Upserting time series row {}.{} for id {} ({} columns)",
+               collection,
+               group,
+               id,
+               row.size());
     impl_->require_collection(collection, "upsert_time_series_row");
 
     auto ts_table = impl_->schema->find_time_series_table(collection, group);
@@ -222,6 +360,17 @@ void Database::upsert_time_series_row(const std::string& collection,
 
     Impl::TransactionGuard txn(*impl_);
 
+    if (impl_->schema->is_packed_time_series_group(collection, group)) {
+        const auto packed = impl_->packed_group(*table_def);
+        const auto incoming = impl_->packed_series_from_rows("upsert_time_series_row", packed, {row});
+        const auto series = internal::merge_packed_series(
+            impl_->load_packed_series(packed, id), incoming, TimeSeriesWriteMode::Upsert, "upsert_time_series_row");
+        impl_->store_packed_series("upsert_time_series_row", packed, id, series, *this);
+        txn.commit();
+        QLOG_DEBUG(impl_->logger, "Upserted time series row {}.{} for id {}", collection, group, id);
+        return;
+    }
+
     // INSERT OR REPLACE: if the PK already matches an existing row, REPLACE
     // deletes it and inserts the new one (upsert semantic). Any value column
     // omitted from the caller's row is not listed in the INSERT, so SQLite
@@ -239,15 +388,160 @@ void Database::upsert_time_series_row(const std::string& collection,
     insert_sql += ") VALUES (" + placeholders + ")";
 
     execute(insert_sql, parameters);
+    impl_->note_group_change(ts_table, id);
 
     txn.commit();
-    impl_->logger->debug("Upserted time series row {}.{} for id {}", collection, group, id);
+    QLOG_DEBUG(impl_->logger, "Upserted time series row {}.{} for id {}", collection, group, id);
+}
+
+void Database::write_time_series(const std::string& collection,
+                                 const std::string& group,
+                                 const std::vector<int64_t>& ids,
+                                 const std::vector<TimeSeriesColumn>& columns,
+                                 TimeSeriesWriteMode mode) {
+    const auto tracked = impl_->track("write_time_series");
+    impl_->require_writable("write_time_series");
+    QLOG_DEBUG(impl_->logger, "Writing {} time series rows to {}.{}", ids.size(), collection, group);
+    impl_->require_collection(collection, "write_time_series");
+
+    auto ts_table = impl_->schema->find_time_series_table(collection, group);
+    const auto* table_def = impl_->schema->get_table(ts_table);
+    if (!table_def) {
+        throw std::runtime_error("Time series table not found: " + ts_table);
+    }
+    const auto dim_cols = internal::find_dimension_columns(*table_def);
+    const auto row_count = ids.size();
+
+    // Validate shapes and types once per column, before any write.
+    std::map<std::string, const TimeSeriesColumn*> by_name;
+    for (const auto& column : columns) {
+        const auto* col_def = table_def->get_column(column.name);
+        if (!col_def || column.name == "id") {
+            throw std::runtime_error("Cannot write_time_series: column '" + column.name + "' not found in group '" +
+                                     group + "' for collection '" + collection + "'");
+        }
+        if (!by_name.emplace(column.name, &column).second) {
+            throw std::runtime_error("Cannot write_time_series: column '" + column.name + "' given more than once");
+        }
+        const auto size = std::visit([](const auto& values) { return values.size(); }, column.values);
+        if (size != row_count || (!column.valid.empty() && column.valid.size() != row_count)) {
+            throw std::runtime_error("Cannot write_time_series: column '" + column.name + "' has " +
+                                     std::to_string(column.valid.empty() ? size : column.valid.size()) +
+                                     " cells but ids has " + std::to_string(row_count));
+        }
+        // Cells of one column share a type, so a default-constructed sample stands in for all of them.
+        const Value sample = std::visit(
+            [](const auto& values) -> Value { return typename std::decay_t<decltype(values)>::value_type{}; },
+            column.values);
+        if (!internal::value_matches_type(sample, col_def->type)) {
+            throw std::runtime_error("Cannot write_time_series: column '" + column.name + "' has type " +
+                                     data_type_to_string(col_def->type) + " but received " +
+                                     internal::value_type_name(sample));
+        }
+    }
+    for (const auto& dim_col : dim_cols) {
+        auto it = by_name.find(dim_col);
+        if (it == by_name.end()) {
+            throw std::runtime_error("Cannot write_time_series: columns missing required '" + dim_col + "' column");
+        }
+        const auto& valid = it->second->valid;
+        if (std::find(valid.begin(), valid.end(), uint8_t{0}) != valid.end()) {
+            throw std::runtime_error("Cannot write_time_series: dimension column '" + dim_col + "' contains NULL");
+        }
+    }
+    if (row_count == 0) {
+        return;
+    }
+    for (auto id : std::set<int64_t>(ids.begin(), ids.end())) {
+        impl_->require_element(collection, id, *this);
+    }
+
+    if (impl_->schema->is_packed_time_series_group(collection, group)) {
+        // Each element's series is decoded, merged with its incoming rows and re-packed.
+        const auto packed = impl_->packed_group(*table_def);
+        std::map<int64_t, std::vector<std::map<std::string, Value>>> rows_by_id;
+        for (size_t r = 0; r < row_count; ++r) {
+            auto& row = rows_by_id[ids[r]].emplace_back();
+            for (const auto& column : columns) {
+                if (column.valid.empty() || column.valid[r] != 0) {
+                    row[column.name] =
+                        std::visit([r](const auto& values) -> Value { return values[r]; }, column.values);
+                }
+            }
+        }
+        Impl::TransactionGuard txn(*impl_);
+        for (const auto& [id, rows] : rows_by_id) {
+            const auto incoming = impl_->packed_series_from_rows("write_time_series", packed, rows);
+            const auto series = internal::merge_packed_series(
+                impl_->load_packed_series(packed, id), incoming, mode, "write_time_series");
+            impl_->store_packed_series("write_time_series", packed, id, series, *this);
+        }
+        txn.commit();
+        QLOG_INFO(impl_->logger, "Wrote {} time series rows to {}.{}", row_count, collection, group);
+        return;
+    }
+
+    // Row-major parameters, filled one column at a time so the type dispatch happens per column.
+    Impl::InsertBatch batch;
+    batch.replace = mode == TimeSeriesWriteMode::Upsert;
+    batch.columns.push_back("id");
+    for (const auto& column : columns) {
+        batch.columns.push_back(column.name);
+    }
+    const auto width = batch.columns.size();
+    batch.values.assign(row_count * width, nullptr);
+    for (size_t r = 0; r < row_count; ++r) {
+        batch.values[r * width] = ids[r];
+    }
+    for (size_t c = 0; c < columns.size(); ++c) {
+        const auto& valid = columns[c].valid;
+        std::visit(
+            [&](const auto& values) {
+                for (size_t r = 0; r < row_count; ++r) {
+                    if (valid.empty() || valid[r] != 0) {
+                        batch.values[r * width + c + 1] = values[r];
+                    }
+                }
+            },
+            columns[c].values);
+    }
+
+    Impl::TransactionGuard txn(*impl_);
+
+    if (mode == TimeSeriesWriteMode::ReplaceRange) {
+        // Each element's [min, max] over the leading dimension column.
+        const auto& range_col = dim_cols.front();
+        std::visit(
+            [&](const auto& values) {
+                using T = typename std::decay_t<decltype(values)>::value_type;
+                std::map<int64_t, std::pair<T, T>> ranges;
+                for (size_t r = 0; r < row_count; ++r) {
+                    auto [it, inserted] = ranges.try_emplace(ids[r], values[r], values[r]);
+                    if (!inserted) {
+                        it->second.first = std::min(it->second.first, values[r]);
+                        it->second.second = std::max(it->second.second, values[r]);
+                    }
+                }
+                const auto delete_sql =
+                    "DELETE FROM " + ts_table + " WHERE id = ? AND " + range_col + " BETWEEN ? AND ?";
+                for (const auto& [id, range] : ranges) {
+                    execute(delete_sql, {id, range.first, range.second});
+                }
+            },
+            by_name.at(range_col)->values);
+    }
+
+    impl_->insert_batch(ts_table, batch, *this);
+
+    txn.commit();
+    QLOG_INFO(impl_->logger, "Wrote {} time series rows to {}.{}", row_count, collection, group);
 }
 
 std::vector<Value> Database::read_time_series_row(const std::string& collection,
                                                   const std::string& group,
                                                   const std::string& attribute,
                                                   const std::string& date_time) {
+    const auto tracked = impl_->track("read_time_series_row");
     impl_->require_collection(collection, "read_time_series_row");
 
     auto ts_table = impl_->schema->find_time_series_table(collection, group);
@@ -255,7 +549,7 @@ std::vector<Value> Database::read_time_series_row(const std::string& collection,
     if (!table_def) {
         throw std::runtime_error("Time series table not found: " + ts_table);
     }
-    auto dim_col = internal::find_dimension_column(*table_def);
+    auto dim_col = as_of_dimension_column("read_time_series_row", *table_def, collection, group);
 
     const auto* attr_col = table_def->get_column(attribute);
     if (!attr_col || attribute == "id" || attribute == dim_col) {
@@ -268,6 +562,17 @@ std::vector<Value> Database::read_time_series_row(const std::string& collection,
         return {};
     }
 
+    if (impl_->schema->is_packed_time_series_group(collection, group)) {
+        auto rows = impl_->read_packed_as_of(
+            "read_time_series_row", impl_->packed_group(*table_def), attribute, element_ids, {date_time});
+        std::vector<Value> result;
+        result.reserve(rows.size());
+        for (auto& row : rows) {
+            result.push_back(std::move(row.front()));
+        }
+        return result;
+    }
+
     // For each element, find the most recent non-null value where dim_col <= date_time.
     // Self-join: subquery picks max dim_col per id, outer query gets the value.
     auto sql = "SELECT t.id, t." + attribute + " FROM " + ts_table + " t INNER JOIN (SELECT id, MAX(" + dim_col +
@@ -294,13 +599,115 @@ std::vector<Value> Database::read_time_series_row(const std::string& collection,
     return result;
 }
 
+std::vector<std::vector<Value>> Database::read_time_series_rows(const std::string& collection,
+                                                               const std::string& group,
+                                                               const std::string& attribute,
+                                                               const std::vector<std::string>& date_times) {
+    const auto tracked = impl_->track("read_time_series_rows");
+    impl_->require_collection(collection, "read_time_series_rows");
+
+    auto ts_table = impl_->schema->find_time_series_table(collection, group);
+    const auto* table_def = impl_->schema->get_table(ts_table);
+    if (!table_def) {
+        throw std::runtime_error("Time series table not found: " + ts_table);
+    }
+    auto dim_col = as_of_dimension_column("read_time_series_rows", *table_def, collection, group);
+
+    const auto* attr_col = table_def->get_column(attribute);
+    if (!attr_col || attribute == "id" || attribute == dim_col) {
+        throw std::runtime_error("Time series attribute not found: '" + attribute + "' in group '" + group +
+                                 "' of collection '" + collection + "'");
+    }
+
+    auto element_ids = read_element_ids(collection);
+    if (impl_->schema->is_packed_time_series_group(collection, group)) {
+        return impl_->read_packed_as_of(
+            "read_time_series_rows", impl_->packed_group(*table_def), attribute, element_ids, date_times);
+    }
+    // The merge below is only a scan when (id, dimension) is indexed; without it every call would
+    // sort the whole table. IndexAdvisor reports the same index, and ensure_indexes() creates it.
+    const auto indexed = std::any_of(table_def->indexes.begin(), table_def->indexes.end(), [&](const Index& index) {
+        return index.columns.size() >= 2 && index.columns[0] == "id" && index.columns[1] == dim_col;
+    });
+    if (!indexed) {
+        throw std::runtime_error("Cannot read_time_series_rows: table '" + ts_table +
+                                 "' has no primary key or index on (id, " + dim_col +
+                                 "); create it with ensure_indexes()");
+    }
+
+    std::vector<std::vector<Value>> result(element_ids.size(), std::vector<Value>(date_times.size(), nullptr));
+    if (element_ids.empty() || date_times.empty()) {
+        return result;
+    }
+
+    std::unordered_map<int64_t, size_t> element_index;
+    element_index.reserve(element_ids.size());
+    for (size_t e = 0; e < element_ids.size(); ++e) {
+        element_index.emplace(element_ids[e], e);
+    }
+
+    // Timestamps in ascending order, remembering where each one goes in the output.
+    std::vector<size_t> order(date_times.size());
+    for (size_t t = 0; t < order.size(); ++t) {
+        order[t] = t;
+    }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return date_times[a] < date_times[b]; });
+    const auto& last_date_time = date_times[order.back()];
+
+    // Merge each element's rows (ascending dimension) with the sorted timestamps: every timestamp
+    // takes the last non-null value at or before it. The (id, dimension...) primary key index
+    // delivers rows in this order, so the scan never sorts.
+    auto sql = "SELECT id, " + dim_col + ", " + attribute + " FROM " + ts_table + " WHERE " + dim_col + " <= ? AND " +
+               attribute + " IS NOT NULL ORDER BY id, " + dim_col;
+    auto rows = cursor(sql, {last_date_time});
+
+    std::vector<Value>* out = nullptr;
+    std::optional<int64_t> current_id;
+    size_t next = 0;
+    Value carried = nullptr;
+    auto finish_element = [&] {
+        if (out && !std::holds_alternative<std::nullptr_t>(carried)) {
+            for (; next < order.size(); ++next) {
+                (*out)[order[next]] = carried;
+            }
+        }
+    };
+
+    while (rows.next()) {
+        auto id = rows.get_integer(0);
+        if (!id)
+            continue;
+        if (id != current_id) {
+            finish_element();
+            auto it = element_index.find(*id);
+            out = it != element_index.end() ? &result[it->second] : nullptr;
+            current_id = *id;
+            next = 0;
+            carried = nullptr;
+        }
+        if (!out)
+            continue;
+
+        auto dim = rows.get_string(1).value_or(std::string{});
+        for (; next < order.size() && date_times[order[next]] < dim; ++next) {
+            (*out)[order[next]] = carried;
+        }
+        carried = rows.get_value(2);
+    }
+    finish_element();
+
+    return result;
+}
+
 bool Database::has_time_series_files(const std::string& collection) const {
+    const auto tracked = impl_->track("has_time_series_files");
     impl_->require_collection(collection, "has_time_series_files");
     auto tsf = Schema::time_series_files_table_name(collection);
     return impl_->schema->has_table(tsf);
 }
 
 std::vector<std::string> Database::list_time_series_files_columns(const std::string& collection) const {
+    const auto tracked = impl_->track("list_time_series_files_columns");
     impl_->require_collection(collection, "list_time_series_files_columns");
     auto tsf = Schema::time_series_files_table_name(collection);
     const auto* table_def = impl_->schema->get_table(tsf);
@@ -314,7 +721,8 @@ std::vector<std::string> Database::list_time_series_files_columns(const std::str
 }
 
 std::map<std::string, std::optional<std::string>> Database::read_time_series_files(const std::string& collection) {
-    impl_->logger->debug("Reading time series files for collection: {}", collection);
+    const auto tracked = impl_->track("read_time_series_files");
+    QLOG_DEBUG(impl_->logger, "Reading time series files for collection: {}", collection);
     impl_->require_collection(collection, "read_time_series_files");
 
     auto tsf = impl_->schema->find_time_series_files_table(collection);
@@ -361,7 +769,9 @@ std::map<std::string, std::optional<std::string>> Database::read_time_series_fil
 
 void Database::update_time_series_files(const std::string& collection,
                                         const std::map<std::string, std::optional<std::string>>& paths) {
-    impl_->logger->debug("Updating time series files for collection: {}", collection);
+    const auto tracked = impl_->track("update_time_series_files");
+    impl_->require_writable("update_time_series_files");
+    QLOG_DEBUG(impl_->logger, "Updating time series files for collection: {}", collection);
     impl_->require_collection(collection, "update_time_series_files");
 
     auto tsf = impl_->schema->find_time_series_files_table(collection);
@@ -413,7 +823,7 @@ void Database::update_time_series_files(const std::string& collection,
     execute(insert_sql, parameters);
 
     txn.commit();
-    impl_->logger->info("Updated time series files for collection: {}", collection);
+    QLOG_INFO(impl_->logger, "Updated time series files for collection: {}", collection);
 }
 
 }  // namespace quiver
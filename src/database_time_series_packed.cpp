@@ -0,0 +1,314 @@
+#include "database_impl.h"
+#include "database_internal.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace quiver {
+
+namespace {
+
+// Decodes the chunk (id, start, step, count, data) stmt is on into series. Chunks are BLOBs, which
+// Cursor does not read, so the row is charged to the operation and the trace here as Cursor::next
+// would.
+void decode_chunk(sqlite3_stmt* stmt, OperationMetrics& metrics, SqlTracer* tracer, internal::PackedSeries& series) {
+    metrics.add_rows_read(1);
+    if (tracer) {
+        tracer->count_row(stmt);
+    }
+    const auto* data = sqlite3_column_blob(stmt, 4);
+    const auto size = static_cast<size_t>(sqlite3_column_bytes(stmt, 4));
+    internal::unpack_chunk(sqlite3_column_int64(stmt, 1),
+                           sqlite3_column_int64(stmt, 2),
+                           sqlite3_column_int64(stmt, 3),
+                           data,
+                           size,
+                           series);
+}
+
+// Step one statement over stored chunks, decoding each into the series of its element and handing
+// a finished element to `visit`.
+void decode_chunks(sqlite3* db,
+                   sqlite3_stmt* stmt,
+                   OperationMetrics& metrics,
+                   SqlTracer* tracer,
+                   const internal::PackedSeries& layout,
+                   const std::function<void(int64_t, internal::PackedSeries&&)>& visit) {
+    std::optional<int64_t> current_id;
+    auto series = layout;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        const auto id = sqlite3_column_int64(stmt, 0);
+        if (current_id && *current_id != id) {
+            visit(*current_id, std::move(series));
+            series = layout;
+        }
+        current_id = id;
+        decode_chunk(stmt, metrics, tracer, series);
+    }
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(db)));
+    }
+    if (current_id) {
+        visit(*current_id, std::move(series));
+    }
+}
+
+}  // namespace
+
+Database::Impl::PackedGroup Database::Impl::packed_group(const TableDefinition& ts_def) const {
+    PackedGroup packed;
+    packed.table = ts_def.name + "_packed";
+    packed.time_series_table = ts_def.name;
+    packed.dim_col = internal::find_dimension_column(ts_def);
+    packed.value_columns = internal::packed_value_columns(ts_def, packed.dim_col);
+    return packed;
+}
+
+internal::PackedSeries Database::Impl::load_packed_series(const PackedGroup& group, int64_t id) {
+    const auto layout = internal::make_packed_series(group.value_columns);
+    auto result = layout;
+    CachedStatement stmt(
+        statements, db, "SELECT id, start, step, count, data FROM " + group.table + " WHERE id = ? ORDER BY chunk");
+    sqlite3_bind_int64(stmt.get(), 1, id);
+    metrics.add_bytes_bound(sizeof(id));
+    decode_chunks(db, stmt.get(), metrics, tracer.get(), layout, [&result](int64_t, internal::PackedSeries&& series) {
+        result = std::move(series);
+    });
+    return result;
+}
+
+void Database::Impl::scan_packed_series(const PackedGroup& group,
+                                        const std::function<void(int64_t, internal::PackedSeries&&)>& visit) {
+    CachedStatement stmt(
+        statements, db, "SELECT id, start, step, count, data FROM " + group.table + " ORDER BY id, chunk");
+    decode_chunks(db, stmt.get(), metrics, tracer.get(), internal::make_packed_series(group.value_columns), visit);
+}
+
+int64_t Database::Impl::count_packed_rows(const PackedGroup& group, const std::string& id_query) {
+    CachedStatement stmt(
+        statements, db, "SELECT count, data FROM " + group.table + " WHERE id IN (" + id_query + ")");
+    int64_t rows = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+        metrics.add_rows_read(1);
+        if (tracer) {
+            tracer->count_row(stmt.get());
+        }
+        rows += internal::packed_chunk_rows(sqlite3_column_int64(stmt.get(), 0),
+                                            sqlite3_column_blob(stmt.get(), 1),
+                                            static_cast<size_t>(sqlite3_column_bytes(stmt.get(), 1)));
+    }
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(db)));
+    }
+    return rows;
+}
+
+void Database::Impl::store_packed_series(const char* caller,
+                                         const PackedGroup& group,
+                                         int64_t id,
+                                         const internal::PackedSeries& series,
+                                         Database& db) {
+    // Encode first: an irregular series throws before the element's stored chunks are touched.
+    const auto chunks = internal::pack_series(series, caller);
+
+    db.execute("DELETE FROM " + group.table + " WHERE id = ?", {id});
+
+    CachedStatement stmt(statements,
+                         this->db,
+                         "INSERT INTO " + group.table +
+                             " (id, chunk, start, step, count, data) VALUES (?, ?, ?, ?, ?, ?)");
+    for (size_t k = 0; k < chunks.size(); ++k) {
+        const auto& chunk = chunks[k];
+        sqlite3_reset(stmt.get());
+        sqlite3_bind_int64(stmt.get(), 1, id);
+        sqlite3_bind_int64(stmt.get(), 2, static_cast<sqlite3_int64>(k));
+        sqlite3_bind_int64(stmt.get(), 3, chunk.start);
+        sqlite3_bind_int64(stmt.get(), 4, chunk.step);
+        sqlite3_bind_int64(stmt.get(), 5, chunk.count);
+        sqlite3_bind_blob(stmt.get(), 6, chunk.data.data(), static_cast<int>(chunk.data.size()), SQLITE_STATIC);
+        // Charged as bind_parameters would: 8 bytes per number, plus the chunk's bytes
+        metrics.add_bytes_bound(static_cast<int64_t>(5 * sizeof(int64_t) + chunk.data.size()));
+        if (sqlite3_step(stmt.get()) != SQLITE_DONE) {
+            throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(this->db)));
+        }
+    }
+    note_group_change(group.time_series_table, id);
+    QLOG_DEBUG(logger, "Stored {} rows of {} as {} chunks", series.times.size(), group.table, chunks.size());
+}
+
+internal::PackedSeries
+Database::Impl::packed_series_from_rows(const char* caller,
+                                        const PackedGroup& group,
+                                        const std::vector<std::map<std::string, Value>>& rows) const {
+    std::vector<int64_t> times(rows.size());
+    for (size_t r = 0; r < rows.size(); ++r) {
+        auto dim = rows[r].find(group.dim_col);
+        if (dim == rows[r].end() || !std::holds_alternative<std::string>(dim->second)) {
+            throw std::runtime_error(std::string("Cannot ") + caller + ": row missing required '" + group.dim_col +
+                                     "' column");
+        }
+        times[r] = internal::parse_packed_time(std::get<std::string>(dim->second), caller);
+    }
+    std::vector<size_t> order(rows.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&times](size_t a, size_t b) { return times[a] < times[b]; });
+
+    auto series = internal::make_packed_series(group.value_columns);
+    for (size_t i = 0; i < order.size(); ++i) {
+        const auto r = order[i];
+        if (i > 0 && times[r] == times[order[i - 1]]) {
+            throw std::runtime_error(std::string("Cannot ") + caller + ": duplicate " + group.dim_col + " '" +
+                                     internal::format_packed_time(times[r]) + "'");
+        }
+        series.times.push_back(times[r]);
+        for (size_t c = 0; c < series.columns.size(); ++c) {
+            auto& column = series.columns[c];
+            const auto type = group.value_columns[c]->type;
+            auto it = rows[r].find(column.name);
+            const auto present = it != rows[r].end() && !std::holds_alternative<std::nullptr_t>(it->second);
+            // create_element arrays pass TypeValidator, which admits TEXT for INTEGER columns (FK labels)
+            if (present && !internal::value_matches_type(it->second, type)) {
+                throw std::runtime_error(std::string("Cannot ") + caller + ": type mismatch for column '" +
+                                         column.name + "': expected " + data_type_to_string(type) +
+                                         ", got " + internal::value_type_name(it->second));
+            }
+            std::visit(
+                [&](auto& values) {
+                    using T = typename std::decay_t<decltype(values)>::value_type;
+                    T value{};
+                    if (present) {
+                        if constexpr (std::is_same_v<T, double>) {
+                            // REAL columns accept integers, as SQLite STRICT does
+                            value = std::holds_alternative<int64_t>(it->second)
+                                        ? static_cast<double>(std::get<int64_t>(it->second))
+                                        : std::get<double>(it->second);
+                        } else if constexpr (std::is_same_v<T, int64_t>) {
+                            value = std::get<int64_t>(it->second);
+                        }
+                    }
+                    values.push_back(std::move(value));
+                },
+                column.values);
+            column.valid.push_back(present ? 1 : 0);
+        }
+    }
+    return series;
+}
+
+std::vector<std::map<std::string, Value>>
+Database::Impl::packed_series_to_rows(const PackedGroup& group, const internal::PackedSeries& series) const {
+    std::vector<std::map<std::string, Value>> rows(series.times.size());
+    for (size_t r = 0; r < rows.size(); ++r) {
+        rows[r][group.dim_col] = internal::format_packed_time(series.times[r]);
+    }
+    for (const auto& column : series.columns) {
+        std::visit(
+            [&](const auto& values) {
+                for (size_t r = 0; r < rows.size(); ++r) {
+                    rows[r][column.name] = column.valid[r] ? Value{values[r]} : Value{nullptr};
+                }
+            },
+            column.values);
+    }
+    return rows;
+}
+
+std::vector<std::vector<Value>> Database::Impl::read_packed_as_of(const char* caller,
+                                                                  const PackedGroup& group,
+                                                                  const std::string& attribute,
+                                                                  const std::vector<int64_t>& element_ids,
+                                                                  const std::vector<std::string>& date_times) {
+    std::vector<std::vector<Value>> result(element_ids.size(), std::vector<Value>(date_times.size(), nullptr));
+    if (element_ids.empty() || date_times.empty()) {
+        return result;
+    }
+
+    std::vector<int64_t> at(date_times.size());
+    for (size_t t = 0; t < at.size(); ++t) {
+        at[t] = internal::parse_packed_time(date_times[t], caller);
+    }
+    std::vector<size_t> order(at.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&at](size_t a, size_t b) { return at[a] < at[b]; });
+
+    size_t attr_index = 0;
+    while (group.value_columns[attr_index]->name != attribute) {
+        ++attr_index;
+    }
+    // Each element's chunks newest first, skipping those that start after the latest timestamp.
+    // The timestamps still unanswered are always a prefix of `order` (a value at or before a later
+    // one would answer it too), so an element is done once that prefix is empty and its older
+    // chunks are never read.
+    const auto layout = internal::make_packed_series(group.value_columns);
+    CachedStatement stmt(statements,
+                         db,
+                         "SELECT id, start, step, count, data FROM " + group.table +
+                             " WHERE id = ? AND start <= ? ORDER BY chunk DESC");
+    for (size_t e = 0; e < element_ids.size(); ++e) {
+        sqlite3_reset(stmt.get());
+        sqlite3_bind_int64(stmt.get(), 1, element_ids[e]);
+        sqlite3_bind_int64(stmt.get(), 2, at[order.back()]);
+        metrics.add_bytes_bound(2 * sizeof(int64_t));
+
+        auto& out = result[e];
+        auto pending = order.size();
+        int rc = SQLITE_DONE;
+        while (pending > 0 && (rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+            auto chunk = layout;
+            decode_chunk(stmt.get(), metrics, tracer.get(), chunk);
+            const auto& column = chunk.columns[attr_index];
+            std::visit(
+                [&](const auto& values) {
+                    size_t row = 0;
+                    std::optional<size_t> last_valid;
+                    auto answered = pending;
+                    for (size_t i = 0; i < pending; ++i) {
+                        const auto t = order[i];
+                        for (; row < chunk.times.size() && chunk.times[row] <= at[t]; ++row) {
+                            if (column.valid[row]) {
+                                last_valid = row;
+                            }
+                        }
+                        if (last_valid) {
+                            out[t] = values[*last_valid];
+                            answered = std::min(answered, i);
+                        }
+                    }
+                    pending = answered;
+                },
+                column.values);
+        }
+        if (rc != SQLITE_ROW && rc != SQLITE_DONE) {
+            throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(db)));
+        }
+    }
+    return result;
+}
+
+internal::PackedSeries
+Database::Impl::packed_series_from_columns(const char* caller,
+                                           const PackedGroup& group,
+                                           const TableDefinition& ts_def,
+                                           const std::map<std::string, const std::vector<Value>*>& columns) {
+    const auto num_rows = validate_group_columns(caller, ts_def.name, GroupTableType::TimeSeries, columns);
+    std::vector<std::map<std::string, Value>> rows(num_rows);
+    for (const auto& [col_name, values_ptr] : columns) {
+        for (size_t r = 0; r < num_rows; ++r) {
+            rows[r][col_name] = (*values_ptr)[r];
+        }
+    }
+    return packed_series_from_rows(caller, group, rows);
+}
+
+void Database::Impl::insert_rows_into_packed_table(const char* caller,
+                                                   const TableDefinition& ts_def,
+                                                   const std::map<std::string, const std::vector<Value>*>& columns,
+                                                   int64_t element_id,
+                                                   Database& db) {
+    const auto group = packed_group(ts_def);
+    store_packed_series(caller, group, element_id, packed_series_from_columns(caller, group, ts_def, columns), db);
+}
+
+}  // namespace quiver
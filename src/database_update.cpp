@@ -5,7 +5,9 @@
 namespace quiver {
 
 void Database::update_element(const std::string& collection, int64_t id, const Element& element) {
-    impl_->logger->debug("Updating element {} in collection: {}", id, collection);
+    const auto tracked = impl_->track("update_element");
+    impl_->require_writable("update_element");
+    QLOG_DEBUG(impl_->logger, "Updating element {} in collection: {}", id, collection);
     impl_->require_collection(collection, "update_element");
 
     const auto& scalars = element.scalars();
@@ -52,7 +54,7 @@ void Database::update_element(const std::string& collection, int64_t id, const E
     impl_->insert_group_data("update_element", collection, id, resolved.arrays, true, *this);
 
     txn.commit();
-    impl_->logger->info("Updated element {} in {}", id, collection);
+    QLOG_INFO(impl_->logger, "Updated element {} in {}", id, collection);
 }
 
 namespace {
@@ -145,18 +147,22 @@ void Database::update_vector_group(const std::string& collection,
                                    const std::string& group,
                                    int64_t id,
                                    const std::vector<std::map<std::string, Value>>& rows) {
-    impl_->logger->debug("Updating vector {}.{} for id {} with {} rows", collection, group, id, rows.size());
+    const auto tracked = impl_->track("update_vector_group");
+    impl_->require_writable("update_vector_group");
+    QLOG_DEBUG(impl_->logger, "Updating vector {}.{} for id {} with {} rows", collection, group, id, rows.size());
     impl_->update_group_rows("update_vector_group", collection, group, GroupTableType::Vector, id, rows, *this);
-    impl_->logger->info("Updated vector {}.{} for id {} with {} rows", collection, group, id, rows.size());
+    QLOG_INFO(impl_->logger, "Updated vector {}.{} for id {} with {} rows", collection, group, id, rows.size());
 }
 
 void Database::update_set_group(const std::string& collection,
                                 const std::string& group,
                                 int64_t id,
                                 const std::vector<std::map<std::string, Value>>& rows) {
-    impl_->logger->debug("Updating set {}.{} for id {} with {} rows", collection, group, id, rows.size());
+    const auto tracked = impl_->track("update_set_group");
+    impl_->require_writable("update_set_group");
+    QLOG_DEBUG(impl_->logger, "Updating set {}.{} for id {} with {} rows", collection, group, id, rows.size());
     impl_->update_group_rows("update_set_group", collection, group, GroupTableType::Set, id, rows, *this);
-    impl_->logger->info("Updated set {}.{} for id {} with {} rows", collection, group, id, rows.size());
+    QLOG_INFO(impl_->logger, "Updated set {}.{} for id {} with {} rows", collection, group, id, rows.size());
 }
 
 }  // namespace quiver
@@ -0,0 +1,137 @@
+#include "quiver/index_advisor.h"
+
+#include <algorithm>
+
+namespace quiver {
+
+namespace {
+
+bool starts_with(const std::vector<std::string>& columns, const std::vector<std::string>& prefix) {
+    return columns.size() >= prefix.size() && std::equal(prefix.begin(), prefix.end(), columns.begin());
+}
+
+// An INTEGER PRIMARY KEY column is the rowid: lookups by it need no index.
+bool is_rowid_alias(const TableDefinition& table, const std::string& column) {
+    const auto* col = table.get_column(column);
+    if (!col || !col->primary_key || col->type != DataType::Integer) {
+        return false;
+    }
+    return std::count_if(table.columns.begin(), table.columns.end(), [](const auto& entry) {
+               return entry.second.primary_key;
+           }) == 1;
+}
+
+bool is_served(const TableDefinition& table, const std::vector<std::string>& columns) {
+    if (columns.size() == 1 && is_rowid_alias(table, columns[0])) {
+        return true;
+    }
+    return std::any_of(table.indexes.begin(), table.indexes.end(), [&columns](const Index& index) {
+        return starts_with(index.columns, columns);
+    });
+}
+
+// The column a time series group is ordered by: its leading non-id key column, else its first
+// date-time column. Empty when it has neither.
+std::string leading_dimension(const TableDefinition& table) {
+    for (const auto& name : table.column_order) {
+        const auto* col = table.get_column(name);
+        if (name != "id" && col && col->primary_key) {
+            return name;
+        }
+    }
+    for (const auto& name : table.column_order) {
+        const auto* col = table.get_column(name);
+        if (name != "id" && col && (col->type == DataType::DateTime || is_date_time_column(name))) {
+            return name;
+        }
+    }
+    return "";
+}
+
+}  // namespace
+
+std::string MissingIndex::index_name() const {
+    auto name = "idx_" + table;
+    for (const auto& column : columns) {
+        name += "_" + column;
+    }
+    return name;
+}
+
+std::string MissingIndex::create_sql() const {
+    auto sql = "CREATE INDEX IF NOT EXISTS " + index_name() + " ON " + table + " (";
+    for (size_t i = 0; i < columns.size(); ++i) {
+        sql += (i > 0 ? ", " : "") + columns[i];
+    }
+    return sql + ")";
+}
+
+IndexAdvisor::IndexAdvisor(const Schema& schema) : schema_(schema) {}
+
+std::vector<MissingIndex> IndexAdvisor::missing_indexes() const {
+    std::vector<MissingIndex> missing;
+    for (const auto& name : schema_.table_names()) {
+        if (const auto* table = schema_.get_table(name)) {
+            check_table(*table, missing);
+        }
+    }
+    return missing;
+}
+
+void IndexAdvisor::check_table(const TableDefinition& table, std::vector<MissingIndex>& missing) const {
+    std::vector<MissingIndex> required;
+    const auto& name = table.name;
+    const auto is_group = schema_.is_vector_table(name) || schema_.is_set_table(name) ||
+                          schema_.is_time_series_table(name);
+
+    if (schema_.is_collection(name)) {
+        if (table.has_column("label")) {
+            required.push_back({name, {"label"}, "label lookups resolve elements by label"});
+        }
+    } else if (schema_.is_vector_table(name)) {
+        required.push_back({name, {"id", "vector_index"}, "vector reads order by (id, vector_index)"});
+    } else if (schema_.is_set_table(name)) {
+        required.push_back({name, {"id"}, "set reads filter by id"});
+    } else if (schema_.is_time_series_table(name)) {
+        const auto collection = schema_.get_parent_collection(name);
+        const auto group = name.substr(collection.size() + std::string("_time_series_").size());
+        if (schema_.is_packed_time_series_group(collection, group)) {
+            return;
+        }
+        const auto dimension = leading_dimension(table);
+        if (dimension.empty()) {
+            required.push_back({name, {"id"}, "time series reads filter by id"});
+        } else {
+            required.push_back(
+                {name, {"id", dimension}, "time series reads filter by id and order by " + dimension});
+        }
+    }
+
+    // Foreign-key columns in declaration order (PRAGMA foreign_key_list reports them in reverse).
+    for (const auto& column : table.column_order) {
+        if (is_group && column == "id") {
+            continue;  // covered by the group's own key above
+        }
+        const auto fk = std::find_if(table.foreign_keys.begin(),
+                                     table.foreign_keys.end(),
+                                     [&column](const ForeignKey& f) { return f.from_column == column; });
+        if (fk != table.foreign_keys.end()) {
+            required.push_back({name, {column}, "deleting or updating a " + fk->to_table + " scans for references"});
+        }
+    }
+
+    for (auto& index : required) {
+        if (is_served(table, index.columns)) {
+            continue;
+        }
+        // A missing index already reported on this table may serve this one too.
+        const auto served_by_reported = std::any_of(missing.begin(), missing.end(), [&index](const MissingIndex& m) {
+            return m.table == index.table && starts_with(m.columns, index.columns);
+        });
+        if (!served_by_reported) {
+            missing.push_back(std::move(index));
+        }
+    }
+}
+
+}  // namespace quiver
@@ -404,11 +404,43 @@ struct LuaRunner::Impl {
         bind.set_function("summarize_collection", [](Database& self, const std::string& collection) {
             return self.summarize_collection(collection);
         });
+        bind.set_function("missing_indexes", [](Database& self, sol::this_state s) {
+            return missing_indexes_lua(self.missing_indexes(), s);
+        });
+        bind.set_function("ensure_indexes", [](Database& self, sol::this_state s) {
+            return missing_indexes_lua(self.ensure_indexes(), s);
+        });
+
+        bind.set_function(
+            "delete_elements",
+            [](Database& self, const std::string& collection, sol::table ids, sol::this_state s) {
+                std::vector<int64_t> values;
+                values.reserve(ids.size());
+                for (size_t i = 1; i <= ids.size(); ++i) {
+                    values.push_back(ids.get<int64_t>(i));
+                }
+                return delete_result_lua(self.delete_elements(collection, values), s);
+            });
+        bind.set_function("delete_elements_where",
+                          [](Database& self,
+                             const std::string& collection,
+                             const std::string& predicate,
+                             sol::optional<sol::table> parameters,
+                             sol::this_state s) {
+                              auto values = parameters ? lua_table_to_values(*parameters) : std::vector<Value>{};
+                              return delete_result_lua(self.delete_elements_where(collection, predicate, values), s);
+                          });
 
         bind.set_function("query_string", &query_string_lua);
         bind.set_function("query_integer", &query_integer_lua);
         bind.set_function("query_float", &query_float_lua);
 
+        bind.set_function("enable_stats", [](Database& self, sol::optional<bool> enabled) {
+            self.enable_stats(enabled.value_or(true));
+        });
+        bind.set_function("stats", &stats_lua);
+        bind.set_function("reset_stats", [](Database& self) { self.reset_stats(); });
+
         // Binary subsystem file I/O — db-scoped and sandboxed: paths resolve against the directory
         // containing the database file and must stay inside it.
         bind.set_function(
@@ -1372,6 +1404,66 @@ struct LuaRunner::Impl {
         return t;
     }
 
+    // ========================================================================
+    // Index advisor
+    // ========================================================================
+
+    // { { table = ..., columns = { ... }, reason = ..., sql = ... }, ... }
+    static sol::table missing_indexes_lua(const std::vector<MissingIndex>& indexes, sol::this_state s) {
+        sol::state_view lua(s);
+        auto t = lua.create_table();
+        for (size_t i = 0; i < indexes.size(); ++i) {
+            const auto& index = indexes[i];
+            auto entry = lua.create_table();
+            entry["table"] = index.table;
+            auto columns = lua.create_table();
+            for (size_t j = 0; j < index.columns.size(); ++j) {
+                columns[j + 1] = index.columns[j];
+            }
+            entry["columns"] = columns;
+            entry["reason"] = index.reason;
+            entry["sql"] = index.create_sql();
+            t[i + 1] = entry;
+        }
+        return t;
+    }
+
+    static sol::table delete_result_lua(const DeleteResult& result, sol::this_state s) {
+        sol::state_view lua(s);
+        auto t = lua.create_table();
+        t["elements"] = result.elements;
+        auto group_rows = lua.create_table();
+        for (const auto& [table, rows] : result.group_rows) {
+            group_rows[table] = rows;
+        }
+        t["group_rows"] = group_rows;
+        return t;
+    }
+
+    // ========================================================================
+    // Operation stats
+    // ========================================================================
+
+    // { [operation] = { calls = ..., total_ns = ..., ... }, ... }
+    static sol::table stats_lua(Database& db, sol::this_state s) {
+        sol::state_view lua(s);
+        auto t = lua.create_table();
+        for (const auto& op : db.stats()) {
+            auto entry = lua.create_table();
+            entry["calls"] = op.calls;
+            entry["total_ns"] = op.total_ns;
+            entry["p50_ns"] = op.p50_ns;
+            entry["p99_ns"] = op.p99_ns;
+            entry["rows_read"] = op.rows_read;
+            entry["rows_written"] = op.rows_written;
+            entry["statements_prepared"] = op.statements_prepared;
+            entry["statements_reused"] = op.statements_reused;
+            entry["bytes_bound"] = op.bytes_bound;
+            t[op.operation] = entry;
+        }
+        return t;
+    }
+
     // ========================================================================
     // Time series data
     // ========================================================================
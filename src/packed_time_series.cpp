@@ -0,0 +1,279 @@
+#include "packed_time_series.h"
+
+#include "utils/datetime.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+namespace quiver::internal {
+
+namespace {
+
+constexpr size_t kCellBytes = 8;
+
+size_t bitmap_bytes(int64_t count) {
+    return static_cast<size_t>((count + 7) / 8);
+}
+
+bool test_bit(const uint8_t* bitmap, int64_t index) {
+    return (bitmap[index / 8] >> (index % 8)) & 1;
+}
+
+void set_bit(uint8_t* bitmap, int64_t index) {
+    bitmap[index / 8] |= static_cast<uint8_t>(1u << (index % 8));
+}
+
+// Cells are little-endian whatever the host, so a file packed on one machine reads on any other.
+template <typename T>
+void store_cell(uint8_t* cell, const T& value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, kCellBytes);
+    for (size_t i = 0; i < kCellBytes; ++i) {
+        cell[i] = static_cast<uint8_t>(bits >> (8 * i));
+    }
+}
+
+template <typename T>
+T load_cell(const uint8_t* cell) {
+    uint64_t bits = 0;
+    for (size_t i = 0; i < kCellBytes; ++i) {
+        bits |= static_cast<uint64_t>(cell[i]) << (8 * i);
+    }
+    T value;
+    std::memcpy(&value, &bits, kCellBytes);
+    return value;
+}
+
+}  // namespace
+
+std::vector<const ColumnDefinition*> packed_value_columns(const TableDefinition& table_def,
+                                                          const std::string& dim_col) {
+    std::vector<const ColumnDefinition*> columns;
+    for (const auto& col_name : table_def.column_order) {
+        if (col_name != "id" && col_name != dim_col) {
+            columns.push_back(table_def.get_column(col_name));
+        }
+    }
+    return columns;
+}
+
+PackedSeries make_packed_series(const std::vector<const ColumnDefinition*>& value_columns) {
+    PackedSeries series;
+    series.columns.reserve(value_columns.size());
+    for (const auto* col : value_columns) {
+        auto& column = series.columns.emplace_back();
+        column.name = col->name;
+        if (col->type == DataType::Integer) {
+            column.values = std::vector<int64_t>{};
+        } else {
+            column.values = std::vector<double>{};
+        }
+    }
+    return series;
+}
+
+int64_t parse_packed_time(const std::string& value, const char* caller) {
+    // Exactly "YYYY-MM-DDTHH:MM:SS": std::get_time implementations differ on whether a bare date
+    // parses, and packed times must not depend on the platform.
+    std::tm tm{};
+    if (value.size() != 19 || !datetime::parse_iso8601(value, tm)) {
+        throw std::runtime_error(std::string("Cannot ") + caller + ": date_time '" + value +
+                                 "' is not an ISO 8601 date and time (YYYY-MM-DDTHH:MM:SS)");
+    }
+    auto time_point = datetime::tm_to_time_point(tm);
+    return std::chrono::duration_cast<std::chrono::seconds>(time_point.time_since_epoch()).count();
+}
+
+std::string format_packed_time(int64_t seconds) {
+    return datetime::format_utc(std::chrono::system_clock::time_point{std::chrono::seconds{seconds}});
+}
+
+void append_packed_row(PackedSeries& to, const PackedSeries& from, size_t index) {
+    to.times.push_back(from.times[index]);
+    for (size_t c = 0; c < to.columns.size(); ++c) {
+        std::visit(
+            [&](auto& values) {
+                using Values = std::decay_t<decltype(values)>;
+                values.push_back(std::get<Values>(from.columns[c].values)[index]);
+            },
+            to.columns[c].values);
+        to.columns[c].valid.push_back(from.columns[c].valid[index]);
+    }
+}
+
+PackedSeries merge_packed_series(const PackedSeries& base,
+                                 const PackedSeries& incoming,
+                                 TimeSeriesWriteMode mode,
+                                 const char* caller) {
+    if (incoming.times.empty()) {
+        return base;
+    }
+    const auto first = incoming.times.front();
+    const auto last = incoming.times.back();
+
+    auto merged = base;
+    merged.times.clear();
+    for (auto& column : merged.columns) {
+        std::visit([](auto& values) { values.clear(); }, column.values);
+        column.valid.clear();
+    }
+
+    size_t b = 0;
+    size_t i = 0;
+    while (b < base.times.size() || i < incoming.times.size()) {
+        if (i == incoming.times.size() || (b < base.times.size() && base.times[b] < incoming.times[i])) {
+            if (mode != TimeSeriesWriteMode::ReplaceRange || base.times[b] < first || base.times[b] > last) {
+                append_packed_row(merged, base, b);
+            }
+            ++b;
+            continue;
+        }
+        if (b < base.times.size() && base.times[b] == incoming.times[i]) {
+            if (mode == TimeSeriesWriteMode::Append) {
+                throw std::runtime_error(std::string("Cannot ") + caller + ": date_time '" +
+                                         format_packed_time(base.times[b]) + "' already exists");
+            }
+            ++b;
+        }
+        append_packed_row(merged, incoming, i);
+        ++i;
+    }
+    return merged;
+}
+
+std::vector<PackedChunk> pack_series(const PackedSeries& series, const char* caller) {
+    std::vector<PackedChunk> chunks;
+    const auto& times = series.times;
+    if (times.empty()) {
+        return chunks;
+    }
+
+    int64_t step = 0;
+    for (size_t i = 1; i < times.size(); ++i) {
+        step = std::gcd(step, times[i] - times[i - 1]);
+    }
+    const auto first = times.front();
+    const int64_t slots = step == 0 ? 1 : (times.back() - first) / step + 1;
+    const auto rows = static_cast<int64_t>(times.size());
+    if (slots > 2 * rows + kPackedChunkSlots) {
+        throw std::runtime_error(std::string("Cannot ") + caller + ": date_time values are too irregular to pack (" +
+                                 std::to_string(rows) + " rows would span " + std::to_string(slots) +
+                                 " slots of " + std::to_string(step) + " seconds)");
+    }
+    auto slot_of = [&](size_t row) { return step == 0 ? 0 : (times[row] - first) / step; };
+
+    size_t row = 0;
+    for (int64_t chunk_first = 0; chunk_first < slots && row < times.size(); chunk_first += kPackedChunkSlots) {
+        const auto count = std::min(kPackedChunkSlots, slots - chunk_first);
+        auto end = row;
+        while (end < times.size() && slot_of(end) < chunk_first + count) {
+            ++end;
+        }
+        if (end == row) {
+            continue;  // a gap spanning the whole chunk
+        }
+
+        PackedChunk chunk;
+        chunk.start = first + chunk_first * step;
+        chunk.step = step;
+        chunk.count = count;
+        const auto bitmap_size = bitmap_bytes(count);
+        const auto column_size = bitmap_size + kCellBytes * static_cast<size_t>(count);
+        chunk.data.assign(bitmap_size + series.columns.size() * column_size, 0);
+
+        auto* present = chunk.data.data();
+        for (auto r = row; r < end; ++r) {
+            set_bit(present, slot_of(r) - chunk_first);
+        }
+        for (size_t c = 0; c < series.columns.size(); ++c) {
+            auto* valid = chunk.data.data() + bitmap_size + c * column_size;
+            auto* cells = valid + bitmap_size;
+            const auto& column = series.columns[c];
+            std::visit(
+                [&](const auto& values) {
+                    using T = typename std::decay_t<decltype(values)>::value_type;
+                    if constexpr (sizeof(T) == kCellBytes && std::is_trivially_copyable_v<T>) {
+                        for (auto r = row; r < end; ++r) {
+                            if (column.valid[r]) {
+                                const auto local = slot_of(r) - chunk_first;
+                                set_bit(valid, local);
+                                store_cell(cells + local * kCellBytes, values[r]);
+                            }
+                        }
+                    } else {
+                        throw std::runtime_error(std::string("Cannot ") + caller + ": column '" + column.name +
+                                                 "' cannot be packed");
+                    }
+                },
+                column.values);
+        }
+        chunks.push_back(std::move(chunk));
+        row = end;
+    }
+    return chunks;
+}
+
+void unpack_chunk(int64_t start, int64_t step, int64_t count, const void* data, size_t size, PackedSeries& series) {
+    const auto bitmap_size = bitmap_bytes(count);
+    const auto column_size = bitmap_size + kCellBytes * static_cast<size_t>(count);
+    if (count < 0 || size != bitmap_size + series.columns.size() * column_size) {
+        throw std::runtime_error("Corrupt packed time series chunk: " + std::to_string(size) + " bytes for " +
+                                 std::to_string(count) + " slots of " + std::to_string(series.columns.size()) +
+                                 " columns");
+    }
+    const auto* bytes = static_cast<const uint8_t*>(data);
+
+    std::vector<int64_t> slots;
+    for (int64_t local = 0; local < count; ++local) {
+        if (test_bit(bytes, local)) {
+            slots.push_back(local);
+        }
+    }
+    for (auto local : slots) {
+        series.times.push_back(start + local * step);
+    }
+    for (size_t c = 0; c < series.columns.size(); ++c) {
+        const auto* valid = bytes + bitmap_size + c * column_size;
+        const auto* cells = valid + bitmap_size;
+        auto& column = series.columns[c];
+        std::visit(
+            [&](auto& values) {
+                using T = typename std::decay_t<decltype(values)>::value_type;
+                if constexpr (sizeof(T) == kCellBytes && std::is_trivially_copyable_v<T>) {
+                    for (auto local : slots) {
+                        T value{};
+                        const auto is_valid = test_bit(valid, local);
+                        if (is_valid) {
+                            value = load_cell<T>(cells + local * kCellBytes);
+                        }
+                        values.push_back(value);
+                        column.valid.push_back(is_valid ? 1 : 0);
+                    }
+                } else {
+                    throw std::runtime_error("Corrupt packed time series chunk: column '" + column.name +
+                                             "' is not numeric");
+                }
+            },
+            column.values);
+    }
+}
+
+int64_t packed_chunk_rows(int64_t count, const void* data, size_t size) {
+    const auto bitmap_size = bitmap_bytes(count);
+    if (count < 0 || size < bitmap_size) {
+        throw std::runtime_error("Corrupt packed time series chunk: " + std::to_string(size) + " bytes for " +
+                                 std::to_string(count) + " slots");
+    }
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    int64_t rows = 0;
+    for (size_t i = 0; i < bitmap_size; ++i) {
+        rows += std::popcount(bytes[i]);
+    }
+    return rows;
+}
+
+}  // namespace quiver::internal
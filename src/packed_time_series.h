@@ -0,0 +1,71 @@
+#ifndef QUIVER_PACKED_TIME_SERIES_H
+#define QUIVER_PACKED_TIME_SERIES_H
+
+#include "quiver/database.h"
+#include "quiver/schema.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace quiver::internal {
+
+// Slots per chunk: one year of hourly values, so a 30-year hourly series is about 30 rows.
+constexpr int64_t kPackedChunkSlots = 8760;
+
+// One element's rows of a packed time series group, decoded. times are seconds since the Unix
+// epoch (UTC), ascending and unique; columns are the group's value columns in declaration order,
+// each with one cell per time (int64_t for INTEGER, double for REAL) and a full validity mask.
+struct PackedSeries {
+    std::vector<int64_t> times;
+    std::vector<TimeSeriesColumn> columns;
+};
+
+// One stored chunk: count evenly spaced slots starting at start, step seconds apart. data holds a
+// presence bitmap (which slots are rows), then per value column a validity bitmap followed by
+// count 8-byte little-endian cells. Bitmaps are ceil(count / 8) bytes, least significant bit
+// first.
+struct PackedChunk {
+    int64_t start = 0;
+    int64_t step = 0;
+    int64_t count = 0;
+    std::vector<uint8_t> data;
+};
+
+// The value columns of a time series group: every column except id and the dimension column.
+std::vector<const ColumnDefinition*> packed_value_columns(const TableDefinition& table_def,
+                                                          const std::string& dim_col);
+
+// An empty series with one typed column per value column.
+PackedSeries make_packed_series(const std::vector<const ColumnDefinition*>& value_columns);
+
+// Parses a date_time cell ("YYYY-MM-DDTHH:MM:SS" or with a space) to epoch seconds, throwing
+// "Cannot <caller>: ..." when it is not one. format_packed_time always writes the T form.
+int64_t parse_packed_time(const std::string& value, const char* caller);
+std::string format_packed_time(int64_t seconds);
+
+// Appends row `index` of `from` to `to` (same column layout).
+void append_packed_row(PackedSeries& to, const PackedSeries& from, size_t index);
+
+// Merges `incoming` into `base` (both ascending), as write_time_series does for row tables:
+// Append rejects a time already in base, ReplaceRange drops base rows within incoming's first and
+// last time, Upsert replaces base rows at the same time.
+PackedSeries merge_packed_series(const PackedSeries& base,
+                                 const PackedSeries& incoming,
+                                 TimeSeriesWriteMode mode,
+                                 const char* caller);
+
+// Splits a series into chunks of at most kPackedChunkSlots slots, spaced by the greatest common
+// divisor of its time steps. Throws when the times are so irregular that the slots would
+// outnumber the rows many times over.
+std::vector<PackedChunk> pack_series(const PackedSeries& series, const char* caller);
+
+// Decodes one stored chunk, appending its rows to series.
+void unpack_chunk(int64_t start, int64_t step, int64_t count, const void* data, size_t size, PackedSeries& series);
+
+// The rows one stored chunk decodes to: the set bits of its presence bitmap, not its slot count.
+int64_t packed_chunk_rows(int64_t count, const void* data, size_t size);
+
+}  // namespace quiver::internal
+
+#endif  // QUIVER_PACKED_TIME_SERIES_H
@@ -1,7 +1,12 @@
 #include "quiver/schema.h"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
 #include <sqlite3.h>
 #include <stdexcept>
 #include <string_view>
@@ -42,21 +47,35 @@ const ColumnDefinition* TableDefinition::get_column(const std::string& column) c
 Schema Schema::from_database(sqlite3* db) {
     Schema schema;
     schema.load_from_database(db);
+    schema.build_index();
     return schema;
 }
 
+Schema::Schema(const Schema& other) : tables_(other.tables_), packed_tables_(other.packed_tables_) {
+    build_index();
+}
+
+Schema& Schema::operator=(const Schema& other) {
+    if (this != &other) {
+        tables_ = other.tables_;
+        packed_tables_ = other.packed_tables_;
+        build_index();
+    }
+    return *this;
+}
+
 // Schema public methods
 
 const TableDefinition* Schema::get_table(const std::string& name) const {
-    auto it = tables_.find(name);
-    if (it != tables_.end()) {
-        return &it->second;
+    auto it = table_index_.find(name);
+    if (it != table_index_.end()) {
+        return it->second;
     }
     return nullptr;
 }
 
 bool Schema::has_table(const std::string& name) const {
-    return tables_.find(name) != tables_.end();
+    return table_index_.find(name) != table_index_.end();
 }
 
 DataType Schema::get_data_type(const std::string& table, const std::string& column) const {
@@ -87,6 +106,10 @@ std::string Schema::time_series_files_table_name(const std::string& collection)
     return collection + "_time_series_files";
 }
 
+std::string Schema::packed_time_series_table_name(const std::string& collection, const std::string& group) {
+    return time_series_table_name(collection, group) + "_packed";
+}
+
 bool Schema::is_collection(const std::string& table) const {
     if (table == "Configuration") {
         return true;
@@ -107,14 +130,22 @@ bool Schema::is_time_series_table(const std::string& table) const {
     if (table.find("_time_series_") == std::string::npos) {
         return false;
     }
-    // Exclude time_series_files tables
-    return !is_time_series_files_table(table);
+    // Exclude time_series_files tables and packed storage tables
+    return !is_time_series_files_table(table) && !is_packed_time_series_table(table);
 }
 
 bool Schema::is_time_series_files_table(const std::string& table) const {
     return table.ends_with("_time_series_files");
 }
 
+bool Schema::is_packed_time_series_table(const std::string& table) const {
+    return !packed_tables_.empty() && packed_tables_.count(table) > 0;
+}
+
+bool Schema::is_packed_time_series_group(const std::string& collection, const std::string& group) const {
+    return !packed_tables_.empty() && packed_tables_.count(packed_time_series_table_name(collection, group)) > 0;
+}
+
 std::string Schema::get_parent_collection(const std::string& table) const {
     auto pos = table.find('_');
     if (pos != std::string::npos) {
@@ -138,16 +169,10 @@ std::string Schema::find_vector_table(const std::string& collection, const std::
         return vt;
     }
 
-    // Second try: search all vector tables for the collection
-    for (const auto& table_name : table_names()) {
-        if (!is_vector_table(table_name))
-            continue;
-        if (get_parent_collection(table_name) != collection)
-            continue;
-
-        const auto* table_def = get_table(table_name);
-        if (table_def && table_def->has_column(attribute)) {
-            return table_name;
+    // Second try: the first vector table of the collection that has the attribute as a column
+    for (const auto& match : find_all_tables_for_column(collection, attribute)) {
+        if (is_vector_table(match.table_name)) {
+            return match.table_name;
         }
     }
 
@@ -161,16 +186,10 @@ std::string Schema::find_set_table(const std::string& collection, const std::str
         return st;
     }
 
-    // Second try: search all set tables for the collection
-    for (const auto& table_name : table_names()) {
-        if (!is_set_table(table_name))
-            continue;
-        if (get_parent_collection(table_name) != collection)
-            continue;
-
-        const auto* table_def = get_table(table_name);
-        if (table_def && table_def->has_column(attribute)) {
-            return table_name;
+    // Second try: the first set table of the collection that has the attribute as a column
+    for (const auto& match : find_all_tables_for_column(collection, attribute)) {
+        if (is_set_table(match.table_name)) {
+            return match.table_name;
         }
     }
 
@@ -178,29 +197,12 @@ std::string Schema::find_set_table(const std::string& collection, const std::str
 }
 
 std::string Schema::find_time_series_table(const std::string& collection, const std::string& group) const {
-    // First try: Collection_time_series_group
+    // Time series groups are matched by name only: Collection_time_series_group
     auto ts = time_series_table_name(collection, group);
     if (has_table(ts)) {
         return ts;
     }
 
-    // Second try: search all time series tables for the collection
-    for (const auto& table_name : table_names()) {
-        if (!is_time_series_table(table_name))
-            continue;
-        if (get_parent_collection(table_name) != collection)
-            continue;
-
-        // Extract group name from table and compare
-        auto prefix = collection + "_time_series_";
-        if (table_name.starts_with(prefix)) {
-            auto extracted_group = table_name.substr(prefix.size());
-            if (extracted_group == group) {
-                return table_name;
-            }
-        }
-    }
-
     throw std::runtime_error("Time series group '" + group + "' not found for collection '" + collection + "'");
 }
 
@@ -225,61 +227,35 @@ bool Schema::is_group_table(const std::string& table, GroupTableType type) const
     }
 }
 
-std::vector<std::string> Schema::group_names(const std::string& collection, GroupTableType type) const {
-    std::string infix;
+const std::vector<std::string>& Schema::group_names(const std::string& collection, GroupTableType type) const {
+    static const std::vector<std::string> none;
+    auto it = collection_index_.find(collection);
+    if (it == collection_index_.end()) {
+        return none;
+    }
     switch (type) {
     case GroupTableType::Vector:
-        infix = "_vector_";
-        break;
+        return it->second.vector_groups;
     case GroupTableType::Set:
-        infix = "_set_";
-        break;
+        return it->second.set_groups;
     case GroupTableType::TimeSeries:
-        infix = "_time_series_";
-        break;
-    }
-    const auto prefix = collection + infix;
-
-    std::vector<std::string> result;
-    for (const auto& table_name : table_names()) {
-        if (!is_group_table(table_name, type))
-            continue;
-        if (get_parent_collection(table_name) != collection)
-            continue;
-        if (table_name.starts_with(prefix)) {
-            result.push_back(table_name.substr(prefix.size()));
-        }
+        return it->second.time_series_groups;
     }
-    return result;
+    return none;
 }
 
-std::vector<Schema::TableMatch> Schema::find_all_tables_for_column(const std::string& collection,
-                                                                   const std::string& column) const {
-    std::vector<TableMatch> matches;
-
-    // Check vector: direct name match first
-    auto vt = vector_table_name(collection, column);
-    if (has_table(vt)) {
-        matches.push_back({.table_name = vt, .type = GroupTableType::Vector});
+const std::vector<Schema::TableMatch>& Schema::find_all_tables_for_column(const std::string& collection,
+                                                                          const std::string& column) const {
+    static const std::vector<TableMatch> none;
+    auto it = collection_index_.find(collection);
+    if (it == collection_index_.end()) {
+        return none;
     }
-
-    for (const auto& [name, table] : tables_) {
-        if (get_parent_collection(name) != collection)
-            continue;
-        if (!table.has_column(column))
-            continue;
-        if (name == vt)
-            continue;  // already added above
-
-        if (is_vector_table(name)) {
-            matches.push_back({.table_name = name, .type = GroupTableType::Vector});
-        } else if (is_set_table(name)) {
-            matches.push_back({.table_name = name, .type = GroupTableType::Set});
-        } else if (is_time_series_table(name)) {
-            matches.push_back({.table_name = name, .type = GroupTableType::TimeSeries});
-        }
+    auto match_it = it->second.column_tables.find(column);
+    if (match_it == it->second.column_tables.end()) {
+        return none;
     }
-    return matches;
+    return match_it->second;
 }
 
 std::vector<std::string> Schema::table_names() const {
@@ -303,150 +279,268 @@ std::vector<std::string> Schema::collection_names() const {
 
 // Schema private methods
 
-void Schema::load_from_database(sqlite3* db) {
-    // Get all table names
-    const char* sql = "SELECT name FROM sqlite_master WHERE type='table' AND name NOT LIKE 'sqlite_%'";
-
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-        throw std::runtime_error("Failed to query table names");
+void Schema::build_index() {
+    table_index_.clear();
+    collection_index_.clear();
+    table_index_.reserve(tables_.size());
+    for (const auto& [name, table] : tables_) {
+        table_index_.emplace(name, &table);
     }
 
-    std::vector<std::string> names;
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-        if (name) {
-            names.emplace_back(name);
+    // tables_ is ordered by name, so every list below comes out in the order the per-call scans
+    // over tables_ used to produce.
+    auto add_group = [](std::vector<std::string>& groups, const std::string& table, const std::string& prefix) {
+        if (table.starts_with(prefix)) {
+            groups.push_back(table.substr(prefix.size()));
         }
-    }
-    sqlite3_finalize(stmt);
+    };
+    for (const auto& [name, table] : tables_) {
+        auto collection = get_parent_collection(name);
+        if (collection.empty()) {
+            continue;
+        }
+        auto& index = collection_index_[collection];
+        const auto vector_prefix = vector_table_name(collection, "");
 
-    // Load each table's metadata
-    for (const auto& name : names) {
-        TableDefinition table;
-        table.name = name;
+        if (is_vector_table(name)) {
+            add_group(index.vector_groups, name, vector_prefix);
+        }
+        if (is_set_table(name)) {
+            add_group(index.set_groups, name, set_table_name(collection, ""));
+        }
+        if (is_time_series_table(name)) {
+            add_group(index.time_series_groups, name, time_series_table_name(collection, ""));
+        }
 
-        auto columns = query_columns(db, name);
-        for (const auto& col : columns) {
-            table.column_order.push_back(col.name);
+        // Collection_vector_<column> is the preferred match for <column>, whatever it names its
+        // value column; every other table is matched by its columns below.
+        if (is_vector_table(name) && name.starts_with(vector_prefix)) {
+            index.column_tables[name.substr(vector_prefix.size())].push_back(
+                {.table_name = name, .type = GroupTableType::Vector});
         }
-        for (auto& col : columns) {
-            table.columns[col.name] = std::move(col);
+    }
+
+    for (const auto& [name, table] : tables_) {
+        auto collection = get_parent_collection(name);
+        if (collection.empty()) {
+            continue;
         }
 
-        table.foreign_keys = query_foreign_keys(db, name);
-        table.indexes = query_indexes(db, name);
+        GroupTableType type;
+        if (is_vector_table(name)) {
+            type = GroupTableType::Vector;
+        } else if (is_set_table(name)) {
+            type = GroupTableType::Set;
+        } else if (is_time_series_table(name)) {
+            type = GroupTableType::TimeSeries;
+        } else {
+            continue;
+        }
 
-        tables_[name] = std::move(table);
+        auto& column_tables = collection_index_[collection].column_tables;
+        for (const auto& column : table.column_order) {
+            if (name != vector_table_name(collection, column)) {
+                column_tables[column].push_back({.table_name = name, .type = type});
+            }
+        }
     }
 }
 
-std::vector<ColumnDefinition> Schema::query_columns(sqlite3* db, const std::string& table) {
-    if (!is_safe_identifier(table)) {
-        throw std::runtime_error("Cannot query columns: invalid table name: " + table);
-    }
-    std::vector<ColumnDefinition> columns;
-    auto sql = "PRAGMA table_info(" + table + ")";
-
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-        throw std::runtime_error("Failed to query columns for table: " + table);
+namespace {
+
+// Every table's columns, foreign keys and indexes in one statement, through the pragma table-valued
+// functions joined against sqlite_master, instead of four PRAGMAs per table. Rows come grouped by
+// table and then by kind (0 column, 1 foreign key, 2 index column), each in the order its PRAGMA
+// lists them:
+//   0: cid, -, name, type, notnull, dflt_value, pk
+//   1: id, seq, from, table, to, on_update, on_delete
+//   2: index seq, seqno (NULL when index_info has no rows), index name, column, unique
+const std::string kLoadSchemaSql = std::string(R"(
+    WITH tables(name) AS (
+        SELECT name FROM sqlite_master
+        WHERE type = 'table' AND name NOT LIKE 'sqlite_%' AND name <> ')") + Schema::kFingerprintTable + R"(')
+    SELECT t.name, 0, c.cid, 0, c.name, c.type, c."notnull", c.dflt_value, c.pk
+    FROM tables AS t, pragma_table_info(t.name) AS c
+    UNION ALL
+    SELECT t.name, 1, f.id, f.seq, f."from", f."table", f."to", f.on_update, f.on_delete
+    FROM tables AS t, pragma_foreign_key_list(t.name) AS f
+    UNION ALL
+    SELECT t.name, 2, l.seq, i.seqno, l.name, i.name, l."unique", NULL, NULL
+    FROM tables AS t, pragma_index_list(t.name) AS l LEFT JOIN pragma_index_info(l.name) AS i
+    ORDER BY 1, 2, 3, 4)";
+
+std::string column_text(sqlite3_stmt* stmt, int column) {
+    const auto* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, column));
+    return text ? text : "";
+}
+
+// The columns of a packed time series table.
+constexpr std::array<const char*, 6> kPackedColumns = {"id", "chunk", "start", "step", "count", "data"};
+
+// One row of kLoadSchemaSql past the table name: its kind and columns 4-8 (nullopt for NULL).
+struct SchemaRow {
+    int kind = 0;
+    std::array<std::optional<std::string>, 5> cells;
+
+    std::string text(size_t i) const { return cells[i].value_or(""); }
+    bool flag(size_t i) const { return cells[i] && *cells[i] != "0"; }
+};
+
+SchemaRow read_schema_row(sqlite3_stmt* stmt) {
+    SchemaRow row;
+    row.kind = sqlite3_column_int(stmt, 1);
+    for (int i = 0; i < 5; ++i) {
+        if (sqlite3_column_type(stmt, 4 + i) != SQLITE_NULL) {
+            row.cells[i] = column_text(stmt, 4 + i);
+        }
     }
+    return row;
+}
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
+void add_schema_row(TableDefinition& table, const SchemaRow& row) {
+    if (row.kind == 0) {
         ColumnDefinition col;
-        const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-        const char* type = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
-        const char* dflt_value = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-
-        col.name = name ? name : "";
-        std::string type_str = type ? type : "";
-        col.type = data_type_from_string(type_str);
-        col.not_null = sqlite3_column_int(stmt, 3) != 0;
-        col.primary_key = sqlite3_column_int(stmt, 5) != 0;
-        if (dflt_value) {
-            col.default_value = std::string(dflt_value);
-        }
+        col.name = row.text(0);
+        col.type = data_type_from_string(row.text(1));
+        col.not_null = row.flag(2);
+        col.default_value = row.cells[3];
+        col.primary_key = row.flag(4);
 
         // Infer DATE_TIME type from column name for TEXT columns
         if (col.type == DataType::Text && is_date_time_column(col.name)) {
             col.type = DataType::DateTime;
         }
 
-        columns.push_back(std::move(col));
+        table.column_order.push_back(col.name);
+        table.columns[col.name] = std::move(col);
+    } else if (row.kind == 1) {
+        table.foreign_keys.push_back({
+            .from_column = row.text(0),
+            .to_table = row.text(1),
+            .to_column = row.text(2),
+            .on_update = row.text(3),
+            .on_delete = row.text(4),
+        });
+    } else {
+        const auto index_name = row.text(0);
+        if (!is_safe_identifier(index_name)) {
+            return;
+        }
+        // One row per indexed column: the first opens the index, the rest add to it.
+        if (table.indexes.empty() || table.indexes.back().name != index_name) {
+            table.indexes.push_back({.name = index_name, .unique = row.flag(2), .columns = {}});
+        }
+        if (row.cells[1]) {
+            table.indexes.back().columns.push_back(*row.cells[1]);
+        }
     }
-    sqlite3_finalize(stmt);
-    return columns;
 }
 
-std::vector<ForeignKey> Schema::query_foreign_keys(sqlite3* db, const std::string& table) {
-    if (!is_safe_identifier(table)) {
-        throw std::runtime_error("Cannot query foreign keys: invalid table name: " + table);
-    }
-    std::vector<ForeignKey> fks;
-    auto sql = "PRAGMA foreign_key_list(" + table + ")";
-
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-        throw std::runtime_error("Failed to query foreign keys for table: " + table);
+// FNV-1a, 64-bit: stable across platforms and builds, unlike std::hash.
+void hash_bytes(uint64_t& hash, std::string_view bytes) {
+    for (const auto c : bytes) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
     }
+}
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        ForeignKey fk;
-        const char* to_table = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
-        const char* from_col = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-        const char* to_col = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 4));
-        const char* on_update = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 5));
-        const char* on_delete = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 6));
+}  // namespace
 
-        fk.to_table = to_table ? to_table : "";
-        fk.from_column = from_col ? from_col : "";
-        fk.to_column = to_col ? to_col : "";
-        fk.on_update = on_update ? on_update : "";
-        fk.on_delete = on_delete ? on_delete : "";
+void Schema::load_from_database(sqlite3* db) {
+    sqlite3_stmt* raw_stmt = nullptr;
+    if (sqlite3_prepare_v2(db, kLoadSchemaSql.c_str(), -1, &raw_stmt, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to load schema: " + std::string(sqlite3_errmsg(db)));
+    }
+    std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> stmt(raw_stmt, sqlite3_finalize);
+
+    // A Collection_time_series_<group>_packed table is packed storage only when it sits next to
+    // its time series table and has the chunk layout; any other such table is an ordinary group.
+    // The time series table sorts first (its name is a prefix), so a candidate's rows are held
+    // back until the table is complete and only then classified.
+    std::string current;
+    TableDefinition* table = nullptr;
+    std::vector<SchemaRow> candidate_rows;
+    auto classify_candidate = [&]() {
+        if (table || current.empty()) {
+            return;
+        }
+        std::vector<std::string> columns;
+        for (const auto& row : candidate_rows) {
+            if (row.kind == 0) {
+                columns.push_back(row.text(0));
+            }
+        }
+        const auto has_column = [&columns](const char* column) {
+            return std::find(columns.begin(), columns.end(), column) != columns.end();
+        };
+        if (std::all_of(kPackedColumns.begin(), kPackedColumns.end(), has_column)) {
+            packed_tables_[current] = std::move(columns);
+        } else {
+            auto& definition = tables_[current];
+            definition.name = current;
+            for (const auto& row : candidate_rows) {
+                add_schema_row(definition, row);
+            }
+        }
+        candidate_rows.clear();
+    };
+
+    int rc = 0;
+    while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+        auto name = column_text(stmt.get(), 0);
+        if (name != current) {
+            if (!is_safe_identifier(name)) {
+                throw std::runtime_error("Cannot query columns: invalid table name: " + name);
+            }
+            classify_candidate();
+            current = name;
+            constexpr std::string_view suffix = "_packed";
+            const auto candidate = name.find("_time_series_") != std::string::npos && name.ends_with(suffix) &&
+                                   is_time_series_table(name.substr(0, name.size() - suffix.size())) &&
+                                   tables_.count(name.substr(0, name.size() - suffix.size())) > 0;
+            table = nullptr;
+            if (!candidate) {
+                table = &tables_[name];
+                table->name = name;
+            }
+        }
 
-        fks.push_back(std::move(fk));
+        if (table) {
+            add_schema_row(*table, read_schema_row(stmt.get()));
+        } else {
+            candidate_rows.push_back(read_schema_row(stmt.get()));
+        }
     }
-    sqlite3_finalize(stmt);
-    return fks;
-}
-
-std::vector<Index> Schema::query_indexes(sqlite3* db, const std::string& table) {
-    if (!is_safe_identifier(table)) {
-        throw std::runtime_error("Cannot query indexes: invalid table name: " + table);
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to load schema: " + std::string(sqlite3_errmsg(db)));
     }
-    std::vector<Index> indexes;
-    auto sql = "PRAGMA index_list(" + table + ")";
+    classify_candidate();
+}
 
-    sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
-        return indexes;
+std::string Schema::fingerprint(sqlite3* db) {
+    const auto sql = std::string("SELECT type, name, sql FROM sqlite_master ") +
+                     "WHERE name NOT LIKE 'sqlite_%' AND name <> '" + kFingerprintTable + "' ORDER BY type, name";
+    sqlite3_stmt* raw_stmt = nullptr;
+    if (sqlite3_prepare_v2(db, sql.c_str(), -1, &raw_stmt, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to fingerprint schema: " + std::string(sqlite3_errmsg(db)));
     }
+    std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)> stmt(raw_stmt, sqlite3_finalize);
 
-    while (sqlite3_step(stmt) == SQLITE_ROW) {
-        Index idx;
-        const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-        idx.name = name ? name : "";
-        idx.unique = sqlite3_column_int(stmt, 2) != 0;
-
-        // Get columns for this index
-        if (!is_safe_identifier(idx.name))
-            continue;
-        auto idx_sql = "PRAGMA index_info(" + idx.name + ")";
-        sqlite3_stmt* idx_stmt = nullptr;
-        if (sqlite3_prepare_v2(db, idx_sql.c_str(), -1, &idx_stmt, nullptr) == SQLITE_OK) {
-            while (sqlite3_step(idx_stmt) == SQLITE_ROW) {
-                const char* col_name = reinterpret_cast<const char*>(sqlite3_column_text(idx_stmt, 2));
-                if (col_name) {
-                    idx.columns.emplace_back(col_name);
-                }
-            }
-            sqlite3_finalize(idx_stmt);
+    uint64_t hash = 14695981039346656037ULL;
+    int rc = 0;
+    while ((rc = sqlite3_step(stmt.get())) == SQLITE_ROW) {
+        for (int i = 0; i < 3; ++i) {
+            hash_bytes(hash, column_text(stmt.get(), i));
+            hash_bytes(hash, std::string_view("\0", 1));  // keeps "ab","c" apart from "a","bc"
         }
-        indexes.push_back(std::move(idx));
     }
-    sqlite3_finalize(stmt);
-    return indexes;
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to fingerprint schema: " + std::string(sqlite3_errmsg(db)));
+    }
+
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+    return hex;
 }
 
 }  // namespace quiver
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <set>
 #include <stdexcept>
+#include <string_view>
 
 namespace quiver {
 
@@ -37,6 +38,9 @@ void SchemaValidator::validate() {
         }
         // Time series tables have minimal validation (just file paths)
     }
+    for (const auto& [name, _] : schema_.packed_time_series_tables()) {
+        validate_packed_time_series_table(name);
+    }
 
     validate_no_duplicate_attributes();
     validate_foreign_keys();
@@ -221,6 +225,35 @@ void SchemaValidator::validate_time_series_files_table(const std::string& name)
     }
 }
 
+void SchemaValidator::validate_packed_time_series_table(const std::string& name) {
+    // Schema only classifies a table as packed next to its time series table and with the chunk
+    // columns; the time series table keeps declaring the group's columns.
+    constexpr std::string_view suffix = "_packed";
+    auto ts_name = name.substr(0, name.size() - suffix.size());
+    const auto* ts_table = schema_.get_table(ts_name);
+
+    // Chunks are evenly spaced slots of fixed-width numbers along one time axis.
+    std::vector<const ColumnDefinition*> dimensions;
+    for (const auto& [col_name, col] : ts_table->columns) {
+        if (col_name != "id" && col.primary_key) {
+            dimensions.push_back(&col);
+        }
+    }
+    if (dimensions.size() != 1 || dimensions.front()->type != DataType::DateTime) {
+        validation_error("Packed time series table '" + name + "' requires '" + ts_name +
+                         "' to have exactly one DATE_TIME dimension column");
+    }
+    for (const auto& [col_name, col] : ts_table->columns) {
+        if (col_name == "id" || col.primary_key) {
+            continue;
+        }
+        if (col.type != DataType::Integer && col.type != DataType::Real) {
+            validation_error("Packed time series table '" + name + "' cannot store " + data_type_to_string(col.type) +
+                             " column '" + col_name + "'; only INTEGER and REAL values can be packed");
+        }
+    }
+}
+
 void SchemaValidator::validate_no_duplicate_attributes() {
     // For each collection, gather all attribute names from scalar columns and all group tables
     // (vector, set, time series) and reject any duplicates.
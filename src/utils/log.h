@@ -0,0 +1,65 @@
+#ifndef QUIVER_LOG_H
+#define QUIVER_LOG_H
+
+#include <memory>
+#include <spdlog/spdlog.h>
+
+// Level-checked logging. QLOG_INFO(logger, "Created {} rows", count) evaluates and formats its
+// arguments only when the logger would emit the message, so a disabled level costs one level
+// comparison. logger may be a spdlog::logger& or a (shared) pointer to one.
+//
+// QUIVER_LOG_ACTIVE_LEVEL compiles out every level below it (0 = debug, 1 = info, 2 = warn,
+// 3 = error, 4 = off), e.g. -DQUIVER_LOG_ACTIVE_LEVEL=1 drops all debug logging from the build.
+#ifndef QUIVER_LOG_ACTIVE_LEVEL
+#define QUIVER_LOG_ACTIVE_LEVEL 0
+#endif
+
+namespace quiver::log {
+
+inline spdlog::logger& target(spdlog::logger& logger) {
+    return logger;
+}
+
+inline spdlog::logger& target(spdlog::logger* logger) {
+    return *logger;
+}
+
+inline spdlog::logger& target(const std::shared_ptr<spdlog::logger>& logger) {
+    return *logger;
+}
+
+}  // namespace quiver::log
+
+#define QLOG_AT(logger, level, ...)                               \
+    do {                                                          \
+        auto& quiver_log_target_ = ::quiver::log::target(logger); \
+        if (quiver_log_target_.should_log(level)) {               \
+            quiver_log_target_.log(level, __VA_ARGS__);           \
+        }                                                         \
+    } while (0)
+
+#if QUIVER_LOG_ACTIVE_LEVEL <= 0
+#define QLOG_DEBUG(logger, ...) QLOG_AT(logger, spdlog::level::debug, __VA_ARGS__)
+#else
+#define QLOG_DEBUG(logger, ...) (void)0
+#endif
+
+#if QUIVER_LOG_ACTIVE_LEVEL <= 1
+#define QLOG_INFO(logger, ...) QLOG_AT(logger, spdlog::level::info, __VA_ARGS__)
+#else
+#define QLOG_INFO(logger, ...) (void)0
+#endif
+
+#if QUIVER_LOG_ACTIVE_LEVEL <= 2
+#define QLOG_WARN(logger, ...) QLOG_AT(logger, spdlog::level::warn, __VA_ARGS__)
+#else
+#define QLOG_WARN(logger, ...) (void)0
+#endif
+
+#if QUIVER_LOG_ACTIVE_LEVEL <= 3
+#define QLOG_ERROR(logger, ...) QLOG_AT(logger, spdlog::level::err, __VA_ARGS__)
+#else
+#define QLOG_ERROR(logger, ...) (void)0
+#endif
+
+#endif  // QUIVER_LOG_H
@@ -3,16 +3,22 @@
 
 #include <algorithm>
 #include <string>
+#include <string_view>
 
 namespace quiver::string {
 
-inline std::string trim(const std::string& str) {
+// The same range as trim(), as a view into str - no allocation.
+inline std::string_view trim_view(std::string_view str) {
     auto start = str.find_first_not_of(" \t\n\r");
-    if (start == std::string::npos)
+    if (start == std::string_view::npos)
         return {};
     return str.substr(start, str.find_last_not_of(" \t\n\r") - start + 1);
 }
 
+inline std::string trim(const std::string& str) {
+    return std::string(trim_view(str));
+}
+
 inline char* new_c_str(const std::string& str) {
     auto result = new char[str.size() + 1];
     std::copy(str.begin(), str.end(), result);
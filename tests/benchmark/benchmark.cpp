@@ -157,12 +157,51 @@ static double run_batched(const std::string& schema_path, int element_count) {
     return elapsed_ms;
 }
 
+static double run_bulk(const std::string& schema_path, int element_count) {
+    auto db_path = temp_db_path("bulk");
+    remove_if_exists(db_path);
+    double elapsed_ms;
+
+    {
+        auto db = quiver::Database::from_schema(
+            db_path, schema_path, {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+        // Configuration element (outside timed region)
+        quiver::Element config;
+        config.set("label", std::string("Default"));
+        db.create_element("Configuration", config);
+
+        auto start = std::chrono::high_resolution_clock::now();
+
+        std::vector<quiver::Element> elements;
+        elements.reserve(element_count);
+        for (int i = 1; i <= element_count; ++i) {
+            elements.push_back(make_element(i));
+        }
+
+        db.begin_transaction();
+        auto ids = db.create_elements("Collection", elements);
+        for (int i = 1; i <= element_count; ++i) {
+            auto rows = make_time_series_rows(i);
+            db.update_time_series_group("Collection", "data", ids[i - 1], rows);
+        }
+        db.commit();
+
+        auto end = std::chrono::high_resolution_clock::now();
+        elapsed_ms = std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    remove_if_exists(db_path);
+    return elapsed_ms;
+}
+
 // ---------------------------------------------------------------------------
 // Output
 // ---------------------------------------------------------------------------
 
 static void print_results(const Stats& individual,
                           const Stats& batched,
+                          const Stats& bulk,
                           int element_count,
                           int ts_rows,
                           int iterations,
@@ -204,6 +243,15 @@ static void print_results(const Stats& individual,
                 batched.ops_per_sec,
                 speedup_buf);
 
+    ratio = individual.median_ms / bulk.median_ms;
+    std::snprintf(speedup_buf, sizeof(speedup_buf), "%.2fx", ratio);
+    std::printf("%-20s %12.1f %14.3f %12.1f %10s\n",
+                "Bulk create",
+                bulk.median_ms,
+                bulk.per_element_ms,
+                bulk.ops_per_sec,
+                speedup_buf);
+
     std::printf("\n");
 }
 
@@ -226,6 +274,10 @@ int main() {
     std::fflush(stdout);
     run_batched(schema_path, ELEMENT_COUNT);
 
+    std::printf("Running warm-up: bulk...\n");
+    std::fflush(stdout);
+    run_bulk(schema_path, ELEMENT_COUNT);
+
     // Collect individual times
     std::vector<double> individual_times;
     for (int i = 1; i <= ITERATIONS; ++i) {
@@ -242,11 +294,21 @@ int main() {
         batched_times.push_back(run_batched(schema_path, ELEMENT_COUNT));
     }
 
+    // Collect bulk times
+    std::vector<double> bulk_times;
+    for (int i = 1; i <= ITERATIONS; ++i) {
+        std::printf("Running: bulk [%d/%d]...\n", i, ITERATIONS);
+        std::fflush(stdout);
+        bulk_times.push_back(run_bulk(schema_path, ELEMENT_COUNT));
+    }
+
     // Compute and print results
     auto individual_stats = compute_stats(individual_times, ELEMENT_COUNT);
     auto batched_stats = compute_stats(batched_times, ELEMENT_COUNT);
+    auto bulk_stats = compute_stats(bulk_times, ELEMENT_COUNT);
 
-    print_results(individual_stats, batched_stats, ELEMENT_COUNT, TS_ROWS_PER_ELEMENT, ITERATIONS, schema_name);
+    print_results(
+        individual_stats, batched_stats, bulk_stats, ELEMENT_COUNT, TS_ROWS_PER_ELEMENT, ITERATIONS, schema_name);
 
     return 0;
 }
@@ -0,0 +1,31 @@
+-- Invalid: a packed time series group can only store INTEGER and REAL values
+PRAGMA foreign_keys = ON;
+
+CREATE TABLE Configuration (
+    id INTEGER PRIMARY KEY,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant_time_series_status (
+    id INTEGER,
+    date_time TEXT,
+    status TEXT,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, date_time)
+) STRICT;
+
+CREATE TABLE Plant_time_series_status_packed (
+    id INTEGER,
+    chunk INTEGER,
+    start INTEGER NOT NULL,
+    step INTEGER NOT NULL,
+    count INTEGER NOT NULL,
+    data BLOB NOT NULL,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, chunk)
+) STRICT;
@@ -0,0 +1,41 @@
+-- Schema: Time series groups with packed storage
+-- Tests: Collection_time_series_<group>_packed holds the rows of a group in BLOB chunks
+PRAGMA foreign_keys = ON;
+
+CREATE TABLE Configuration (
+    id INTEGER PRIMARY KEY,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant_time_series_inflow (
+    id INTEGER,
+    date_time TEXT,
+    inflow REAL,
+    turbines INTEGER,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, date_time)
+) STRICT;
+
+CREATE TABLE Plant_time_series_inflow_packed (
+    id INTEGER,
+    chunk INTEGER,
+    start INTEGER NOT NULL,
+    step INTEGER NOT NULL,
+    count INTEGER NOT NULL,
+    data BLOB NOT NULL,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, chunk)
+) STRICT;
+
+CREATE TABLE Plant_time_series_prices (
+    id INTEGER,
+    date_time TEXT,
+    price REAL,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, date_time)
+) STRICT;
@@ -0,0 +1,47 @@
+-- Schema: Packed time series group sharing a column name with a set group
+-- Tests: create_element arrays are FK-resolved against the set table, where operator is TEXT,
+--        so the packed group's INTEGER foreign key can receive strings
+PRAGMA foreign_keys = ON;
+
+CREATE TABLE Configuration (
+    id INTEGER PRIMARY KEY,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Operator (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant_set_operator (
+    id INTEGER,
+    operator TEXT,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    UNIQUE (id, operator)
+) STRICT;
+
+CREATE TABLE Plant_time_series_dispatch (
+    id INTEGER,
+    date_time TEXT,
+    operator INTEGER,
+    output REAL,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    FOREIGN KEY (operator) REFERENCES Operator(id) ON DELETE SET NULL ON UPDATE CASCADE,
+    PRIMARY KEY (id, date_time)
+) STRICT;
+
+CREATE TABLE Plant_time_series_dispatch_packed (
+    id INTEGER,
+    chunk INTEGER,
+    start INTEGER NOT NULL,
+    step INTEGER NOT NULL,
+    count INTEGER NOT NULL,
+    data BLOB NOT NULL,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, chunk)
+) STRICT;
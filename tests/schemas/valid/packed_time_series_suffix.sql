@@ -0,0 +1,37 @@
+-- Schema: Ordinary time series groups whose names end in _packed
+-- Tests: only a table with the chunk layout next to its time series table is packed storage
+PRAGMA foreign_keys = ON;
+
+CREATE TABLE Configuration (
+    id INTEGER PRIMARY KEY,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    label TEXT UNIQUE NOT NULL
+) STRICT;
+
+CREATE TABLE Plant_time_series_flow (
+    id INTEGER,
+    date_time TEXT,
+    flow REAL,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, date_time)
+) STRICT;
+
+CREATE TABLE Plant_time_series_flow_packed (
+    id INTEGER,
+    date_time TEXT,
+    flow_peak REAL,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, date_time)
+) STRICT;
+
+CREATE TABLE Plant_time_series_level_packed (
+    id INTEGER,
+    date_time TEXT,
+    level REAL,
+    FOREIGN KEY (id) REFERENCES Plant(id) ON DELETE CASCADE ON UPDATE CASCADE,
+    PRIMARY KEY (id, date_time)
+) STRICT;
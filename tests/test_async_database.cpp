@@ -0,0 +1,248 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <gtest/gtest.h>
+#include <quiver/async_database.h>
+#include <quiver/database.h>
+#include <quiver/element.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+const quiver::DatabaseOptions kQuiet = {.read_only = false, .console_level = quiver::LogLevel::Off};
+
+quiver::Element config(const std::string& label) {
+    quiver::Element element;
+    element.set("label", label);
+    return element;
+}
+
+// Occupies the worker until released, so the operations queued meanwhile are all waiting at once.
+class WorkerGate {
+public:
+    explicit WorkerGate(quiver::AsyncDatabase& db) {
+        done_ = db.submit([future = release_.get_future().share()](quiver::Database&) { future.wait(); });
+    }
+    void open() {
+        release_.set_value();
+        done_.get();
+    }
+
+private:
+    std::promise<void> release_;
+    std::future<void> done_;
+};
+
+}  // namespace
+
+class AsyncDatabaseFixture : public ::testing::Test {
+protected:
+    std::unique_ptr<quiver::AsyncDatabase> open(const quiver::AsyncDatabaseOptions& options = {}) {
+        auto db = quiver::Database::from_schema(":memory:", VALID_SCHEMA("basic.sql"), kQuiet);
+        // Committed transactions, counted through the change feed (one batch per commit).
+        subscription = db.subscribe_changes();
+        return std::make_unique<quiver::AsyncDatabase>(std::move(db), options);
+    }
+
+    size_t commits(quiver::AsyncDatabase& db) {
+        return db.submit([this](quiver::Database& d) { return d.poll_changes(subscription).size(); }).get();
+    }
+
+    int64_t subscription = 0;
+};
+
+TEST_F(AsyncDatabaseFixture, RunsOperationsInOrder) {
+    auto db = open();
+    auto first = db->create_element("Configuration", config("Config 1"));
+    auto second = db->create_element("Configuration", config("Config 2"));
+    db->update_element("Configuration", 1, quiver::Element().set("integer_attribute", int64_t{42}));
+    auto ids = db->read_element_ids("Configuration");
+    auto values = db->read_scalar_integers("Configuration", "integer_attribute");
+
+    EXPECT_EQ(first.get(), 1);
+    EXPECT_EQ(second.get(), 2);
+    EXPECT_EQ(ids.get(), (std::vector<int64_t>{1, 2}));
+    const auto read = values.get();
+    ASSERT_EQ(read.size(), 2u);
+    EXPECT_EQ(read[0], 42);
+
+    auto count = db->submit([](quiver::Database& d) { return d.query_integer("SELECT COUNT(*) FROM Configuration"); });
+    EXPECT_EQ(count.get(), 2);
+}
+
+TEST_F(AsyncDatabaseFixture, CoalescesQueuedWritesIntoOneTransaction) {
+    auto db = open();
+    std::vector<std::future<int64_t>> created;
+    {
+        WorkerGate gate(*db);
+        for (int i = 1; i <= 20; ++i) {
+            created.push_back(db->create_element("Configuration", config("Config " + std::to_string(i))));
+        }
+        gate.open();
+    }
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(created[i].get(), i + 1);
+    }
+    EXPECT_EQ(commits(*db), 1u);
+}
+
+TEST_F(AsyncDatabaseFixture, BatchSizeLimitSplitsTransactions) {
+    auto db = open({.max_batch_writes = 8});
+    std::vector<std::future<int64_t>> created;
+    {
+        WorkerGate gate(*db);
+        for (int i = 1; i <= 20; ++i) {
+            created.push_back(db->create_element("Configuration", config("Config " + std::to_string(i))));
+        }
+        gate.open();
+    }
+    db->flush().get();
+    EXPECT_EQ(commits(*db), 3u);
+
+    auto unbatched = open({.max_batch_writes = 1});
+    {
+        WorkerGate gate(*unbatched);
+        unbatched->create_element("Configuration", config("A"));
+        unbatched->create_element("Configuration", config("B"));
+        gate.open();
+    }
+    unbatched->flush().get();
+    EXPECT_EQ(commits(*unbatched), 2u);
+}
+
+TEST_F(AsyncDatabaseFixture, FailingWriteFailsAlone) {
+    auto db = open();
+    std::future<int64_t> before, duplicate, after;
+    {
+        WorkerGate gate(*db);
+        before = db->create_element("Configuration", config("Config 1"));
+        duplicate = db->create_element("Configuration", config("Config 1"));
+        after = db->create_element("Configuration", config("Config 2"));
+        gate.open();
+    }
+    EXPECT_EQ(before.get(), 1);
+    EXPECT_THROW(duplicate.get(), std::runtime_error);
+    EXPECT_EQ(after.get(), 2);
+    EXPECT_EQ(db->read_element_ids("Configuration").get(), (std::vector<int64_t>{1, 2}));
+}
+
+TEST_F(AsyncDatabaseFixture, FailingWriteKeepsTheBatchAndRunsNothingTwice) {
+    auto db = open();
+    int runs = 0;
+    std::future<int64_t> before, after;
+    std::future<void> failing;
+    {
+        WorkerGate gate(*db);
+        before = db->submit_write([&runs](quiver::Database& d) {
+            ++runs;
+            return d.create_element("Configuration", config("Config 1"));
+        });
+        failing = db->submit_write([](quiver::Database& d) {
+            d.create_element("Configuration", config("Undone"));
+            throw std::runtime_error("write failed after a change");
+        });
+        after = db->create_element("Configuration", config("Config 2"));
+        gate.open();
+    }
+    EXPECT_EQ(before.get(), 1);
+    EXPECT_THROW(failing.get(), std::runtime_error);
+    EXPECT_EQ(after.get(), 2);
+    EXPECT_EQ(runs, 1);
+    EXPECT_EQ(commits(*db), 1u);
+    EXPECT_EQ(db->read_element_ids("Configuration").get(), (std::vector<int64_t>{1, 2}));
+}
+
+TEST_F(AsyncDatabaseFixture, NonWriteEndsTheBatch) {
+    auto db = open();
+    std::future<std::vector<int64_t>> ids;
+    {
+        WorkerGate gate(*db);
+        db->create_element("Configuration", config("Config 1"));
+        ids = db->read_element_ids("Configuration");
+        db->create_element("Configuration", config("Config 2"));
+        gate.open();
+    }
+    EXPECT_EQ(ids.get(), (std::vector<int64_t>{1}));
+    db->flush().get();
+    EXPECT_EQ(commits(*db), 2u);
+}
+
+TEST_F(AsyncDatabaseFixture, ImportCsvRunsOutsideTheBatch) {
+    const auto path = std::filesystem::temp_directory_path() / "quiver_async_import.csv";
+    {
+        std::ofstream csv(path, std::ios::binary);
+        csv << "label,integer_attribute,float_attribute,string_attribute,date_attribute,boolean_attribute\n"
+               "Config 2,5,,,,\n"
+               "Config 3,,,,,\n";
+    }
+
+    auto db = open();
+    std::future<int64_t> first, second, after;
+    std::future<void> imported;
+    {
+        WorkerGate gate(*db);
+        first = db->create_element("Configuration", config("Config 1"));
+        second = db->create_element("Configuration", config("Config 2"));
+        imported = db->import_csv("Configuration", "", path.string());
+        after = db->create_element("Configuration", config("Config 4"));
+        gate.open();
+    }
+    EXPECT_EQ(first.get(), 1);
+    EXPECT_EQ(second.get(), 2);
+    EXPECT_NO_THROW(imported.get());
+    EXPECT_EQ(after.get(), 4);
+    std::filesystem::remove(path);
+
+    // The writes before the import commit as one batch, then the import and the last write.
+    EXPECT_EQ(commits(*db), 3u);
+    EXPECT_EQ(db->read_element_ids("Configuration").get(), (std::vector<int64_t>{2, 3, 4}));
+    EXPECT_EQ(db->read_scalar_integers("Configuration", "integer_attribute").get()[0], 5);
+}
+
+TEST_F(AsyncDatabaseFixture, WritesJoinAnOpenTransaction) {
+    auto db = open();
+    db->submit([](quiver::Database& d) { d.begin_transaction(); });
+    auto created = db->create_element("Configuration", config("Config 1"));
+    EXPECT_EQ(created.get(), 1);  // resolves before the caller's transaction ends
+    db->submit([](quiver::Database& d) { d.rollback(); }).get();
+    EXPECT_TRUE(db->read_element_ids("Configuration").get().empty());
+
+    db->submit([](quiver::Database& d) { d.begin_dry_run(); });
+    db->create_element("Configuration", config("Config 2"));
+    db->submit([](quiver::Database& d) { d.end_dry_run(); });
+    EXPECT_TRUE(db->read_element_ids("Configuration").get().empty());
+    EXPECT_EQ(commits(*db), 0u);
+}
+
+TEST_F(AsyncDatabaseFixture, DestructorRunsQueuedOperations) {
+    std::vector<std::future<int64_t>> created;
+    {
+        auto db = open();
+        for (int i = 1; i <= 5; ++i) {
+            created.push_back(db->create_element("Configuration", config("Config " + std::to_string(i))));
+        }
+    }
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(created[i].get(), i + 1);
+    }
+}
+
+TEST_F(AsyncDatabaseFixture, SubmitWithCallback) {
+    auto db = open();
+    std::promise<std::string> outcome;
+    db->submit_write([](quiver::Database& d) { d.create_element("Missing", config("x")); },
+                     [&outcome](std::exception_ptr error) {
+                         try {
+                             if (error) {
+                                 std::rethrow_exception(error);
+                             }
+                             outcome.set_value("ok");
+                         } catch (const std::exception& e) {
+                             outcome.set_value(e.what());
+                         }
+                     });
+    EXPECT_NE(outcome.get_future().get().find("Missing"), std::string::npos);
+}
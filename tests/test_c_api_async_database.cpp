@@ -0,0 +1,167 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <quiver/c/async_database.h>
+#include <quiver/c/database.h>
+#include <quiver/c/element.h>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// What the completion callbacks saw, in arrival order. Only read after close, which joins the worker.
+struct Outcomes {
+    std::vector<int64_t> ids;
+    std::vector<std::string> errors;
+    std::vector<int64_t> element_ids;
+    int completed = 0;
+};
+
+void on_id(void* user_data, quiver_error_t status, int64_t id, const char* error) {
+    auto* outcomes = static_cast<Outcomes*>(user_data);
+    if (status == QUIVER_OK) {
+        outcomes->ids.push_back(id);
+    } else {
+        outcomes->errors.push_back(error);
+    }
+}
+
+void on_done(void* user_data, quiver_error_t status, const char* error) {
+    auto* outcomes = static_cast<Outcomes*>(user_data);
+    if (status == QUIVER_OK) {
+        ++outcomes->completed;
+    } else {
+        outcomes->errors.push_back(error);
+    }
+}
+
+void on_ids(void* user_data, quiver_error_t status, const int64_t* ids, size_t count, const char* error) {
+    auto* outcomes = static_cast<Outcomes*>(user_data);
+    if (status == QUIVER_OK) {
+        outcomes->element_ids.assign(ids, ids + count);
+    } else {
+        outcomes->errors.push_back(error);
+    }
+}
+
+}  // namespace
+
+class AsyncDatabaseCApi : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = (fs::temp_directory_path() / "quiver_async_test.db").string();
+        fs::remove(path);
+        options = quiver::test::quiet_options();
+        options.file_log = QUIVER_FILE_LOG_OFF;
+        quiver_database_t* setup = nullptr;
+        ASSERT_EQ(quiver_database_from_schema(path.c_str(), VALID_SCHEMA("basic.sql").c_str(), &options, &setup),
+                  QUIVER_OK);
+        quiver_database_close(setup);
+    }
+    void TearDown() override { fs::remove(path); }
+
+    std::string path;
+    quiver_database_options_t options;
+};
+
+TEST_F(AsyncDatabaseCApi, CallbacksReportEachOperation) {
+    quiver_async_database_t* db = nullptr;
+    ASSERT_EQ(quiver_async_database_open(path.c_str(), &options, nullptr, &db), QUIVER_OK);
+    ASSERT_NE(db, nullptr);
+
+    quiver_element_t* element = nullptr;
+    ASSERT_EQ(quiver_element_create(&element), QUIVER_OK);
+    Outcomes outcomes;
+    for (const auto* label : {"Config 1", "Config 2", "Config 1"}) {
+        quiver_element_set_string(element, "label", label);
+        EXPECT_EQ(quiver_async_database_create_element(db, "Configuration", element, on_id, &outcomes), QUIVER_OK);
+    }
+    quiver_element_clear(element);
+    quiver_element_set_integer(element, "integer_attribute", 7);
+    EXPECT_EQ(quiver_async_database_update_element(db, "Configuration", 2, element, on_done, &outcomes), QUIVER_OK);
+    quiver_element_destroy(element);  // the queued operations hold their own copies
+
+    EXPECT_EQ(quiver_async_database_delete_element(db, "Configuration", 1, on_done, &outcomes), QUIVER_OK);
+    EXPECT_EQ(quiver_async_database_read_element_ids(db, "Configuration", on_ids, &outcomes), QUIVER_OK);
+    EXPECT_EQ(quiver_async_database_flush(db, on_done, &outcomes), QUIVER_OK);
+    EXPECT_EQ(quiver_async_database_flush(db, nullptr, nullptr), QUIVER_OK);
+    EXPECT_EQ(quiver_async_database_close(db), QUIVER_OK);
+
+    EXPECT_EQ(outcomes.ids, (std::vector<int64_t>{1, 2}));
+    ASSERT_EQ(outcomes.errors.size(), 1u);
+    EXPECT_NE(outcomes.errors[0].find("UNIQUE"), std::string::npos);
+    EXPECT_EQ(outcomes.completed, 3);
+    EXPECT_EQ(outcomes.element_ids, (std::vector<int64_t>{2}));
+
+    quiver_database_t* check = nullptr;
+    ASSERT_EQ(quiver_database_open(path.c_str(), &options, &check), QUIVER_OK);
+    int64_t value = 0;
+    int has_value = 0;
+    EXPECT_EQ(quiver_database_query_integer(check, "SELECT integer_attribute FROM Configuration WHERE id = 2", &value,
+                                            &has_value),
+              QUIVER_OK);
+    EXPECT_EQ(has_value, 1);
+    EXPECT_EQ(value, 7);
+    quiver_database_close(check);
+}
+
+TEST_F(AsyncDatabaseCApi, ImportCsvAfterQueuedWrites) {
+    const auto csv_path = (fs::temp_directory_path() / "quiver_async_c_import.csv").string();
+    {
+        std::ofstream csv(csv_path, std::ios::binary);
+        csv << "label,integer_attribute,float_attribute,string_attribute,date_attribute,boolean_attribute\n"
+               "Config 2,5,,,,\n"
+               "Config 3,,,,,\n";
+    }
+
+    quiver_async_database_t* db = nullptr;
+    ASSERT_EQ(quiver_async_database_open(path.c_str(), &options, nullptr, &db), QUIVER_OK);
+    quiver_element_t* element = nullptr;
+    ASSERT_EQ(quiver_element_create(&element), QUIVER_OK);
+    Outcomes outcomes;
+    for (const auto* label : {"Config 1", "Config 2"}) {
+        quiver_element_set_string(element, "label", label);
+        EXPECT_EQ(quiver_async_database_create_element(db, "Configuration", element, on_id, &outcomes), QUIVER_OK);
+    }
+    quiver_element_destroy(element);
+    EXPECT_EQ(quiver_async_database_import_csv(db, "Configuration", "", csv_path.c_str(), nullptr, on_done, &outcomes),
+              QUIVER_OK);
+    EXPECT_EQ(quiver_async_database_read_element_ids(db, "Configuration", on_ids, &outcomes), QUIVER_OK);
+    EXPECT_EQ(quiver_async_database_close(db), QUIVER_OK);
+    fs::remove(csv_path);
+
+    EXPECT_TRUE(outcomes.errors.empty());
+    EXPECT_EQ(outcomes.ids, (std::vector<int64_t>{1, 2}));
+    EXPECT_EQ(outcomes.completed, 1);
+    EXPECT_EQ(outcomes.element_ids, (std::vector<int64_t>{2, 3}));
+}
+
+TEST_F(AsyncDatabaseCApi, Options) {
+    auto defaults = quiver_async_database_options_default();
+    EXPECT_EQ(defaults.max_batch_writes, 1000u);
+    EXPECT_EQ(defaults.max_batch_delay_us, 0);
+
+    quiver_async_database_t* db = nullptr;
+    defaults.max_batch_delay_us = -1;
+    EXPECT_EQ(quiver_async_database_open(path.c_str(), &options, &defaults, &db), QUIVER_ERROR);
+    EXPECT_EQ(db, nullptr);
+    EXPECT_NE(std::string(quiver_get_last_error()).find("max_batch_delay_us"), std::string::npos);
+
+    defaults.max_batch_delay_us = 1000;
+    ASSERT_EQ(quiver_async_database_open(path.c_str(), &options, &defaults, &db), QUIVER_OK);
+    EXPECT_EQ(quiver_async_database_close(db), QUIVER_OK);
+}
+
+TEST_F(AsyncDatabaseCApi, NullArguments) {
+    quiver_async_database_t* db = nullptr;
+    EXPECT_EQ(quiver_async_database_open(nullptr, &options, nullptr, &db), QUIVER_ERROR);
+    ASSERT_EQ(quiver_async_database_open(path.c_str(), &options, nullptr, &db), QUIVER_OK);
+    EXPECT_EQ(quiver_async_database_create_element(db, "Configuration", nullptr, on_id, nullptr), QUIVER_ERROR);
+    EXPECT_EQ(quiver_async_database_delete_element(db, nullptr, 1, on_done, nullptr), QUIVER_ERROR);
+    EXPECT_EQ(quiver_async_database_flush(nullptr, on_done, nullptr), QUIVER_ERROR);
+    EXPECT_EQ(quiver_async_database_close(db), QUIVER_OK);
+}
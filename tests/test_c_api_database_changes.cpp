@@ -0,0 +1,116 @@
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+#include <quiver/c/database.h>
+#include <quiver/c/element.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct ReceivedChange {
+    int64_t sequence;
+    std::string table;
+    quiver_change_kind_t kind;
+    std::vector<int64_t> ids;
+};
+
+void record_change(void* user_data,
+                   int64_t sequence,
+                   const char* table,
+                   const char*,
+                   quiver_change_kind_t kind,
+                   const int64_t* ids,
+                   size_t id_count) {
+    static_cast<std::vector<ReceivedChange>*>(user_data)->push_back(
+        {sequence, table, kind, std::vector<int64_t>(ids, ids + id_count)});
+}
+
+int64_t create_item(quiver_database_t* db, const char* label) {
+    quiver_element_t* element = nullptr;
+    EXPECT_EQ(quiver_element_create(&element), QUIVER_OK);
+    quiver_element_set_string(element, "label", label);
+    int64_t id = 0;
+    EXPECT_EQ(quiver_database_create_element(db, "Collection", element, &id), QUIVER_OK);
+    quiver_element_destroy(element);
+    return id;
+}
+
+quiver_database_t* make_collections_db() {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    EXPECT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options, &db),
+              QUIVER_OK);
+    quiver_element_t* config = nullptr;
+    EXPECT_EQ(quiver_element_create(&config), QUIVER_OK);
+    quiver_element_set_string(config, "label", "Test Config");
+    int64_t config_id = 0;
+    EXPECT_EQ(quiver_database_create_element(db, "Configuration", config, &config_id), QUIVER_OK);
+    quiver_element_destroy(config);
+    return db;
+}
+
+}  // namespace
+
+TEST(DatabaseCApi, ChangesCallbackReceivesCommittedBatches) {
+    auto* db = make_collections_db();
+    std::vector<ReceivedChange> received;
+    int64_t subscription = 0;
+    ASSERT_EQ(quiver_database_subscribe_changes(db, record_change, &received, &subscription), QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_begin_transaction(db), QUIVER_OK);
+    const auto first = create_item(db, "Item 1");
+    const auto second = create_item(db, "Item 2");
+    ASSERT_EQ(quiver_database_commit(db), QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_begin_dry_run(db), QUIVER_OK);
+    create_item(db, "Dry run");
+    ASSERT_EQ(quiver_database_end_dry_run(db), QUIVER_OK);
+
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].sequence, 1);
+    EXPECT_EQ(received[0].table, "Collection");
+    EXPECT_EQ(received[0].kind, QUIVER_CHANGE_CREATED);
+    EXPECT_EQ(received[0].ids, (std::vector<int64_t>{first, second}));
+
+    EXPECT_EQ(quiver_database_unsubscribe_changes(db, subscription), QUIVER_OK);
+    EXPECT_EQ(quiver_database_unsubscribe_changes(db, subscription), QUIVER_ERROR);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, ChangesPollReturnsFlattenedEntries) {
+    auto* db = make_collections_db();
+    int64_t subscription = 0;
+    ASSERT_EQ(quiver_database_subscribe_changes(db, nullptr, nullptr, &subscription), QUIVER_OK);
+
+    const auto id = create_item(db, "Item");
+    ASSERT_EQ(quiver_database_delete_element(db, "Collection", id), QUIVER_OK);
+
+    int64_t* sequences = nullptr;
+    char** tables = nullptr;
+    char** collections = nullptr;
+    int* kinds = nullptr;
+    int64_t* ids = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_poll_changes(db, subscription, &sequences, &tables, &collections, &kinds, &ids, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(sequences[0], 1);
+    EXPECT_STREQ(tables[0], "Collection");
+    EXPECT_STREQ(collections[0], "Collection");
+    EXPECT_EQ(kinds[0], QUIVER_CHANGE_CREATED);
+    EXPECT_EQ(ids[0], id);
+    EXPECT_EQ(sequences[1], 2);
+    EXPECT_EQ(kinds[1], QUIVER_CHANGE_DELETED);
+    EXPECT_EQ(ids[1], id);
+    quiver_database_free_changes(sequences, tables, collections, kinds, ids, count);
+
+    ASSERT_EQ(quiver_database_poll_changes(db, subscription, &sequences, &tables, &collections, &kinds, &ids, &count),
+              QUIVER_OK);
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(ids, nullptr);
+
+    EXPECT_EQ(quiver_database_poll_changes(db, 999, &sequences, &tables, &collections, &kinds, &ids, &count),
+              QUIVER_ERROR);
+    quiver_database_close(db);
+}
@@ -4,6 +4,7 @@
 #include <gtest/gtest.h>
 #include <quiver/c/database.h>
 #include <quiver/c/element.h>
+#include <string>
 
 TEST(DatabaseCApi, CreateElementWithScalars) {
     // Test: Use C API to create element with schema
@@ -800,3 +801,55 @@ TEST(DatabaseCApi, ScalarFkResolutionFailureCausesNoPartialWrites) {
 
     quiver_database_close(db);
 }
+
+TEST(DatabaseCApi, CreateElements) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    quiver_element_t* elements[3] = {};
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(quiver_element_create(&elements[i]), QUIVER_OK);
+        quiver_element_set_string(elements[i], "label", ("Config " + std::to_string(i)).c_str());
+        quiver_element_set_integer(elements[i], "integer_attribute", i * 10);
+    }
+
+    int64_t ids[3] = {};
+    EXPECT_EQ(quiver_database_create_elements(db, "Configuration", elements, 3, ids), QUIVER_OK);
+    EXPECT_EQ(ids[0], 1);
+    EXPECT_EQ(ids[1], 2);
+    EXPECT_EQ(ids[2], 3);
+
+    int64_t value = 0;
+    int has_value = 0;
+    ASSERT_EQ(
+        quiver_database_read_scalar_integer_by_id(db, "Configuration", "integer_attribute", ids[2], &value, &has_value),
+        QUIVER_OK);
+    EXPECT_EQ(value, 20);
+
+    for (auto* element : elements) {
+        quiver_element_destroy(element);
+    }
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, CreateElementsErrors) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    int64_t ids[2] = {};
+    EXPECT_EQ(quiver_database_create_elements(nullptr, "Configuration", nullptr, 0, ids), QUIVER_ERROR);
+    EXPECT_EQ(quiver_database_create_elements(db, "Configuration", nullptr, 0, nullptr), QUIVER_OK);
+    EXPECT_EQ(quiver_database_create_elements(db, "Configuration", nullptr, 2, ids), QUIVER_ERROR);
+
+    quiver_element_t* element = nullptr;
+    ASSERT_EQ(quiver_element_create(&element), QUIVER_OK);
+    quiver_element_set_string(element, "label", "Config");
+    quiver_element_t* elements[2] = {element, nullptr};
+    EXPECT_EQ(quiver_database_create_elements(db, "Configuration", elements, 2, ids), QUIVER_ERROR);
+    EXPECT_STREQ(quiver_get_last_error(), "Null argument: elements[1]");
+
+    quiver_element_destroy(element);
+    quiver_database_close(db);
+}
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 #include <quiver/c/database.h>
 #include <quiver/c/element.h>
+#include <string>
 
 TEST(DatabaseCApi, DeleteElementById) {
     auto options = quiver::test::quiet_options();
@@ -256,3 +257,84 @@ TEST(DatabaseCApi, DeleteElementByIdNullArguments) {
 
     quiver_database_close(db);
 }
+
+TEST(DatabaseCApi, DeleteElementsAndWhere) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    quiver_element_t* e = nullptr;
+    ASSERT_EQ(quiver_element_create(&e), QUIVER_OK);
+    for (int64_t i = 1; i <= 5; ++i) {
+        const auto label = "Config " + std::to_string(i);
+        quiver_element_set_string(e, "label", label.c_str());
+        quiver_element_set_integer(e, "integer_attribute", i);
+        int64_t id = 0;
+        ASSERT_EQ(quiver_database_create_element(db, "Configuration", e, &id), QUIVER_OK);
+    }
+    quiver_element_destroy(e);
+
+    quiver_delete_result_t result = {};
+    const int64_t ids[] = {1, 2};
+    ASSERT_EQ(quiver_database_delete_elements(db, "Configuration", ids, 2, &result), QUIVER_OK);
+    EXPECT_EQ(result.elements, 2);
+    EXPECT_EQ(result.group_count, 0u);  // basic.sql has no group tables
+    EXPECT_EQ(result.group_tables, nullptr);
+    EXPECT_EQ(quiver_database_free_delete_result(&result), QUIVER_OK);
+
+    const int64_t unknown[] = {3, 77};
+    EXPECT_EQ(quiver_database_delete_elements(db, "Configuration", unknown, 2, &result), QUIVER_ERROR);
+    EXPECT_STREQ(quiver_get_last_error(), "Element not found: 77 in collection 'Configuration'");
+
+    int64_t threshold = 4;
+    const int types[] = {QUIVER_DATA_TYPE_INTEGER};
+    const void* values[] = {&threshold};
+    ASSERT_EQ(quiver_database_delete_elements_where(db, "Configuration", "integer_attribute >= ?", types, values, 1,
+                                                    &result),
+              QUIVER_OK);
+    EXPECT_EQ(result.elements, 2);
+    EXPECT_EQ(quiver_database_free_delete_result(&result), QUIVER_OK);
+
+    int64_t* remaining = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_element_ids(db, "Configuration", &remaining, &count), QUIVER_OK);
+    ASSERT_EQ(count, 1u);
+    EXPECT_EQ(remaining[0], 3);
+    quiver_database_free_integer_array(remaining);
+
+    EXPECT_EQ(quiver_database_delete_elements(db, "Configuration", nullptr, 1, &result), QUIVER_ERROR);
+    EXPECT_EQ(quiver_database_delete_elements(db, "Configuration", nullptr, 0, &result), QUIVER_OK);
+    EXPECT_EQ(result.elements, 0);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, DeleteElementsReportsGroupTables) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options, &db),
+              QUIVER_OK);
+
+    quiver_element_t* e = nullptr;
+    ASSERT_EQ(quiver_element_create(&e), QUIVER_OK);
+    quiver_element_set_string(e, "label", "Test Config");
+    int64_t id = 0;
+    ASSERT_EQ(quiver_database_create_element(db, "Configuration", e, &id), QUIVER_OK);
+    quiver_element_clear(e);
+    quiver_element_set_string(e, "label", "Item 1");
+    const int64_t values[] = {1, 2, 3};
+    quiver_element_set_array_integer(e, "value_int", values, 3, nullptr);
+    ASSERT_EQ(quiver_database_create_element(db, "Collection", e, &id), QUIVER_OK);
+    quiver_element_destroy(e);
+
+    quiver_delete_result_t result = {};
+    ASSERT_EQ(quiver_database_delete_elements(db, "Collection", &id, 1, &result), QUIVER_OK);
+    EXPECT_EQ(result.elements, 1);
+    ASSERT_EQ(result.group_count, 3u);
+    EXPECT_STREQ(result.group_tables[0], "Collection_set_tags");
+    EXPECT_EQ(result.group_rows[0], 0);
+    EXPECT_STREQ(result.group_tables[2], "Collection_vector_values");
+    EXPECT_EQ(result.group_rows[2], 3);
+    EXPECT_EQ(quiver_database_free_delete_result(&result), QUIVER_OK);
+    EXPECT_EQ(result.group_tables, nullptr);
+    quiver_database_close(db);
+}
@@ -149,6 +149,48 @@ TEST_F(TempFileFixture, DefaultOptions) {
 
     EXPECT_EQ(options.read_only, 0);
     EXPECT_EQ(options.console_level, QUIVER_LOG_INFO);
+    EXPECT_EQ(options.profile.journal_mode, QUIVER_JOURNAL_MODE_DEFAULT);
+    EXPECT_EQ(options.profile.synchronous, QUIVER_SYNCHRONOUS_DEFAULT);
+    EXPECT_EQ(options.profile.temp_store, QUIVER_TEMP_STORE_DEFAULT);
+    EXPECT_EQ(options.profile.cache_size_kib, 0);
+    EXPECT_EQ(options.profile.mmap_size, 0);
+    EXPECT_EQ(options.trace.enabled, 0);
+    EXPECT_EQ(options.trace.ring_capacity, 256);
+    EXPECT_EQ(options.file_log, QUIVER_FILE_LOG_SYNC);
+    EXPECT_EQ(options.immutable, 0);
+}
+
+TEST_F(TempFileFixture, OpenWithoutFileLog) {
+    const auto dir = fs::temp_directory_path() / "quiver_c_file_log_test";
+    fs::create_directories(dir);
+    const auto db_path = (dir / "test.db").string();
+
+    auto options = quiver::test::quiet_options();
+    options.file_log = QUIVER_FILE_LOG_OFF;
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_open(db_path.c_str(), &options, &db), QUIVER_OK);
+    quiver_database_close(db);
+
+    EXPECT_TRUE(fs::exists(db_path));
+    EXPECT_FALSE(fs::exists(dir / "quiver_database.log"));
+    fs::remove_all(dir);
+}
+
+TEST_F(TempFileFixture, OpenWithReadMostlyProfile) {
+    auto options = quiver::test::quiet_options();
+    options.profile = quiver_connection_profile_read_mostly();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_open(path.c_str(), &options, &db), QUIVER_OK);
+    ASSERT_NE(db, nullptr);
+
+    char* mode = nullptr;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_string(db, "PRAGMA journal_mode", &mode, &has_value), QUIVER_OK);
+    ASSERT_EQ(has_value, 1);
+    EXPECT_STREQ(mode, "wal");
+    quiver_database_free_string(mode);
+
+    quiver_database_close(db);
 }
 
 TEST_F(TempFileFixture, OpenWithNullOptions) {
@@ -175,6 +217,55 @@ TEST_F(TempFileFixture, OpenReadOnly) {
     quiver_database_close(db);
 }
 
+TEST_F(TempFileFixture, OpenImmutable) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(path.c_str(), VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+    quiver_database_close(db);
+
+    options.immutable = 1;
+    db = nullptr;
+    ASSERT_EQ(quiver_database_open(path.c_str(), &options, &db), QUIVER_OK);
+    ASSERT_NE(db, nullptr);
+
+    quiver_element_t* element = nullptr;
+    ASSERT_EQ(quiver_element_create(&element), QUIVER_OK);
+    quiver_element_set_string(element, "label", "Config");
+    int64_t id = 0;
+    EXPECT_EQ(quiver_database_create_element(db, "Configuration", element, &id), QUIVER_ERROR);
+    EXPECT_STREQ(quiver_get_last_error(), "Cannot create_element: database is immutable");
+    quiver_element_destroy(element);
+    quiver_database_close(db);
+
+    db = nullptr;
+    EXPECT_EQ(quiver_database_open(":memory:", &options, &db), QUIVER_ERROR);
+    EXPECT_EQ(db, nullptr);
+}
+
+TEST_F(TempFileFixture, OpenInMemoryCopyAndSave) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(path.c_str(), VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+    quiver_database_close(db);
+
+    quiver_database_t* copy = nullptr;
+    ASSERT_EQ(quiver_database_open_in_memory_copy(path.c_str(), &options, &copy), QUIVER_OK);
+    const char* copy_path = nullptr;
+    EXPECT_EQ(quiver_database_path(copy, &copy_path), QUIVER_OK);
+    EXPECT_STREQ(copy_path, ":memory:");
+
+    const auto saved = path + ".saved";
+    EXPECT_EQ(quiver_database_save_to(copy, saved.c_str()), QUIVER_OK);
+    EXPECT_TRUE(fs::exists(saved));
+    EXPECT_EQ(quiver_database_save_to(copy, nullptr), QUIVER_ERROR);
+    quiver_database_close(copy);
+    fs::remove(saved);
+
+    copy = nullptr;
+    EXPECT_EQ(quiver_database_open_in_memory_copy("nonexistent/quiver.db", &options, &copy), QUIVER_ERROR);
+    EXPECT_EQ(copy, nullptr);
+}
+
 // ============================================================================
 // Current version tests
 // ============================================================================
@@ -499,3 +590,30 @@ TEST_F(TempFileFixture, DescribeDoesNotFail) {
 
     quiver_database_close(db);
 }
+
+TEST(DatabaseCApi, EnsureIndexesCreatesMissingIndexes) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("relations.sql").c_str(), &options, &db),
+              QUIVER_OK);
+
+    quiver_missing_index_t* missing = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_missing_indexes(db, &missing, &count), QUIVER_OK);
+    ASSERT_EQ(count, 6u);
+    EXPECT_STREQ(missing[0].table, "Child");
+    EXPECT_STREQ(missing[0].columns, "parent_id");
+    EXPECT_STREQ(missing[0].create_sql, "CREATE INDEX IF NOT EXISTS idx_Child_parent_id ON Child (parent_id)");
+    EXPECT_NE(missing[0].reason, nullptr);
+    EXPECT_EQ(quiver_database_free_missing_indexes(missing, count), QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_ensure_indexes(db, &missing, &count), QUIVER_OK);
+    EXPECT_EQ(count, 6u);
+    EXPECT_EQ(quiver_database_free_missing_indexes(missing, count), QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_missing_indexes(db, &missing, &count), QUIVER_OK);
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(missing, nullptr);
+
+    quiver_database_close(db);
+}
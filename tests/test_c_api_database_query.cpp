@@ -4,6 +4,7 @@
 #include <quiver/c/database.h>
 #include <quiver/c/element.h>
 #include <string>
+#include <vector>
 
 // ============================================================================
 // Query string tests
@@ -541,3 +542,167 @@ TEST(DatabaseCApiQuery, QueryParameterCountMismatch) {
 
     quiver_database_close(db);
 }
+
+// ============================================================================
+// Cursor tests
+// ============================================================================
+
+TEST(DatabaseCApiQuery, CursorStepsRows) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    for (int i = 0; i < 2; ++i) {
+        quiver_element_t* e = nullptr;
+        ASSERT_EQ(quiver_element_create(&e), QUIVER_OK);
+        quiver_element_set_string(e, "label", ("Config " + std::to_string(i)).c_str());
+        quiver_element_set_float(e, "float_attribute", 1.5 * i);
+        int64_t id = 0;
+        quiver_database_create_element(db, "Configuration", e, &id);
+        quiver_element_destroy(e);
+    }
+
+    int64_t min_id = 1;
+    int param_types[] = {QUIVER_DATA_TYPE_INTEGER};
+    const void* param_values[] = {&min_id};
+    const char* sql = "SELECT id, label, float_attribute FROM Configuration WHERE id >= ? ORDER BY id";
+    quiver_database_cursor_t* cursor = nullptr;
+    ASSERT_EQ(quiver_database_cursor_open(db, sql, param_types, param_values, 1, &cursor), QUIVER_OK);
+
+    size_t column_count = 0;
+    ASSERT_EQ(quiver_database_cursor_column_count(cursor, &column_count), QUIVER_OK);
+    EXPECT_EQ(column_count, 3);
+    const char* name = nullptr;
+    ASSERT_EQ(quiver_database_cursor_column_name(cursor, 1, &name), QUIVER_OK);
+    EXPECT_STREQ(name, "label");
+    EXPECT_EQ(quiver_database_cursor_column_name(cursor, 3, &name), QUIVER_ERROR);
+
+    std::vector<std::string> labels;
+    std::vector<double> floats;
+    int has_row = 0;
+    while (quiver_database_cursor_next(cursor, &has_row) == QUIVER_OK && has_row) {
+        int64_t id = 0;
+        double value = 0.0;
+        char* label = nullptr;
+        int has_value = 0;
+        ASSERT_EQ(quiver_database_cursor_get_integer(cursor, 0, &id, &has_value), QUIVER_OK);
+        EXPECT_EQ(has_value, 1);
+        ASSERT_EQ(quiver_database_cursor_get_string(cursor, 1, &label, &has_value), QUIVER_OK);
+        labels.emplace_back(label);
+        quiver_database_free_string(label);
+        ASSERT_EQ(quiver_database_cursor_get_float(cursor, 2, &value, &has_value), QUIVER_OK);
+        floats.push_back(value);
+    }
+    EXPECT_EQ(labels, (std::vector<std::string>{"Config 0", "Config 1"}));
+    EXPECT_EQ(floats, (std::vector<double>{0.0, 1.5}));
+
+    EXPECT_EQ(quiver_database_cursor_close(cursor), QUIVER_OK);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, CursorReportsNullCells) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    quiver_database_cursor_t* cursor = nullptr;
+    ASSERT_EQ(quiver_database_cursor_open(db, "SELECT NULL", nullptr, nullptr, 0, &cursor), QUIVER_OK);
+    int has_row = 0;
+    ASSERT_EQ(quiver_database_cursor_next(cursor, &has_row), QUIVER_OK);
+    ASSERT_EQ(has_row, 1);
+
+    char* value = nullptr;
+    int has_value = 1;
+    ASSERT_EQ(quiver_database_cursor_get_string(cursor, 0, &value, &has_value), QUIVER_OK);
+    EXPECT_EQ(has_value, 0);
+    EXPECT_EQ(value, nullptr);
+
+    ASSERT_EQ(quiver_database_cursor_next(cursor, &has_row), QUIVER_OK);
+    EXPECT_EQ(has_row, 0);
+
+    quiver_database_cursor_close(cursor);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, CursorOpenErrors) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    quiver_database_cursor_t* cursor = nullptr;
+    EXPECT_EQ(quiver_database_cursor_open(nullptr, "SELECT 1", nullptr, nullptr, 0, &cursor), QUIVER_ERROR);
+    EXPECT_EQ(quiver_database_cursor_open(db, "SELECT * FROM Missing", nullptr, nullptr, 0, &cursor), QUIVER_ERROR);
+    EXPECT_EQ(cursor, nullptr);
+    EXPECT_EQ(quiver_database_cursor_open(db, "SELECT ?", nullptr, nullptr, 0, &cursor), QUIVER_ERROR);
+    std::string msg = quiver_get_last_error();
+    EXPECT_NE(msg.find("expected 1 bound parameter"), std::string::npos) << "Actual: " << msg;
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApiQuery, QueryTableReturnsColumns) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    for (int i = 0; i < 2; ++i) {
+        quiver_element_t* e = nullptr;
+        ASSERT_EQ(quiver_element_create(&e), QUIVER_OK);
+        quiver_element_set_string(e, "label", ("Config " + std::to_string(i)).c_str());
+        if (i == 1) {
+            quiver_element_set_float(e, "float_attribute", 2.5);
+        }
+        int64_t id = 0;
+        quiver_database_create_element(db, "Configuration", e, &id);
+        quiver_element_destroy(e);
+    }
+
+    int64_t min_id = 1;
+    int param_types[] = {QUIVER_DATA_TYPE_INTEGER};
+    const void* param_values[] = {&min_id};
+    char** names = nullptr;
+    int* types = nullptr;
+    void** data = nullptr;
+    uint8_t** has_value = nullptr;
+    size_t column_count = 0;
+    size_t row_count = 0;
+    ASSERT_EQ(quiver_database_query_table(db,
+                                          "SELECT id, label, float_attribute FROM Configuration WHERE id >= ?",
+                                          param_types,
+                                          param_values,
+                                          1,
+                                          &names,
+                                          &types,
+                                          &data,
+                                          &has_value,
+                                          &column_count,
+                                          &row_count),
+              QUIVER_OK);
+    ASSERT_EQ(column_count, 3u);
+    ASSERT_EQ(row_count, 2u);
+    EXPECT_STREQ(names[1], "label");
+    EXPECT_EQ(types[0], QUIVER_DATA_TYPE_INTEGER);
+    EXPECT_EQ(types[1], QUIVER_DATA_TYPE_STRING);
+    EXPECT_EQ(types[2], QUIVER_DATA_TYPE_FLOAT);
+    EXPECT_EQ(static_cast<int64_t*>(data[0])[1], 2);
+    EXPECT_STREQ(static_cast<char**>(data[1])[0], "Config 0");
+    EXPECT_EQ(has_value[2][0], 0);
+    EXPECT_EQ(has_value[2][1], 1);
+    EXPECT_DOUBLE_EQ(static_cast<double*>(data[2])[1], 2.5);
+    EXPECT_EQ(quiver_database_free_time_series_data(names, types, data, has_value, column_count, row_count),
+              QUIVER_OK);
+
+    EXPECT_EQ(quiver_database_query_table(db,
+                                          "SELECT x'00'",
+                                          nullptr,
+                                          nullptr,
+                                          0,
+                                          &names,
+                                          &types,
+                                          &data,
+                                          &has_value,
+                                          &column_count,
+                                          &row_count),
+              QUIVER_ERROR);
+    quiver_database_close(db);
+}
@@ -436,6 +436,56 @@ TEST(DatabaseCApi, ReadScalarByIdNotFound) {
 // Read element Ids tests
 // ============================================================================
 
+TEST(DatabaseCApi, ReadScalarsByIds) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    int64_t created[2] = {0, 0};
+    for (int i = 0; i < 2; ++i) {
+        quiver_element_t* e = nullptr;
+        ASSERT_EQ(quiver_element_create(&e), QUIVER_OK);
+        quiver_element_set_string(e, "label", ("Config " + std::to_string(i + 1)).c_str());
+        quiver_element_set_integer(e, "integer_attribute", 10 * (i + 1));
+        quiver_database_create_element(db, "Configuration", e, &created[i]);
+        EXPECT_EQ(quiver_element_destroy(e), QUIVER_OK);
+    }
+
+    const int64_t ids[] = {created[1], 999, created[0]};
+    int64_t* values = nullptr;
+    uint8_t* mask = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_read_scalar_integers_by_ids(
+                  db, "Configuration", "integer_attribute", ids, 3, &values, &mask, &count),
+              QUIVER_OK);
+    ASSERT_EQ(count, 3u);
+    EXPECT_EQ(values[0], 20);
+    EXPECT_EQ(mask[1], 0);
+    EXPECT_EQ(values[2], 10);
+    quiver_database_free_integer_array(values);
+    quiver_database_free_mask(mask);
+
+    double* floats = nullptr;
+    ASSERT_EQ(
+        quiver_database_read_scalar_floats_by_ids(db, "Configuration", "float_attribute", ids, 3, &floats, &mask, &count),
+        QUIVER_OK);
+    EXPECT_EQ(mask[0], 0);
+    quiver_database_free_float_array(floats);
+    quiver_database_free_mask(mask);
+
+    char** labels = nullptr;
+    ASSERT_EQ(quiver_database_read_scalar_strings_by_ids(db, "Configuration", "label", ids, 3, &labels, &count),
+              QUIVER_OK);
+    EXPECT_STREQ(labels[0], "Config 2");
+    EXPECT_EQ(labels[1], nullptr);
+    quiver_database_free_string_array(labels, count);
+
+    EXPECT_EQ(quiver_database_read_scalar_integers_by_ids(
+                  db, "Configuration", "integer_attribute", nullptr, 1, &values, &mask, &count),
+              QUIVER_ERROR);
+    quiver_database_close(db);
+}
+
 TEST(DatabaseCApi, ReadElementIds) {
     auto options = quiver::test::quiet_options();
     quiver_database_t* db = nullptr;
@@ -640,6 +690,26 @@ TEST(DatabaseCApi, ReadScalarIntegersNullOutput) {
     quiver_database_close(db);
 }
 
+TEST(DatabaseCApi, ReadScalarNumericErrorsNameColumnReader) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+    ASSERT_NE(db, nullptr);
+
+    int64_t* integers = nullptr;
+    double* floats = nullptr;
+    uint8_t* mask = nullptr;
+    size_t count = 0;
+    EXPECT_EQ(quiver_database_read_scalar_integers(db, "Nope", "integer_attribute", &integers, &mask, &count),
+              QUIVER_ERROR);
+    EXPECT_STREQ(quiver_get_last_error(), "Cannot read_scalar_integers_column: collection not found: Nope");
+
+    EXPECT_EQ(quiver_database_read_scalar_floats(db, "Nope", "float_attribute", &floats, &mask, &count), QUIVER_ERROR);
+    EXPECT_STREQ(quiver_get_last_error(), "Cannot read_scalar_floats_column: collection not found: Nope");
+
+    quiver_database_close(db);
+}
+
 TEST(DatabaseCApi, ReadScalarFloatsNullDb) {
     double* values = nullptr;
     uint8_t* mask = nullptr;
@@ -0,0 +1,76 @@
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+#include <quiver/c/database.h>
+#include <string>
+
+TEST(DatabaseCApi, StatsListsEnabledOperations) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+
+    quiver_operation_stats_t* stats = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_stats(db, &stats, &count), QUIVER_OK);
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(stats, nullptr);
+
+    ASSERT_EQ(quiver_database_enable_stats(db, 1), QUIVER_OK);
+    int64_t value = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_integer(db, "SELECT 1 UNION ALL SELECT 2", &value, &has_value), QUIVER_OK);
+    ASSERT_EQ(quiver_database_query_integer(db, "SELECT 1 UNION ALL SELECT 2", &value, &has_value), QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_stats(db, &stats, &count), QUIVER_OK);
+    ASSERT_EQ(count, 1u);
+    EXPECT_STREQ(stats[0].operation, "query_integer");
+    EXPECT_EQ(stats[0].calls, 2);
+    EXPECT_EQ(stats[0].rows_read, 2);  // query_integer steps only the first row
+    EXPECT_EQ(stats[0].statements_prepared, 1);
+    EXPECT_EQ(stats[0].statements_reused, 1);
+    EXPECT_EQ(quiver_database_free_stats(stats, count), QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_reset_stats(db), QUIVER_OK);
+    ASSERT_EQ(quiver_database_stats(db, &stats, &count), QUIVER_OK);
+    EXPECT_EQ(count, 0u);
+
+    EXPECT_EQ(quiver_database_stats(nullptr, &stats, &count), QUIVER_ERROR);
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, TracedStatementsReportsSlowLog) {
+    auto options = quiver::test::quiet_options();
+    options.trace.enabled = 1;
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("basic.sql").c_str(), &options, &db), QUIVER_OK);
+    ASSERT_EQ(quiver_database_clear_traced_statements(db), QUIVER_OK);
+
+    quiver_traced_statement_t* traced = nullptr;
+    size_t count = 0;
+    ASSERT_EQ(quiver_database_traced_statements(db, &traced, &count), QUIVER_OK);
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(traced, nullptr);
+
+    int64_t value = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_integer(db, "SELECT 1 UNION ALL SELECT 2", &value, &has_value), QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_traced_statements(db, &traced, &count), QUIVER_OK);
+    ASSERT_EQ(count, 1u);
+    EXPECT_STREQ(traced[0].sql, "SELECT 1 UNION ALL SELECT 2");
+    EXPECT_STREQ(traced[0].operation, "query_integer");
+    EXPECT_EQ(traced[0].rows, 1);
+    EXPECT_GE(traced[0].elapsed_ns, 0);
+    EXPECT_EQ(quiver_database_free_traced_statements(traced, count), QUIVER_OK);
+
+    quiver_database_close(db);
+}
+
+TEST(DatabaseCApi, TraceRejectsNegativeRingCapacity) {
+    auto options = quiver::test::quiet_options();
+    options.trace.enabled = 1;
+    options.trace.ring_capacity = -1;
+    quiver_database_t* db = nullptr;
+    EXPECT_EQ(quiver_database_open(":memory:", &options, &db), QUIVER_ERROR);
+    EXPECT_EQ(db, nullptr);
+}
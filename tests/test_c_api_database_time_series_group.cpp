@@ -1012,3 +1012,189 @@ TEST(DatabaseCApi, ReadTimeSeriesGroupMultiColumnEmpty) {
 
     quiver_database_close(db);
 }
+
+// ============================================================================
+// Bulk columnar write tests
+// ============================================================================
+
+TEST(DatabaseCApi, WriteTimeSeriesManyElements) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options, &db),
+              QUIVER_OK);
+
+    quiver_element_t* config = nullptr;
+    ASSERT_EQ(quiver_element_create(&config), QUIVER_OK);
+    quiver_element_set_string(config, "label", "Test Config");
+    int64_t tmp_id = 0;
+    quiver_database_create_element(db, "Configuration", config, &tmp_id);
+    EXPECT_EQ(quiver_element_destroy(config), QUIVER_OK);
+
+    int64_t element_ids[2] = {0, 0};
+    for (int i = 0; i < 2; ++i) {
+        quiver_element_t* e = nullptr;
+        ASSERT_EQ(quiver_element_create(&e), QUIVER_OK);
+        quiver_element_set_string(e, "label", ("Item " + std::to_string(i + 1)).c_str());
+        quiver_database_create_element(db, "Collection", e, &element_ids[i]);
+        EXPECT_EQ(quiver_element_destroy(e), QUIVER_OK);
+    }
+
+    int64_t ids[] = {element_ids[0], element_ids[1], element_ids[1]};
+    const char* col_names[] = {"date_time", "value"};
+    int col_types[] = {QUIVER_DATA_TYPE_STRING, QUIVER_DATA_TYPE_FLOAT};
+    const char* date_times[] = {"2024-01-01T10:00:00", "2024-01-01T10:00:00", "2024-01-01T11:00:00"};
+    double values[] = {1.5, 2.5, 0.0};
+    uint8_t value_mask[] = {1, 1, 0};
+    const void* col_data[] = {date_times, values};
+    const uint8_t* col_has_value[] = {nullptr, value_mask};
+    ASSERT_EQ(quiver_database_write_time_series(db,
+                                                "Collection",
+                                                "data",
+                                                ids,
+                                                col_names,
+                                                col_types,
+                                                col_data,
+                                                col_has_value,
+                                                2,
+                                                3,
+                                                QUIVER_TIME_SERIES_WRITE_APPEND),
+              QUIVER_OK);
+
+    // Upsert one existing key for the second element
+    int64_t upsert_ids[] = {element_ids[1]};
+    const char* upsert_dates[] = {"2024-01-01T11:00:00"};
+    double upsert_values[] = {9.0};
+    const void* upsert_data[] = {upsert_dates, upsert_values};
+    ASSERT_EQ(quiver_database_write_time_series(db,
+                                                "Collection",
+                                                "data",
+                                                upsert_ids,
+                                                col_names,
+                                                col_types,
+                                                upsert_data,
+                                                nullptr,
+                                                2,
+                                                1,
+                                                QUIVER_TIME_SERIES_WRITE_UPSERT),
+              QUIVER_OK);
+
+    int64_t count = 0;
+    int has_value = 0;
+    ASSERT_EQ(quiver_database_query_integer(
+                  db, "SELECT COUNT(*) FROM Collection_time_series_data", &count, &has_value),
+              QUIVER_OK);
+    EXPECT_EQ(count, 3);
+    double upserted = 0.0;
+    ASSERT_EQ(quiver_database_query_float(
+                  db,
+                  "SELECT value FROM Collection_time_series_data WHERE date_time = '2024-01-01T11:00:00'",
+                  &upserted,
+                  &has_value),
+              QUIVER_OK);
+    EXPECT_DOUBLE_EQ(upserted, 9.0);
+
+    // An unknown mode is rejected before anything is written
+    EXPECT_EQ(quiver_database_write_time_series(
+                  db, "Collection", "data", upsert_ids, col_names, col_types, upsert_data, nullptr, 2, 1, 7),
+              QUIVER_ERROR);
+    EXPECT_STREQ(quiver_get_last_error(), "Cannot write_time_series: unknown write mode 7");
+
+    EXPECT_EQ(quiver_database_close(db), QUIVER_OK);
+}
+
+TEST(DatabaseCApi, ReadTimeSeriesGroupAll) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options, &db),
+              QUIVER_OK);
+
+    quiver_element_t* config = nullptr;
+    ASSERT_EQ(quiver_element_create(&config), QUIVER_OK);
+    quiver_element_set_string(config, "label", "Test Config");
+    int64_t tmp_id = 0;
+    quiver_database_create_element(db, "Configuration", config, &tmp_id);
+    EXPECT_EQ(quiver_element_destroy(config), QUIVER_OK);
+
+    int64_t element_ids[2] = {0, 0};
+    for (int i = 0; i < 2; ++i) {
+        quiver_element_t* e = nullptr;
+        ASSERT_EQ(quiver_element_create(&e), QUIVER_OK);
+        quiver_element_set_string(e, "label", ("Item " + std::to_string(i + 1)).c_str());
+        quiver_database_create_element(db, "Collection", e, &element_ids[i]);
+        EXPECT_EQ(quiver_element_destroy(e), QUIVER_OK);
+    }
+
+    int64_t* out_ids = nullptr;
+    char** out_col_names = nullptr;
+    int* out_col_types = nullptr;
+    void** out_col_data = nullptr;
+    uint8_t** out_col_has_value = nullptr;
+    size_t col_count = 0;
+    size_t row_count = 0;
+
+    // Empty group: NULL arrays, zero counts
+    ASSERT_EQ(quiver_database_read_time_series_group_all(db,
+                                                         "Collection",
+                                                         "data",
+                                                         &out_ids,
+                                                         &out_col_names,
+                                                         &out_col_types,
+                                                         &out_col_data,
+                                                         &out_col_has_value,
+                                                         &col_count,
+                                                         &row_count),
+              QUIVER_OK);
+    EXPECT_EQ(out_ids, nullptr);
+    EXPECT_EQ(row_count, 0);
+
+    int64_t ids[] = {element_ids[1], element_ids[0]};
+    const char* col_names[] = {"date_time", "value"};
+    int col_types[] = {QUIVER_DATA_TYPE_STRING, QUIVER_DATA_TYPE_FLOAT};
+    const char* date_times[] = {"2024-01-01T10:00:00", "2024-01-01T10:00:00"};
+    double values[] = {2.5, 0.0};
+    uint8_t value_mask[] = {1, 0};
+    const void* col_data[] = {date_times, values};
+    const uint8_t* col_has_value[] = {nullptr, value_mask};
+    ASSERT_EQ(quiver_database_write_time_series(db,
+                                                "Collection",
+                                                "data",
+                                                ids,
+                                                col_names,
+                                                col_types,
+                                                col_data,
+                                                col_has_value,
+                                                2,
+                                                2,
+                                                QUIVER_TIME_SERIES_WRITE_APPEND),
+              QUIVER_OK);
+
+    ASSERT_EQ(quiver_database_read_time_series_group_all(db,
+                                                         "Collection",
+                                                         "data",
+                                                         &out_ids,
+                                                         &out_col_names,
+                                                         &out_col_types,
+                                                         &out_col_data,
+                                                         &out_col_has_value,
+                                                         &col_count,
+                                                         &row_count),
+              QUIVER_OK);
+    ASSERT_EQ(row_count, 2);
+    ASSERT_EQ(col_count, 2);
+    EXPECT_EQ(out_ids[0], element_ids[0]);
+    EXPECT_EQ(out_ids[1], element_ids[1]);
+    EXPECT_STREQ(out_col_names[0], "date_time");
+    EXPECT_EQ(out_col_types[0], QUIVER_DATA_TYPE_STRING);
+    EXPECT_STREQ(static_cast<char**>(out_col_data[0])[1], "2024-01-01T10:00:00");
+    EXPECT_STREQ(out_col_names[1], "value");
+    EXPECT_EQ(out_col_types[1], QUIVER_DATA_TYPE_FLOAT);
+    EXPECT_EQ(out_col_has_value[1][0], 0);
+    EXPECT_EQ(out_col_has_value[1][1], 1);
+    EXPECT_DOUBLE_EQ(static_cast<double*>(out_col_data[1])[1], 2.5);
+
+    EXPECT_EQ(quiver_database_free_integer_array(out_ids), QUIVER_OK);
+    EXPECT_EQ(quiver_database_free_time_series_data(
+                  out_col_names, out_col_types, out_col_data, out_col_has_value, col_count, row_count),
+              QUIVER_OK);
+    EXPECT_EQ(quiver_database_close(db), QUIVER_OK);
+}
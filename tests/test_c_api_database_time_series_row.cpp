@@ -1160,3 +1160,64 @@ TEST(DatabaseCApi, ReadTimeSeriesRowGroupNotFound) {
 
     quiver_database_close(db);
 }
+
+TEST(DatabaseCApi, ReadTimeSeriesRows) {
+    auto options = quiver::test::quiet_options();
+    quiver_database_t* db = nullptr;
+    ASSERT_EQ(quiver_database_from_schema(":memory:", VALID_SCHEMA("collections.sql").c_str(), &options, &db),
+              QUIVER_OK);
+
+    quiver_element_t* config = nullptr;
+    ASSERT_EQ(quiver_element_create(&config), QUIVER_OK);
+    quiver_element_set_string(config, "label", "Test Config");
+    int64_t tmp_id = 0;
+    quiver_database_create_element(db, "Configuration", config, &tmp_id);
+    quiver_element_destroy(config);
+
+    int64_t ids[2] = {0, 0};
+    for (int i = 0; i < 2; ++i) {
+        quiver_element_t* e = nullptr;
+        ASSERT_EQ(quiver_element_create(&e), QUIVER_OK);
+        quiver_element_set_string(e, "label", ("Item " + std::to_string(i + 1)).c_str());
+        quiver_database_create_element(db, "Collection", e, &ids[i]);
+        quiver_element_destroy(e);
+    }
+
+    const char* col_names[] = {"date_time", "value"};
+    int col_types[] = {QUIVER_DATA_TYPE_STRING, QUIVER_DATA_TYPE_FLOAT};
+    const char* dts[] = {"2024-01-01", "2024-01-03"};
+    double vals[] = {1.0, 3.0};
+    const void* data[] = {dts, vals};
+    ASSERT_EQ(quiver_database_update_time_series_group(
+                  db, "Collection", "data", ids[1], col_names, col_types, data, nullptr, 2, 2),
+              QUIVER_OK);
+
+    const char* date_times[] = {"2024-01-04", "2024-01-02", "2023-12-31"};
+    int out_type = 0;
+    void* out_values = nullptr;
+    size_t out_count = 0;
+    ASSERT_EQ(quiver_database_read_time_series_rows(
+                  db, "Collection", "data", "value", date_times, 3, &out_type, &out_values, &out_count),
+              QUIVER_OK);
+    EXPECT_EQ(out_type, QUIVER_DATA_TYPE_FLOAT);
+    ASSERT_EQ(out_count, 2);
+
+    // Element-major: the first element has no data, the second carries values forward
+    auto* floats = static_cast<double*>(out_values);
+    for (int t = 0; t < 3; ++t) {
+        EXPECT_TRUE(std::isnan(floats[t]));
+    }
+    EXPECT_DOUBLE_EQ(floats[3], 3.0);
+    EXPECT_DOUBLE_EQ(floats[4], 1.0);
+    EXPECT_TRUE(std::isnan(floats[5]));
+    quiver_database_free_float_array(floats);
+
+    EXPECT_EQ(quiver_database_read_time_series_rows(
+                  db, "Collection", "data", "value", nullptr, 2, &out_type, &out_values, &out_count),
+              QUIVER_ERROR);
+    EXPECT_EQ(quiver_database_read_time_series_rows(
+                  db, "Collection", "data", "missing", date_times, 3, &out_type, &out_values, &out_count),
+              QUIVER_ERROR);
+
+    quiver_database_close(db);
+}
@@ -0,0 +1,203 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/element.h>
+
+namespace {
+
+quiver::Database make_collections_db() {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+    return db;
+}
+
+int64_t create_item(quiver::Database& db, const std::string& label) {
+    quiver::Element element;
+    element.set("label", label).set("value_int", std::vector<int64_t>{1, 2});
+    return db.create_element("Collection", element);
+}
+
+const quiver::TableChanges* find_table(const quiver::ChangeBatch& batch, const std::string& table) {
+    for (const auto& changes : batch.tables) {
+        if (changes.table == table) {
+            return &changes;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST(DatabaseChanges, CommittedTransactionPublishesOneBatch) {
+    auto db = make_collections_db();
+    std::vector<quiver::ChangeBatch> received;
+    db.subscribe_changes([&received](const quiver::ChangeBatch& batch) { received.push_back(batch); });
+
+    db.begin_transaction();
+    const auto first = create_item(db, "Item 1");
+    const auto second = create_item(db, "Item 2");
+    quiver::Element update;
+    update.set("some_integer", int64_t{5});
+    db.update_element("Collection", first, update);
+    EXPECT_TRUE(received.empty());
+    db.commit();
+
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].sequence, 1);
+    const auto* collection = find_table(received[0], "Collection");
+    ASSERT_NE(collection, nullptr);
+    EXPECT_EQ(collection->collection, "Collection");
+    EXPECT_EQ(collection->created, (std::vector<int64_t>{first, second}));
+    EXPECT_TRUE(collection->updated.empty());
+    const auto* vectors = find_table(received[0], "Collection_vector_values");
+    ASSERT_NE(vectors, nullptr);
+    EXPECT_EQ(vectors->collection, "Collection");
+    EXPECT_EQ(vectors->updated, (std::vector<int64_t>{first, second}));
+
+    // Outside a transaction every write commits, and publishes, on its own.
+    db.update_time_series_group("Collection", "data", second, {{{"date_time", std::string("2024-01-01")}}});
+    db.delete_element("Collection", first);
+    ASSERT_EQ(received.size(), 3u);
+    EXPECT_EQ(received[1].sequence, 2);
+    EXPECT_EQ(find_table(received[1], "Collection_time_series_data")->updated, (std::vector<int64_t>{second}));
+    EXPECT_EQ(received[2].tables.size(), 1u);
+    EXPECT_EQ(find_table(received[2], "Collection")->deleted, (std::vector<int64_t>{first}));
+}
+
+TEST(DatabaseChanges, RollbackAndDryRunPublishNothing) {
+    auto db = make_collections_db();
+    int batches = 0;
+    db.subscribe_changes([&batches](const quiver::ChangeBatch&) { ++batches; });
+
+    db.begin_transaction();
+    create_item(db, "Rolled back");
+    db.rollback();
+
+    db.begin_dry_run();
+    create_item(db, "Dry run");
+    db.begin_transaction();
+    create_item(db, "Nested");
+    db.commit();
+    db.end_dry_run();
+
+    EXPECT_EQ(batches, 0);
+    EXPECT_TRUE(db.read_element_ids("Collection").empty());
+
+    // A failed write rolls back its own transaction.
+    quiver::Element duplicate;
+    duplicate.set("label", std::string("Test Config"));
+    EXPECT_THROW(db.create_element("Configuration", duplicate), std::runtime_error);
+    EXPECT_EQ(batches, 0);
+}
+
+TEST(DatabaseChanges, PollingSubscriptionQueuesNetChanges) {
+    auto db = make_collections_db();
+    const auto subscription = db.subscribe_changes();
+    EXPECT_TRUE(db.poll_changes(subscription).empty());
+
+    // Created and deleted within one transaction: nothing to report.
+    db.begin_transaction();
+    const auto transient = create_item(db, "Transient");
+    db.delete_element("Collection", transient);
+    db.commit();
+
+    const auto kept = create_item(db, "Kept");
+    db.query_integer("UPDATE Collection SET some_float = 1.5 WHERE id = ?", {kept});
+
+    const auto batches = db.poll_changes(subscription);
+    ASSERT_EQ(batches.size(), 2u);
+    EXPECT_EQ(batches[0].sequence, 1);
+    EXPECT_EQ(find_table(batches[0], "Collection")->created, (std::vector<int64_t>{kept}));
+    EXPECT_EQ(find_table(batches[1], "Collection")->updated, (std::vector<int64_t>{kept}));
+    EXPECT_TRUE(db.poll_changes(subscription).empty());
+
+    db.unsubscribe_changes(subscription);
+    create_item(db, "Unobserved");
+    EXPECT_THROW(db.poll_changes(subscription), std::runtime_error);
+    EXPECT_THROW(db.unsubscribe_changes(subscription), std::runtime_error);
+}
+
+TEST(DatabaseChanges, CallbackSubscriptionCannotBePolled) {
+    auto db = make_collections_db();
+    const auto subscription = db.subscribe_changes([](const quiver::ChangeBatch&) {});
+    EXPECT_THROW(db.poll_changes(subscription), std::runtime_error);
+}
+
+TEST(DatabaseChanges, ImportCsvPublishesDeletesAndNetUpdates) {
+    auto db = make_collections_db();
+    const auto dropped = create_item(db, "Item 1");
+    const auto kept = create_item(db, "Item 2");
+    const auto subscription = db.subscribe_changes();
+
+    // The import clears the collection with foreign keys off, which SQLite truncates without
+    // firing the update hook; labels it keeps are re-inserted under their old ids.
+    const auto path = std::filesystem::temp_directory_path() / "quiver_test_changes_import.csv";
+    {
+        std::ofstream csv(path, std::ios::binary);
+        csv << "label,some_integer,some_float\nItem 2,7,\nItem 3,,\n";
+    }
+    db.import_csv("Collection", "", path.string());
+    std::filesystem::remove(path);
+
+    const auto batches = db.poll_changes(subscription);
+    ASSERT_EQ(batches.size(), 1u);
+    const auto* collection = find_table(batches[0], "Collection");
+    ASSERT_NE(collection, nullptr);
+    EXPECT_EQ(collection->deleted, (std::vector<int64_t>{dropped}));
+    EXPECT_EQ(collection->updated, (std::vector<int64_t>{kept}));
+    const auto created = db.query_integer("SELECT id FROM Collection WHERE label = 'Item 3'");
+    ASSERT_TRUE(created.has_value());
+    EXPECT_EQ(collection->created, (std::vector<int64_t>{*created}));
+}
+
+TEST(DatabaseChanges, SavepointAfterLeadingCommentIsFollowed) {
+    auto db = make_collections_db();
+    const auto subscription = db.subscribe_changes();
+
+    db.begin_transaction();
+    const auto kept = create_item(db, "Kept");
+    db.query_integer("-- undone below\nSAVEPOINT step");
+    create_item(db, "Undone");
+    db.query_integer("/* back out */ ROLLBACK TO step");
+    db.commit();
+
+    const auto batches = db.poll_changes(subscription);
+    ASSERT_EQ(batches.size(), 1u);
+    const auto* collection = find_table(batches[0], "Collection");
+    ASSERT_NE(collection, nullptr);
+    EXPECT_EQ(collection->created, (std::vector<int64_t>{kept}));
+}
+
+TEST(DatabaseChanges, RollbackToSavepointDropsLaterChanges) {
+    auto db = make_collections_db();
+    const auto subscription = db.subscribe_changes();
+
+    db.begin_transaction();
+    const auto kept = create_item(db, "Kept");
+    db.query_integer("SAVEPOINT outer_step");
+    create_item(db, "Undone");
+    db.query_integer("SAVEPOINT inner_step");
+    db.delete_element("Collection", kept);
+    db.query_integer("ROLLBACK TO outer_step");
+    // outer_step stays open after ROLLBACK TO; what follows it is recorded again.
+    quiver::Element update;
+    update.set("some_integer", int64_t{3});
+    db.update_element("Collection", kept, update);
+    db.query_integer("RELEASE outer_step");
+    db.commit();
+
+    const auto batches = db.poll_changes(subscription);
+    ASSERT_EQ(batches.size(), 1u);
+    const auto* collection = find_table(batches[0], "Collection");
+    ASSERT_NE(collection, nullptr);
+    EXPECT_EQ(collection->created, (std::vector<int64_t>{kept}));
+    EXPECT_TRUE(collection->updated.empty());
+    EXPECT_TRUE(collection->deleted.empty());
+    EXPECT_EQ(db.read_element_ids("Collection"), (std::vector<int64_t>{kept}));
+}
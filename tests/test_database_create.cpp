@@ -1,6 +1,7 @@
 #include "test_utils.h"
 
 #include <algorithm>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <quiver/database.h>
 #include <quiver/element.h>
@@ -711,3 +712,247 @@ TEST(Database, CreateScalarTypeCoercionPolicy) {
     ASSERT_EQ(floats.size(), 1);
     EXPECT_DOUBLE_EQ(*floats[0], 7.0);
 }
+
+// ============================================================================
+// Batch create tests
+// ============================================================================
+
+TEST(Database, CreateElementsReturnsIdsInOrder) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+
+    std::vector<quiver::Element> elements;
+    for (int64_t i = 1; i <= 3; ++i) {
+        quiver::Element element;
+        element.set("label", std::string("Item ") + std::to_string(i))
+            .set("value_int", std::vector<int64_t>{i, i * 10})
+            .set("date_time", std::vector<std::string>{"2024-01-01T00:00:00"})
+            .set("value", std::vector<double>{i * 1.5});
+        elements.push_back(element);
+    }
+    // A different attribute set in the middle of the batch starts a new INSERT.
+    elements.insert(elements.begin() + 1,
+                    quiver::Element().set("label", std::string("Sparse")).set("some_integer", int64_t{7}));
+
+    auto ids = db.create_elements("Collection", elements);
+    EXPECT_EQ(ids, (std::vector<int64_t>{1, 2, 3, 4}));
+    EXPECT_EQ(db.read_element_ids("Collection"), ids);
+
+    auto labels = db.read_scalar_strings("Collection", "label");
+    ASSERT_EQ(labels.size(), 4);
+    EXPECT_EQ(labels[0], "Item 1");
+    EXPECT_EQ(labels[1], "Sparse");
+    EXPECT_EQ(labels[3], "Item 3");
+
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", ids[0]), (std::vector<int64_t>{1, 10}));
+    EXPECT_TRUE(db.read_vector_integers_by_id("Collection", "value_int", ids[1]).empty());
+    EXPECT_EQ(db.read_vector_integers_by_id("Collection", "value_int", ids[3]), (std::vector<int64_t>{3, 30}));
+
+    auto rows = db.read_time_series_group("Collection", "data", ids[2]);
+    ASSERT_EQ(rows.size(), 1);
+    EXPECT_DOUBLE_EQ(std::get<double>(rows[0].at("value")), 3.0);
+}
+
+TEST(Database, CreateElementsIdsFollowAutoincrementSequence) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    auto removed = db.create_element("Parent", quiver::Element().set("label", std::string("Parent 2")));
+    db.delete_element("Parent", removed);
+
+    // AUTOINCREMENT never reuses id 2, so the batch continues from the sequence, not MAX(id).
+    auto ids = db.create_elements("Parent",
+                                  {quiver::Element().set("label", std::string("Parent 3")),
+                                   quiver::Element().set("label", std::string("Parent 4"))});
+    EXPECT_EQ(ids, (std::vector<int64_t>{3, 4}));
+    EXPECT_EQ(db.read_element_ids("Parent"), (std::vector<int64_t>{1, 3, 4}));
+}
+
+TEST(Database, CreateElementsResolvesSharedFkLabels) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    db.create_element("Parent", quiver::Element().set("label", std::string("Parent 2")));
+
+    std::vector<quiver::Element> children;
+    for (int i = 0; i < 4; ++i) {
+        quiver::Element child;
+        child.set("label", std::string("Child ") + std::to_string(i))
+            .set("parent_id", std::string(i % 2 == 0 ? "Parent 1" : "Parent 2"))
+            .set("parent_ref", std::vector<std::string>{"Parent 2", "Parent 1"});
+        children.push_back(child);
+    }
+    auto ids = db.create_elements("Child", children);
+    ASSERT_EQ(ids.size(), 4);
+
+    auto parent_ids = db.read_scalar_integers("Child", "parent_id");
+    EXPECT_EQ(parent_ids, (std::vector<std::optional<int64_t>>{1, 2, 1, 2}));
+    EXPECT_EQ(db.read_vector_integers_by_id("Child", "parent_ref", ids[3]), (std::vector<int64_t>{2, 1}));
+}
+
+TEST(Database, CreateElementsValidatesBeforeWriting) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+
+    std::vector<quiver::Element> children = {
+        quiver::Element().set("label", std::string("Child 1")).set("parent_id", std::string("Parent 1")),
+        quiver::Element().set("label", std::string("Child 2")).set("parent_id", std::string("Missing")),
+    };
+
+    // Even inside a caller-owned transaction (where the internal guard cannot roll back), a bad
+    // element later in the batch leaves nothing behind.
+    db.begin_transaction();
+    EXPECT_THROW(db.create_elements("Child", children), std::runtime_error);
+    db.commit();
+    EXPECT_TRUE(db.read_element_ids("Child").empty());
+
+    EXPECT_THROW(db.create_elements("Child", {quiver::Element()}), std::runtime_error);
+    EXPECT_THROW(db.create_elements("Missing", children), std::runtime_error);
+    EXPECT_TRUE(db.create_elements("Child", {}).empty());
+}
+
+TEST(Database, CreateElementsSplitsAtParameterLimit) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    // Enough rows that one statement cannot bind them all (SQLite's default limit is 32766).
+    std::vector<quiver::Element> elements;
+    for (int64_t i = 0; i < 12000; ++i) {
+        elements.push_back(quiver::Element()
+                               .set("label", std::string("Config ") + std::to_string(i))
+                               .set("integer_attribute", i)
+                               .set("float_attribute", static_cast<double>(i)));
+    }
+    auto ids = db.create_elements("Configuration", elements);
+    ASSERT_EQ(ids.size(), elements.size());
+    EXPECT_EQ(ids.front(), 1);
+    EXPECT_EQ(ids.back(), 12000);
+    EXPECT_EQ(db.number_of_elements("Configuration"), 12000);
+    EXPECT_EQ(db.read_scalar_integer_by_id("Configuration", "integer_attribute", 12000), 11999);
+}
+
+// ============================================================================
+// Foreign-key label cache
+// ============================================================================
+
+TEST(Database, LabelCacheResolvesEachLabelOnce) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+    db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+
+    for (int i = 1; i <= 3; ++i) {
+        db.create_element("Child",
+                          quiver::Element()
+                              .set("label", "Child " + std::to_string(i))
+                              .set("parent_id", std::string("Parent 1"))
+                              .set("mentor_id", std::vector<std::string>{"Parent 1"}));
+    }
+
+    auto stats = db.label_cache_stats();
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits, 5);
+    EXPECT_EQ(stats.size, 1u);
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Child WHERE parent_id = 1"), 3);
+}
+
+TEST(Database, LabelCacheFollowsWritesToTheTarget) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+    auto parent_id = db.create_element("Parent", quiver::Element().set("label", std::string("Parent 1")));
+    db.create_element("Child",
+                      quiver::Element().set("label", std::string("Child 1")).set("parent_id", std::string("Parent 1")));
+
+    // A relabelled target must not resolve under its old label.
+    db.update_element("Parent", parent_id, quiver::Element().set("label", std::string("Renamed")));
+    EXPECT_THROW(db.create_element("Child",
+                                   quiver::Element()
+                                       .set("label", std::string("Child 2"))
+                                       .set("parent_id", std::string("Parent 1"))),
+                 std::runtime_error);
+    db.create_element("Child",
+                      quiver::Element().set("label", std::string("Child 2")).set("parent_id", std::string("Renamed")));
+    EXPECT_EQ(db.read_scalar_integer_by_id("Child", "parent_id", 2), parent_id);
+
+    // A deleted target neither.
+    db.delete_element("Parent", parent_id);
+    EXPECT_THROW(db.create_element("Child",
+                                   quiver::Element()
+                                       .set("label", std::string("Child 3"))
+                                       .set("parent_id", std::string("Renamed"))),
+                 std::runtime_error);
+}
+
+TEST(Database, LabelCacheDroppedOnRollback) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.begin_transaction();
+    db.create_element("Parent", quiver::Element().set("label", std::string("Temporary")));
+    db.create_element("Child",
+                      quiver::Element().set("label", std::string("Child 1")).set("parent_id", std::string("Temporary")));
+    db.rollback();
+
+    // The rolled-back id is handed out again; the cache must not map the old label onto it.
+    db.create_element("Parent", quiver::Element().set("label", std::string("Kept")));
+    EXPECT_THROW(db.create_element("Child",
+                                   quiver::Element()
+                                       .set("label", std::string("Child 1"))
+                                       .set("parent_id", std::string("Temporary"))),
+                 std::runtime_error);
+}
+
+TEST(Database, LabelCacheDroppedOnRollbackToSavepoint) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.begin_transaction();
+    db.query_integer("SAVEPOINT before_parent");
+    db.create_element("Parent", quiver::Element().set("label", std::string("Temporary")));
+    db.create_element("Child",
+                      quiver::Element().set("label", std::string("Child 1")).set("parent_id", std::string("Temporary")));
+    // Undoes both rows without firing the update or rollback hook.
+    db.query_integer("ROLLBACK TO SAVEPOINT before_parent");
+    db.commit();
+
+    db.create_element("Parent", quiver::Element().set("label", std::string("Kept")));
+    EXPECT_THROW(db.create_element("Child",
+                                   quiver::Element()
+                                       .set("label", std::string("Child 1"))
+                                       .set("parent_id", std::string("Temporary"))),
+                 std::runtime_error);
+}
+
+TEST(Database, LabelCacheFollowsCommitsFromOtherConnections) {
+    const auto path = (std::filesystem::temp_directory_path() / "quiver_label_cache_test.db").string();
+    std::filesystem::remove(path);
+    const quiver::DatabaseOptions options = {.read_only = false, .console_level = quiver::LogLevel::Off};
+    {
+        auto db = quiver::Database::from_schema(path, VALID_SCHEMA("relations.sql"), options);
+        auto p1 = db.create_element("Parent", quiver::Element().set("label", std::string("P1")));
+        auto p2 = db.create_element("Parent", quiver::Element().set("label", std::string("P2")));
+        db.create_element("Child",
+                          quiver::Element().set("label", std::string("Child 1")).set("parent_id", std::string("P1")));
+        EXPECT_EQ(db.read_scalar_integer_by_id("Child", "parent_id", 1), p1);
+
+        // Another connection swaps the labels: P1 is now the second parent.
+        {
+            quiver::Database other(path, options);
+            other.begin_transaction();
+            other.update_element("Parent", p1, quiver::Element().set("label", std::string("Swap")));
+            other.update_element("Parent", p2, quiver::Element().set("label", std::string("P1")));
+            other.update_element("Parent", p1, quiver::Element().set("label", std::string("P2")));
+            other.commit();
+        }
+
+        db.create_element("Child",
+                          quiver::Element().set("label", std::string("Child 2")).set("parent_id", std::string("P1")));
+        EXPECT_EQ(db.read_scalar_integer_by_id("Child", "parent_id", 2), p2);
+    }
+    std::filesystem::remove(path);
+}
@@ -1,8 +1,11 @@
 #include "test_utils.h"
 
 #include <gtest/gtest.h>
+#include <map>
 #include <quiver/database.h>
 #include <quiver/element.h>
+#include <string>
+#include <vector>
 
 TEST(Database, DeleteElementById) {
     auto db = quiver::Database::from_schema(
@@ -131,3 +134,92 @@ TEST(Database, DeleteElementByIdOtherElementsUnchanged) {
     EXPECT_TRUE(val3.has_value());
     EXPECT_EQ(*val3, 200);
 }
+
+namespace {
+
+quiver::Database bulk_delete_fixture() {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Test Config")));
+    for (int64_t i = 1; i <= 4; ++i) {
+        quiver::Element e;
+        e.set("label", "Item " + std::to_string(i))
+            .set("some_integer", i * 10)
+            .set("value_int", std::vector<int64_t>(static_cast<size_t>(i), i))
+            .set("tag", std::vector<std::string>{"a", "b"});
+        db.create_element("Collection", e);
+    }
+    return db;
+}
+
+}  // namespace
+
+TEST(Database, DeleteElementsReportsGroupRows) {
+    auto db = bulk_delete_fixture();
+
+    const std::vector<int64_t> ids{1, 3, 3};
+    const auto result = db.delete_elements("Collection", ids);
+    EXPECT_EQ(result.elements, 2);
+    EXPECT_EQ(result.group_rows, (std::map<std::string, int64_t>{{"Collection_set_tags", 4},
+                                                                  {"Collection_time_series_data", 0},
+                                                                  {"Collection_vector_values", 4}}));
+
+    EXPECT_EQ(db.read_element_ids("Collection"), (std::vector<int64_t>{2, 4}));
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_vector_values"), 6);
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Collection_set_tags"), 4);
+}
+
+TEST(Database, DeleteElementsUnknownIdDeletesNothing) {
+    auto db = bulk_delete_fixture();
+
+    const std::vector<int64_t> ids{2, 99, 42};
+    try {
+        db.delete_elements("Collection", ids);
+        FAIL() << "Expected std::runtime_error";
+    } catch (const std::runtime_error& e) {
+        EXPECT_STREQ(e.what(), "Element not found: 42 in collection 'Collection'");
+    }
+    EXPECT_EQ(db.read_element_ids("Collection").size(), 4u);
+
+    // The staged ids do not leak into the next call.
+    const std::vector<int64_t> one{4};
+    EXPECT_EQ(db.delete_elements("Collection", one).elements, 1);
+    EXPECT_EQ(db.read_element_ids("Collection"), (std::vector<int64_t>{1, 2, 3}));
+}
+
+TEST(Database, DeleteElementsEmptyAndUnknownCollection) {
+    auto db = bulk_delete_fixture();
+
+    const auto result = db.delete_elements("Collection", std::vector<int64_t>{});
+    EXPECT_EQ(result.elements, 0);
+    EXPECT_EQ(result.group_rows.at("Collection_vector_values"), 0);
+    EXPECT_EQ(db.read_element_ids("Collection").size(), 4u);
+
+    EXPECT_THROW(db.delete_elements("Missing", std::vector<int64_t>{1}), std::runtime_error);
+    EXPECT_THROW(db.delete_elements_where("Collection", ""), std::runtime_error);
+}
+
+TEST(Database, DeleteElementsWhere) {
+    auto db = bulk_delete_fixture();
+
+    const std::vector<quiver::Value> parameters{int64_t{20}, std::string("Item 3")};
+    auto result = db.delete_elements_where("Collection", "some_integer >= ? AND label <> ?", parameters);
+    EXPECT_EQ(result.elements, 2);
+    EXPECT_EQ(result.group_rows.at("Collection_vector_values"), 6);
+    EXPECT_EQ(db.read_element_ids("Collection"), (std::vector<int64_t>{1, 3}));
+
+    result = db.delete_elements_where("Collection", "some_integer > 1000");
+    EXPECT_EQ(result.elements, 0);
+    EXPECT_EQ(result.group_rows.at("Collection_set_tags"), 0);
+}
+
+TEST(Database, DeleteElementsJoinsCallerTransaction) {
+    auto db = bulk_delete_fixture();
+
+    db.begin_transaction();
+    EXPECT_EQ(db.delete_elements("Collection", std::vector<int64_t>{1, 2}).elements, 2);
+    EXPECT_THROW(db.delete_elements("Collection", std::vector<int64_t>{1}), std::runtime_error);
+    db.rollback();
+
+    EXPECT_EQ(db.read_element_ids("Collection").size(), 4u);
+}
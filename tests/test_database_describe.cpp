@@ -26,6 +26,7 @@ TEST(DatabaseDescribe, WholeDatabaseReport) {
     auto report = db.describe();
     EXPECT_TRUE(contains(report, "Database: :memory:"));
     EXPECT_TRUE(contains(report, "Version: 0"));
+    EXPECT_TRUE(contains(report, "Connection: journal_mode=memory, synchronous=full"));
     // Every collection appears, with element counts.
     EXPECT_TRUE(contains(report, "Collection: Configuration"));
     EXPECT_TRUE(contains(report, "Collection: Items (2 elements)"));
@@ -8,6 +8,8 @@
 #include <quiver/migrations.h>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -78,11 +80,279 @@ TEST_F(TempFileFixture, CreatesFileOnDisk) {
     EXPECT_TRUE(fs::exists(path));
 }
 
+TEST_F(TempFileFixture, FileLogModes) {
+    // A directory of its own: other tests share the temp directory's quiver_database.log.
+    const auto dir = fs::temp_directory_path() / "quiver_file_log_test";
+    fs::create_directories(dir);
+    const auto db_path = (dir / "test.db").string();
+    const auto log_path = dir / "quiver_database.log";
+
+    for (const auto mode : {quiver::FileLogMode::Off, quiver::FileLogMode::Sync, quiver::FileLogMode::Async}) {
+        fs::remove(log_path);
+        {
+            quiver::DatabaseOptions options;
+            options.console_level = quiver::LogLevel::Off;
+            options.file_log = mode;
+            quiver::Database db(db_path, options);
+            db.query_integer("SELECT 1");
+        }
+        EXPECT_EQ(fs::exists(log_path), mode != quiver::FileLogMode::Off);
+    }
+    // The async writer may still hold the log open for a moment.
+    std::error_code ignored;
+    fs::remove_all(dir, ignored);
+}
+
+TEST_F(TempFileFixture, DefaultProfileKeepsSqliteDefaults) {
+    quiver::Database db(path, {.read_only = false, .console_level = quiver::LogLevel::Off});
+    EXPECT_EQ(db.query_string("PRAGMA journal_mode"), "delete");
+    EXPECT_EQ(db.query_integer("PRAGMA synchronous"), 2);
+}
+
+TEST_F(TempFileFixture, BulkLoadProfile) {
+    quiver::DatabaseOptions options;
+    options.console_level = quiver::LogLevel::Off;
+    options.profile = quiver::ConnectionProfile::bulk_load();
+    quiver::Database db(path, options);
+    EXPECT_EQ(db.query_string("PRAGMA journal_mode"), "wal");
+    EXPECT_EQ(db.query_integer("PRAGMA synchronous"), 0);
+    EXPECT_EQ(db.query_integer("PRAGMA temp_store"), 2);
+    EXPECT_EQ(db.query_integer("PRAGMA cache_size"), -256 * 1024);
+}
+
+TEST_F(TempFileFixture, ProfileRejectsNegativeSizes) {
+    quiver::DatabaseOptions options;
+    options.console_level = quiver::LogLevel::Off;
+    options.profile.cache_size_kib = -1;
+    EXPECT_THROW(quiver::Database(path, options), std::runtime_error);
+}
+
 TEST_F(TempFileFixture, CurrentVersion) {
     quiver::Database db(":memory:", {.read_only = false, .console_level = quiver::LogLevel::Off});
     EXPECT_EQ(db.current_version(), 0);
 }
 
+// ============================================================================
+// In-memory working copy
+// ============================================================================
+
+TEST_F(TempFileFixture, OpenInMemoryCopyAndSave) {
+    const quiver::DatabaseOptions options{.read_only = false, .console_level = quiver::LogLevel::Off};
+    {
+        auto db = quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), options);
+        quiver::Element config;
+        config.set("label", std::string("Config")).set("integer_attribute", int64_t{7});
+        db.create_element("Configuration", config);
+    }
+
+    auto copy = quiver::Database::open_in_memory_copy(path, options);
+    EXPECT_EQ(copy.path(), ":memory:");
+    EXPECT_EQ(copy.read_scalar_integers("Configuration", "integer_attribute"),
+              (std::vector<std::optional<int64_t>>{7}));
+
+    // Writes stay in memory until saved.
+    quiver::Element second;
+    second.set("label", std::string("Second")).set("integer_attribute", int64_t{8});
+    copy.create_element("Configuration", second);
+    EXPECT_EQ(quiver::Database(path, options).read_element_ids("Configuration").size(), 1u);
+
+    const auto saved = path + ".saved";
+    copy.save_to(saved);
+    EXPECT_FALSE(fs::exists(saved + ".tmp"));
+    EXPECT_EQ(quiver::Database(saved, options).read_element_ids("Configuration").size(), 2u);
+
+    // Saving over the original replaces it.
+    copy.save_to(path);
+    EXPECT_EQ(quiver::Database(path, options).read_element_ids("Configuration").size(), 2u);
+
+    copy.begin_transaction();
+    EXPECT_THROW(copy.save_to(saved), std::runtime_error);
+    copy.rollback();
+    fs::remove(saved);
+
+    auto read_only =
+        quiver::Database::open_in_memory_copy(path, {.read_only = true, .console_level = quiver::LogLevel::Off});
+    EXPECT_THROW(read_only.create_element("Configuration", second), std::runtime_error);
+
+    EXPECT_THROW(quiver::Database::open_in_memory_copy(path + ".missing", options), std::runtime_error);
+}
+
+// ============================================================================
+// Immutable open
+// ============================================================================
+
+TEST_F(TempFileFixture, OpenImmutable) {
+    // '#' and '%' would otherwise be read as URI syntax.
+    const auto archived = (fs::temp_directory_path() / "quiver_test #1 100%.db").string();
+    {
+        auto db = quiver::Database::from_schema(
+            archived, VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+        quiver::Element config;
+        config.set("label", std::string("Config")).set("integer_attribute", int64_t{7});
+        db.create_element("Configuration", config);
+    }
+
+    quiver::DatabaseOptions options;
+    options.console_level = quiver::LogLevel::Off;
+    options.immutable = true;
+    {
+        quiver::Database db(archived, options);
+        EXPECT_EQ(db.read_scalar_integers("Configuration", "integer_attribute"),
+                  (std::vector<std::optional<int64_t>>{7}));
+        EXPECT_EQ(db.query_integer("PRAGMA mmap_size"), static_cast<int64_t>(fs::file_size(archived)));
+
+        quiver::Element config;
+        config.set("label", std::string("Second"));
+        try {
+            db.create_element("Configuration", config);
+            FAIL() << "create_element should have thrown";
+        } catch (const std::runtime_error& e) {
+            EXPECT_STREQ(e.what(), "Cannot create_element: database is immutable");
+        }
+        EXPECT_THROW(db.update_element("Configuration", 1, config), std::runtime_error);
+        EXPECT_THROW(db.delete_element("Configuration", 1), std::runtime_error);
+        EXPECT_THROW(db.delete_elements_where("Configuration", "1"), std::runtime_error);
+        EXPECT_THROW(db.ensure_indexes(), std::runtime_error);
+        EXPECT_EQ(db.read_element_ids("Configuration"), (std::vector<int64_t>{1}));
+    }
+    fs::remove(archived);
+
+    EXPECT_THROW(quiver::Database(":memory:", options), std::runtime_error);
+    EXPECT_THROW(quiver::Database(path, options), std::runtime_error);  // no such file
+    EXPECT_THROW(quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), options), std::runtime_error);
+}
+
+TEST_F(TempFileFixture, OpenImmutableRelativePath) {
+    // A relative path is made absolute for the URI; its '#' and '%' still need escaping there.
+    const auto previous = fs::current_path();
+    fs::current_path(fs::temp_directory_path());
+    const std::string relative = "quiver_test relative #2 50%.db";
+    {
+        auto db = quiver::Database::from_schema(
+            relative, VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+        quiver::Element config;
+        config.set("label", std::string("Config"));
+        db.create_element("Configuration", config);
+    }
+
+    quiver::DatabaseOptions options;
+    options.console_level = quiver::LogLevel::Off;
+    options.immutable = true;
+    {
+        quiver::Database db(relative, options);
+        EXPECT_EQ(db.read_element_ids("Configuration"), (std::vector<int64_t>{1}));
+    }
+    fs::remove(relative);
+    fs::current_path(previous);
+}
+
+TEST_F(TempFileFixture, ImmutableSharedAcrossThreads) {
+    {
+        auto db = quiver::Database::from_schema(
+            path, VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+        for (int i = 1; i <= 10; ++i) {
+            quiver::Element config;
+            config.set("label", "Config " + std::to_string(i)).set("integer_attribute", int64_t{i});
+            db.create_element("Configuration", config);
+        }
+    }
+
+    quiver::DatabaseOptions options;
+    options.console_level = quiver::LogLevel::Off;
+    options.immutable = true;
+    quiver::Database db(path, options);
+    db.enable_stats();
+
+    std::vector<int64_t> sums(8, 0);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < sums.size(); ++t) {
+        workers.emplace_back([&db, &sums, t] {
+            for (int round = 0; round < 20; ++round) {
+                for (const auto& value : db.read_scalar_integers("Configuration", "integer_attribute")) {
+                    sums[t] += value.value_or(0);
+                }
+                auto rows = db.cursor("SELECT integer_attribute FROM Configuration WHERE id <= ?", {int64_t{2}});
+                while (rows.next()) {
+                    sums[t] += rows.get_integer(0).value_or(0);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (auto sum : sums) {
+        EXPECT_EQ(sum, 20 * (55 + 3));
+    }
+}
+
+TEST_F(TempFileFixture, ImmutableStatsAlongsideReads) {
+    {
+        auto db = quiver::Database::from_schema(
+            path, VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+        quiver::Element config;
+        config.set("label", std::string("Config")).set("integer_attribute", int64_t{1});
+        db.create_element("Configuration", config);
+    }
+
+    quiver::DatabaseOptions options;
+    options.console_level = quiver::LogLevel::Off;
+    options.immutable = true;
+    options.trace.enabled = true;
+    options.trace.ring_capacity = 16;
+    quiver::Database db(path, options);
+    db.enable_stats();
+    const auto subscription = db.subscribe_changes();
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&db] {
+            for (int round = 0; round < 50; ++round) {
+                db.read_scalar_integers("Configuration", "integer_attribute");
+                db.read_element_ids("Configuration");
+            }
+        });
+    }
+    // Accessors that are not operations themselves, racing the readers' counters and caches.
+    for (int round = 0; round < 50; ++round) {
+        db.stats();
+        db.statement_cache_stats();
+        db.label_cache_stats();
+        db.traced_statements();
+        EXPECT_TRUE(db.poll_changes(subscription).empty());
+        if (round % 10 == 9) {
+            db.reset_stats();
+        }
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    db.unsubscribe_changes(subscription);
+
+    db.reset_stats();
+    db.read_element_ids("Configuration");
+    const auto stats = db.stats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].operation, "read_element_ids");
+    EXPECT_EQ(db.traced_statements().size(), 16u);
+}
+
+TEST_F(TempFileFixture, ImmutableInMemoryCopy) {
+    {
+        auto db = quiver::Database::from_schema(
+            path, VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+    }
+    quiver::DatabaseOptions options;
+    options.console_level = quiver::LogLevel::Off;
+    options.immutable = true;
+    auto copy = quiver::Database::open_in_memory_copy(path, options);
+    quiver::Element config;
+    config.set("label", std::string("Config"));
+    EXPECT_THROW(copy.create_element("Configuration", config), std::runtime_error);
+    EXPECT_TRUE(copy.read_element_ids("Configuration").empty());
+}
+
 // ============================================================================
 // Schema error tests
 // ============================================================================
@@ -0,0 +1,132 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/database_pool.h>
+#include <quiver/element.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const quiver::DatabaseOptions kQuiet = {.read_only = false, .console_level = quiver::LogLevel::Off};
+
+}  // namespace
+
+class DatabasePoolFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = (fs::temp_directory_path() / "quiver_pool_test.db").string();
+        remove_files();
+        auto db = quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), kQuiet);
+        for (int i = 1; i <= 3; ++i) {
+            quiver::Element element;
+            element.set("label", "Config " + std::to_string(i)).set("integer_attribute", int64_t{i * 10});
+            db.create_element("Configuration", element);
+        }
+    }
+    void TearDown() override { remove_files(); }
+
+    void remove_files() {
+        for (const auto* suffix : {"", "-wal", "-shm"}) {
+            if (fs::exists(path + suffix))
+                fs::remove(path + suffix);
+        }
+    }
+
+    std::string path;
+};
+
+TEST_F(DatabasePoolFixture, ReadersShareTheFile) {
+    quiver::DatabasePool pool(path, 2, kQuiet);
+    EXPECT_EQ(pool.size(), 2u);
+    EXPECT_EQ(pool.available(), 2u);
+    EXPECT_EQ(pool.path(), path);
+
+    auto lease = pool.acquire();
+    EXPECT_EQ(pool.available(), 1u);
+    auto values = lease->read_scalar_integers("Configuration", "integer_attribute");
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_EQ(values[2], 30);
+    EXPECT_EQ(lease->get_scalar_metadata("Configuration", "label").data_type, quiver::DataType::Text);
+}
+
+TEST_F(DatabasePoolFixture, SwitchesFileToWal) {
+    quiver::DatabasePool pool(path, 1, kQuiet);
+    EXPECT_EQ(pool.acquire()->query_string("PRAGMA journal_mode"), "wal");
+}
+
+TEST_F(DatabasePoolFixture, ReadOnlyOptionLeavesJournalMode) {
+    quiver::DatabasePool pool(path, 1, {.read_only = true, .console_level = quiver::LogLevel::Off});
+    EXPECT_EQ(pool.acquire()->query_string("PRAGMA journal_mode"), "delete");
+}
+
+TEST_F(DatabasePoolFixture, ImmutableReaders) {
+    quiver::DatabaseOptions options = kQuiet;
+    options.immutable = true;
+    quiver::DatabasePool pool(path, 2, options);
+    auto lease = pool.acquire();
+    EXPECT_EQ(lease->query_string("PRAGMA journal_mode"), "delete");
+    EXPECT_EQ(lease->read_element_ids("Configuration"), (std::vector<int64_t>{1, 2, 3}));
+
+    quiver::Element element;
+    element.set("label", std::string("Config 4"));
+    EXPECT_THROW(lease->create_element("Configuration", element), std::runtime_error);
+}
+
+TEST_F(DatabasePoolFixture, ReadersAreReadOnly) {
+    quiver::DatabasePool pool(path, 1, kQuiet);
+    auto lease = pool.acquire();
+    quiver::Element element;
+    element.set("label", std::string("Config 4"));
+    EXPECT_THROW(lease->create_element("Configuration", element), std::runtime_error);
+}
+
+TEST_F(DatabasePoolFixture, LeaseReturnsReaderOnDestruction) {
+    quiver::DatabasePool pool(path, 1, kQuiet);
+    {
+        auto lease = pool.acquire();
+        EXPECT_EQ(pool.available(), 0u);
+        EXPECT_FALSE(pool.try_acquire().has_value());
+
+        auto moved = std::move(lease);
+        EXPECT_EQ(pool.available(), 0u);
+    }
+    EXPECT_EQ(pool.available(), 1u);
+    EXPECT_TRUE(pool.try_acquire().has_value());
+    EXPECT_EQ(pool.available(), 1u);
+}
+
+TEST_F(DatabasePoolFixture, ConcurrentReaders) {
+    quiver::DatabasePool pool(path, 4, kQuiet);
+
+    std::vector<int64_t> sums(8, 0);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < sums.size(); ++t) {
+        workers.emplace_back([&pool, &sums, t] {
+            for (int round = 0; round < 20; ++round) {
+                auto lease = pool.acquire();
+                for (const auto& value : lease->read_scalar_integers("Configuration", "integer_attribute")) {
+                    sums[t] += value.value_or(0);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (auto sum : sums) {
+        EXPECT_EQ(sum, 20 * 60);
+    }
+    EXPECT_EQ(pool.available(), 4u);
+}
+
+TEST_F(DatabasePoolFixture, RejectsInMemoryAndZeroReaders) {
+    EXPECT_THROW(quiver::DatabasePool(":memory:", 2, kQuiet), std::runtime_error);
+    EXPECT_THROW(quiver::DatabasePool(path, 0, kQuiet), std::runtime_error);
+}
@@ -317,3 +317,245 @@ TEST(Database, ReadFloatsWidenIntegerValuesInRealColumns) {
 
     EXPECT_EQ(db.read_vector_floats_by_id("Collection", "value_float", id), (std::vector<double>{1.0, 2.0}));
 }
+
+// ============================================================================
+// Prepared-statement cache tests
+// ============================================================================
+
+TEST(DatabaseQuery, StatementCacheReusesStatementsForRepeatedSql) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    for (int i = 0; i < 10; ++i) {
+        db.create_element("Configuration",
+                          quiver::Element()
+                              .set("label", std::string("Config ") + std::to_string(i))
+                              .set("integer_attribute", int64_t{i}));
+    }
+
+    auto before = db.statement_cache_stats();
+    for (int64_t id = 1; id <= 10; ++id) {
+        auto value = db.read_scalar_integer_by_id("Configuration", "integer_attribute", id);
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(*value, id - 1);
+    }
+    auto after = db.statement_cache_stats();
+
+    // One SQL text, ten calls: prepared at most once, every other call a hit with fresh bindings.
+    EXPECT_LE(after.misses - before.misses, 1);
+    EXPECT_GE(after.hits - before.hits, 9);
+    EXPECT_LE(after.size, after.capacity);
+}
+
+TEST(DatabaseQuery, StatementCacheIsBounded) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    const auto capacity = db.statement_cache_stats().capacity;
+    for (size_t i = 0; i < capacity + 10; ++i) {
+        EXPECT_EQ(db.query_integer("SELECT " + std::to_string(i)), static_cast<int64_t>(i));
+    }
+    EXPECT_EQ(db.statement_cache_stats().size, capacity);
+}
+
+TEST(DatabaseQuery, StatementCacheRecoversAfterFailedStep) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Config")));
+
+    // The UNIQUE violation fails mid-step; the statement must go back reset, not stuck.
+    const std::string insert = "INSERT INTO Configuration (label) VALUES (?)";
+    EXPECT_THROW(db.query_integer(insert, {std::string("Config")}), std::runtime_error);
+    EXPECT_NO_THROW(db.query_integer(insert, {std::string("Other")}));
+
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Configuration"), 2);
+}
+
+TEST(DatabaseQuery, StatementCacheSeesSchemaChanges) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.query_integer("CREATE TABLE Scratch (x INTEGER)");
+    db.query_integer("INSERT INTO Scratch (x) VALUES (1)");
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Scratch"), 1);
+
+    // The cached SELECT was compiled before this DDL; it must still see the new table.
+    db.query_integer("DROP TABLE Scratch");
+    db.query_integer("CREATE TABLE Scratch (x INTEGER, y INTEGER)");
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM Scratch"), 0);
+}
+
+// ============================================================================
+// Cursor tests
+// ============================================================================
+
+TEST(DatabaseQuery, CursorStepsRowsInOrder) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    for (int i = 0; i < 3; ++i) {
+        db.create_element("Configuration",
+                          quiver::Element()
+                              .set("label", std::string("Config ") + std::to_string(i))
+                              .set("integer_attribute", int64_t{i * 10}));
+    }
+
+    auto cursor =
+        db.cursor("SELECT label, integer_attribute FROM Configuration WHERE id >= ? ORDER BY id", {int64_t{2}});
+    ASSERT_EQ(cursor.column_count(), 2);
+    EXPECT_EQ(cursor.columns()[0], "label");
+    EXPECT_EQ(cursor.columns()[1], "integer_attribute");
+
+    ASSERT_TRUE(cursor.next());
+    EXPECT_EQ(cursor.get_string(0), "Config 1");
+    EXPECT_EQ(cursor.get_integer(1), 10);
+    ASSERT_TRUE(cursor.next());
+    EXPECT_EQ(cursor.get_string(0), "Config 2");
+    EXPECT_EQ(cursor.get_value(1), quiver::Value{int64_t{20}});
+    EXPECT_FALSE(cursor.next());
+    EXPECT_FALSE(cursor.next());
+}
+
+TEST(DatabaseQuery, CursorTypedGettersFollowRowPolicy) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    auto cursor = db.cursor("SELECT NULL, 42, 'text'");
+    ASSERT_TRUE(cursor.next());
+
+    EXPECT_TRUE(cursor.is_null(0));
+    EXPECT_FALSE(cursor.get_integer(0).has_value());
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(cursor.get_value(0)));
+
+    // INTEGER widens to float, like Row::get_float; it is never read as a string.
+    EXPECT_EQ(cursor.get_float(1), 42.0);
+    EXPECT_FALSE(cursor.get_string(1).has_value());
+
+    EXPECT_EQ(cursor.get_string(2), "text");
+    EXPECT_FALSE(cursor.get_integer(2).has_value());
+}
+
+TEST(DatabaseQuery, CursorRejectsReadsWithoutCurrentRow) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    auto cursor = db.cursor("SELECT 1");
+    EXPECT_THROW(cursor.get_integer(0), std::runtime_error);
+    ASSERT_TRUE(cursor.next());
+    EXPECT_THROW(cursor.get_integer(1), std::runtime_error);
+    EXPECT_FALSE(cursor.next());
+    EXPECT_THROW(cursor.get_integer(0), std::runtime_error);
+}
+
+TEST(DatabaseQuery, CursorRejectsParameterCountMismatch) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    EXPECT_THROW(db.cursor("SELECT ?"), std::runtime_error);
+    EXPECT_THROW(db.cursor("SELECT 1", {int64_t{1}}), std::runtime_error);
+}
+
+TEST(DatabaseQuery, CursorAbandonedEarlyReturnsStatementToCache) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    for (int i = 0; i < 3; ++i) {
+        db.create_element("Configuration", quiver::Element().set("label", std::string("Config ") + std::to_string(i)));
+    }
+
+    const std::string sql = "SELECT id FROM Configuration ORDER BY id";
+    {
+        auto cursor = db.cursor(sql);
+        ASSERT_TRUE(cursor.next());
+    }
+
+    // The half-stepped statement went back reset: the next cursor starts from the first row, and
+    // writes are not blocked by a lingering read.
+    auto before = db.statement_cache_stats();
+    auto cursor = db.cursor(sql);
+    EXPECT_EQ(db.statement_cache_stats().hits, before.hits + 1);
+    ASSERT_TRUE(cursor.next());
+    EXPECT_EQ(cursor.get_integer(0), 1);
+
+    EXPECT_NO_THROW(db.create_element("Configuration", quiver::Element().set("label", std::string("Config 3"))));
+}
+
+TEST(DatabaseQuery, CursorIsMovable) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    auto first = db.cursor("SELECT 1 UNION ALL SELECT 2");
+    ASSERT_TRUE(first.next());
+    auto second = std::move(first);
+    EXPECT_EQ(second.get_integer(0), 1);
+    ASSERT_TRUE(second.next());
+    EXPECT_EQ(second.get_integer(0), 2);
+}
+
+TEST(DatabaseQuery, TextParametersAreTrimmed) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    EXPECT_EQ(db.query_string("SELECT ?", {std::string("  padded\t\n")}), "padded");
+    // All-whitespace trims to '', not NULL.
+    EXPECT_EQ(db.query_integer("SELECT length(?)", {std::string(" \r\n ")}), 0);
+
+    db.create_element("Configuration", quiver::Element().set("label", std::string("  Config 1  ")));
+    EXPECT_EQ(db.read_scalar_strings("Configuration", "label")[0], "Config 1");
+}
+
+TEST(DatabaseQuery, CursorOwnsItsTextParameters) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    // The braced parameter list is gone before the first step; the cursor must not read it.
+    auto cursor = db.cursor("SELECT ? || '!'", {std::string(64, 'x')});
+    ASSERT_TRUE(cursor.next());
+    EXPECT_EQ(cursor.get_string(0), std::string(64, 'x') + "!");
+}
+
+// ============================================================================
+// Query table tests
+// ============================================================================
+
+TEST(DatabaseQuery, QueryTableReturnsTypedColumns) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.create_element("Configuration",
+                      quiver::Element().set("label", std::string("A")).set("float_attribute", 1.5));
+    db.create_element("Configuration", quiver::Element().set("label", std::string("B")));
+
+    auto table = db.query_table(
+        "SELECT id, label, float_attribute, string_attribute FROM Configuration WHERE id >= ? ORDER BY id",
+        {int64_t{1}});
+    ASSERT_EQ(table.row_count, 2u);
+    ASSERT_EQ(table.columns.size(), 4u);
+    EXPECT_EQ(table.columns[0].name, "id");
+    EXPECT_EQ(std::get<std::vector<int64_t>>(table.columns[0].values), (std::vector<int64_t>{1, 2}));
+    EXPECT_EQ(std::get<std::vector<std::string>>(table.columns[1].values), (std::vector<std::string>{"A", "B"}));
+    EXPECT_EQ(std::get<std::vector<double>>(table.columns[2].values), (std::vector<double>{1.5, 0.0}));
+    EXPECT_EQ(table.columns[2].valid, (std::vector<uint8_t>{1, 0}));
+    // All NULL: typed from the declared column type.
+    EXPECT_EQ(std::get<std::vector<std::string>>(table.columns[3].values).size(), 2u);
+    EXPECT_EQ(table.columns[3].valid, (std::vector<uint8_t>{0, 0}));
+}
+
+TEST(DatabaseQuery, QueryTableInfersExpressionTypes) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    auto table = db.query_table("SELECT NULL AS x UNION ALL SELECT 2 UNION ALL SELECT 2.5 UNION ALL SELECT NULL");
+    ASSERT_EQ(table.row_count, 4u);
+    EXPECT_EQ(std::get<std::vector<double>>(table.columns[0].values), (std::vector<double>{0.0, 2.0, 2.5, 0.0}));
+    EXPECT_EQ(table.columns[0].valid, (std::vector<uint8_t>{0, 1, 1, 0}));
+
+    auto empty = db.query_table("SELECT id, label FROM Configuration");
+    EXPECT_EQ(empty.row_count, 0u);
+    ASSERT_EQ(empty.columns.size(), 2u);
+    EXPECT_EQ(empty.columns[1].name, "label");
+
+    EXPECT_THROW(db.query_table("SELECT 1 UNION ALL SELECT 'a'"), std::runtime_error);
+    EXPECT_THROW(db.query_table("SELECT x'00'"), std::runtime_error);
+}
@@ -2,6 +2,7 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <limits>
 #include <quiver/database.h>
 #include <quiver/element.h>
 
@@ -168,6 +169,52 @@ TEST(Database, ReadScalarFloatsAllNull) {
     EXPECT_FALSE(values[1].has_value());
 }
 
+TEST(Database, ReadScalarIntegersColumn) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.create_element("Configuration",
+                      quiver::Element().set("label", std::string("Config 1")).set("integer_attribute", int64_t{42}));
+    db.create_element("Configuration",
+                      quiver::Element().set("label", std::string("Config 2")).set_null("integer_attribute"));
+    db.create_element("Configuration",
+                      quiver::Element().set("label", std::string("Config 3")).set("integer_attribute", int64_t{7}));
+
+    auto column = db.read_scalar_integers_column("Configuration", "integer_attribute");
+    EXPECT_EQ(column.values, (std::vector<int64_t>{42, 0, 7}));
+    EXPECT_EQ(column.valid, (std::vector<uint8_t>{1, 0, 1}));
+}
+
+TEST(Database, ReadScalarFloatsColumnMatchesOptionalReader) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    db.create_element("Configuration",
+                      quiver::Element().set("label", std::string("Config 1")).set("float_attribute", 1.5));
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Config 2")));
+    db.create_element("Configuration",
+                      quiver::Element().set("label", std::string("Config 3")).set("float_attribute", int64_t{3}));
+
+    auto column = db.read_scalar_floats_column("Configuration", "float_attribute");
+    auto values = db.read_scalar_floats("Configuration", "float_attribute");
+    ASSERT_EQ(column.values.size(), values.size());
+    ASSERT_EQ(column.valid.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(column.valid[i] != 0, values[i].has_value()) << "index " << i;
+        EXPECT_DOUBLE_EQ(column.values[i], values[i].value_or(0.0)) << "index " << i;
+    }
+}
+
+TEST(Database, ReadScalarColumnEmpty) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    auto column = db.read_scalar_integers_column("Configuration", "integer_attribute");
+    EXPECT_TRUE(column.values.empty());
+    EXPECT_TRUE(column.valid.empty());
+    EXPECT_THROW(db.read_scalar_floats_column("Configuration", "nonexistent_attribute"), std::runtime_error);
+}
+
 // ============================================================================
 // Read scalar by ID tests
 // ============================================================================
@@ -411,6 +458,58 @@ TEST(Database, ReadElementIdsInvalidCollection) {
     EXPECT_THROW(db.read_element_ids("NonexistentCollection"), std::runtime_error);
 }
 
+TEST(Database, ReadScalarsByIdsFollowInputOrder) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    quiver::Element e1;
+    e1.set("label", std::string("Config 1")).set("integer_attribute", int64_t{42}).set("float_attribute", 1.5);
+    int64_t id1 = db.create_element("Configuration", e1);
+
+    quiver::Element e2;
+    e2.set("label", std::string("Config 2")).set("integer_attribute", int64_t{100});
+    int64_t id2 = db.create_element("Configuration", e2);
+
+    const std::vector<int64_t> ids{id2, 999, id1, id2};
+    auto integers = db.read_scalar_integers_by_ids("Configuration", "integer_attribute", ids);
+    EXPECT_EQ(integers.values, (std::vector<int64_t>{100, 0, 42, 100}));
+    EXPECT_EQ(integers.valid, (std::vector<uint8_t>{1, 0, 1, 1}));
+
+    auto floats = db.read_scalar_floats_by_ids("Configuration", "float_attribute", ids);
+    EXPECT_EQ(floats.values, (std::vector<double>{0.0, 0.0, 1.5, 0.0}));
+    EXPECT_EQ(floats.valid, (std::vector<uint8_t>{0, 0, 1, 0}));
+
+    auto labels = db.read_scalar_strings_by_ids("Configuration", "label", ids);
+    ASSERT_EQ(labels.size(), 4u);
+    EXPECT_EQ(labels[0], "Config 2");
+    EXPECT_FALSE(labels[1].has_value());
+    EXPECT_EQ(labels[2], "Config 1");
+
+    EXPECT_TRUE(db.read_scalar_integers_by_ids("Configuration", "integer_attribute", {}).values.empty());
+    EXPECT_THROW(db.read_scalar_integers_by_ids("Configuration", "missing", ids), std::runtime_error);
+}
+
+TEST(Database, ArrayParameterExpandsInQuery) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    for (int i = 1; i <= 4; ++i) {
+        quiver::Element e;
+        e.set("label", "Config " + std::to_string(i)).set("integer_attribute", int64_t{i * 10});
+        db.create_element("Configuration", e);
+    }
+
+    const std::vector<int64_t> ids{1, 3, 4};
+    EXPECT_EQ(db.query_integer("SELECT SUM(integer_attribute) FROM Configuration WHERE id IN "
+                               "(SELECT value FROM json_each(?))",
+                               {quiver::array_parameter(ids)}),
+              80);
+    const std::vector<double> weights{0.5, 0.25};
+    EXPECT_EQ(db.query_float("SELECT SUM(value) FROM json_each(?)", {quiver::array_parameter(weights)}), 0.75);
+    const std::vector<double> bad{1.0, std::numeric_limits<double>::quiet_NaN()};
+    EXPECT_THROW(quiver::array_parameter(bad), std::runtime_error);
+}
+
 TEST(Database, ReadScalarIntegerByIdInvalidCollection) {
     auto db = quiver::Database::from_schema(
         ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
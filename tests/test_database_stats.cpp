@@ -0,0 +1,152 @@
+#include "test_utils.h"
+
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/element.h>
+
+namespace {
+
+quiver::Database make_basic_db() {
+    return quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("basic.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+}
+
+const quiver::OperationStats* find_operation(const std::vector<quiver::OperationStats>& stats,
+                                             const std::string& operation) {
+    for (const auto& op : stats) {
+        if (op.operation == operation) {
+            return &op;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST(DatabaseStats, DisabledByDefault) {
+    auto db = make_basic_db();
+    EXPECT_FALSE(db.stats_enabled());
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Config 1")));
+    EXPECT_TRUE(db.stats().empty());
+}
+
+TEST(DatabaseStats, RecordsOutermostOperations) {
+    auto db = make_basic_db();
+    db.enable_stats();
+
+    for (int i = 0; i < 3; ++i) {
+        db.create_element("Configuration",
+                          quiver::Element()
+                              .set("label", "Config " + std::to_string(i))
+                              .set("integer_attribute", int64_t{i}));
+    }
+    const auto values = db.read_scalar_integers("Configuration", "integer_attribute");
+    ASSERT_EQ(values.size(), 3u);
+
+    const auto stats = db.stats();
+    // create_element's own statements are charged to it, not listed as execute.
+    EXPECT_EQ(find_operation(stats, "execute"), nullptr);
+
+    const auto* create = find_operation(stats, "create_element");
+    ASSERT_NE(create, nullptr);
+    EXPECT_EQ(create->calls, 3);
+    EXPECT_EQ(create->rows_written, 3);
+    EXPECT_GE(create->statements_prepared, 1);
+    EXPECT_GE(create->statements_reused, 2);
+    EXPECT_GT(create->bytes_bound, 0);
+    EXPECT_GT(create->total_ns, 0);
+    EXPECT_LE(create->p50_ns, create->p99_ns);
+
+    const auto* read = find_operation(stats, "read_scalar_integers");
+    ASSERT_NE(read, nullptr);
+    EXPECT_EQ(read->calls, 1);
+    EXPECT_EQ(read->rows_read, 3);
+    EXPECT_EQ(read->rows_written, 0);
+    EXPECT_EQ(read->p50_ns, read->total_ns);
+}
+
+TEST(DatabaseStats, DisableKeepsAndResetClears) {
+    auto db = make_basic_db();
+    db.enable_stats();
+    db.query_integer("SELECT 1");
+    db.enable_stats(false);
+    db.query_integer("SELECT 1");
+
+    auto stats = db.stats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].operation, "query_integer");
+    EXPECT_EQ(stats[0].calls, 1);
+
+    db.reset_stats();
+    EXPECT_TRUE(db.stats().empty());
+}
+
+namespace {
+
+quiver::Database make_traced_db(quiver::SqlTraceOptions trace) {
+    trace.enabled = true;
+    auto db = quiver::Database::from_schema(
+        ":memory:",
+        VALID_SCHEMA("basic.sql"),
+        {.read_only = false, .console_level = quiver::LogLevel::Off, .trace = trace});
+    db.clear_traced_statements();  // drop the schema setup
+    return db;
+}
+
+}  // namespace
+
+TEST(DatabaseTrace, DisabledByDefault) {
+    auto db = make_basic_db();
+    db.query_integer("SELECT 1");
+    EXPECT_TRUE(db.traced_statements().empty());
+}
+
+TEST(DatabaseTrace, RecordsExpandedSqlRowsAndOperation) {
+    auto db = make_traced_db({});
+
+    db.query_integer("SELECT ? UNION ALL SELECT 2", {int64_t{42}});
+    const auto id = db.create_element("Configuration", quiver::Element().set("label", std::string("Config 1")));
+    db.query_table("SELECT id FROM Configuration UNION ALL SELECT 7");
+
+    const auto traced = db.traced_statements();
+    ASSERT_GE(traced.size(), 3u);
+    EXPECT_EQ(traced.front().sql, "SELECT 42 UNION ALL SELECT 2");
+    EXPECT_EQ(traced.front().operation, "query_integer");
+    EXPECT_EQ(traced.front().rows, 1);  // query_integer steps only the first row
+    EXPECT_GE(traced.front().elapsed_ns, 0);
+
+    bool saw_insert = false;
+    for (const auto& statement : traced) {
+        if (statement.sql.rfind("INSERT INTO Configuration", 0) == 0) {
+            saw_insert = true;
+            EXPECT_EQ(statement.operation, "create_element");
+            EXPECT_EQ(statement.rows, 1);
+            EXPECT_NE(statement.sql.find("'Config 1'"), std::string::npos);
+        }
+    }
+    EXPECT_TRUE(saw_insert);
+    EXPECT_EQ(traced.back().operation, "query_table");
+    EXPECT_EQ(traced.back().rows, 2);
+    EXPECT_EQ(id, 1);
+
+    db.clear_traced_statements();
+    EXPECT_TRUE(db.traced_statements().empty());
+}
+
+TEST(DatabaseTrace, RingKeepsMostRecentStatements) {
+    auto db = make_traced_db({.ring_capacity = 2});
+    for (int64_t i = 1; i <= 5; ++i) {
+        db.query_integer("SELECT ?", {i});
+    }
+    const auto traced = db.traced_statements();
+    ASSERT_EQ(traced.size(), 2u);
+    EXPECT_EQ(traced[0].sql, "SELECT 4");
+    EXPECT_EQ(traced[1].sql, "SELECT 5");
+}
+
+TEST(DatabaseTrace, ThresholdSkipsFastStatements) {
+    auto db = make_traced_db({.slow_threshold_ns = int64_t{60} * 1000 * 1000 * 1000});
+    db.query_integer("SELECT 1");
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Config 1")));
+    EXPECT_TRUE(db.traced_statements().empty());
+}
@@ -406,3 +406,216 @@ TEST(Database, UpdateTimeSeriesGroupMissingBlockInLaterRow) {
     auto result = db.read_time_series_group("Resource", "load", id);
     EXPECT_TRUE(result.empty());
 }
+
+// ============================================================================
+// Bulk columnar write tests
+// ============================================================================
+
+namespace {
+
+struct BulkWriteFixture {
+    quiver::Database db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+    int64_t a = 0;
+    int64_t b = 0;
+
+    BulkWriteFixture() {
+        quiver::Element config;
+        config.set("label", std::string("Test Config"));
+        db.create_element("Configuration", config);
+        quiver::Element e1;
+        e1.set("label", std::string("Item 1"));
+        a = db.create_element("Collection", e1);
+        quiver::Element e2;
+        e2.set("label", std::string("Item 2"));
+        b = db.create_element("Collection", e2);
+    }
+};
+
+std::vector<quiver::TimeSeriesColumn> bulk_columns(std::vector<std::string> dates, std::vector<double> values) {
+    return {{"date_time", std::move(dates), {}}, {"value", std::move(values), {}}};
+}
+
+}  // namespace
+
+TEST(Database, WriteTimeSeriesManyElements) {
+    BulkWriteFixture f;
+    std::vector<int64_t> ids = {f.b, f.a, f.a};
+    auto columns = bulk_columns({"2024-01-01T00:00:00", "2024-01-02T00:00:00", "2024-01-01T00:00:00"}, {9.0, 2.0, 1.0});
+    columns[1].valid = {1, 1, 0};
+    f.db.write_time_series("Collection", "data", ids, columns);
+
+    auto rows_a = f.db.read_time_series_group("Collection", "data", f.a);
+    ASSERT_EQ(rows_a.size(), 2);
+    EXPECT_EQ(std::get<std::string>(rows_a[0]["date_time"]), "2024-01-01T00:00:00");
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(rows_a[0]["value"]));
+    EXPECT_DOUBLE_EQ(std::get<double>(rows_a[1]["value"]), 2.0);
+
+    auto rows_b = f.db.read_time_series_group("Collection", "data", f.b);
+    ASSERT_EQ(rows_b.size(), 1);
+    EXPECT_DOUBLE_EQ(std::get<double>(rows_b[0]["value"]), 9.0);
+}
+
+TEST(Database, WriteTimeSeriesAppendRejectsExistingKey) {
+    BulkWriteFixture f;
+    f.db.write_time_series("Collection", "data", {f.a}, bulk_columns({"2024-01-01T00:00:00"}, {1.0}));
+
+    // The duplicate fails the whole batch, including the new row before it
+    EXPECT_THROW(f.db.write_time_series("Collection",
+                                        "data",
+                                        {f.b, f.a},
+                                        bulk_columns({"2024-01-01T00:00:00", "2024-01-01T00:00:00"}, {2.0, 3.0})),
+                 std::runtime_error);
+    EXPECT_TRUE(f.db.read_time_series_group("Collection", "data", f.b).empty());
+    EXPECT_EQ(f.db.read_time_series_group("Collection", "data", f.a).size(), 1);
+}
+
+TEST(Database, WriteTimeSeriesUpsert) {
+    BulkWriteFixture f;
+    f.db.write_time_series(
+        "Collection", "data", {f.a, f.a}, bulk_columns({"2024-01-01T00:00:00", "2024-01-02T00:00:00"}, {1.0, 2.0}));
+    f.db.write_time_series("Collection",
+                           "data",
+                           {f.a},
+                           bulk_columns({"2024-01-02T00:00:00"}, {20.0}),
+                           quiver::TimeSeriesWriteMode::Upsert);
+
+    auto rows = f.db.read_time_series_group("Collection", "data", f.a);
+    ASSERT_EQ(rows.size(), 2);
+    EXPECT_DOUBLE_EQ(std::get<double>(rows[0]["value"]), 1.0);
+    EXPECT_DOUBLE_EQ(std::get<double>(rows[1]["value"]), 20.0);
+}
+
+TEST(Database, WriteTimeSeriesReplaceRange) {
+    BulkWriteFixture f;
+    f.db.write_time_series("Collection",
+                           "data",
+                           {f.a, f.a, f.a, f.b},
+                           bulk_columns({"2024-01-01T00:00:00",
+                                         "2024-01-02T00:00:00",
+                                         "2024-01-03T00:00:00",
+                                         "2024-01-02T00:00:00"},
+                                        {1.0, 2.0, 3.0, 4.0}));
+
+    // Rewrites Jan 1 to Jan 2 noon for a only: a's Jan 2 row is dropped, its Jan 3 row and b's rows stay
+    f.db.write_time_series("Collection",
+                           "data",
+                           {f.a, f.a},
+                           bulk_columns({"2024-01-02T12:00:00", "2024-01-01T00:00:00"}, {20.0, 15.0}),
+                           quiver::TimeSeriesWriteMode::ReplaceRange);
+
+    auto rows = f.db.read_time_series_group("Collection", "data", f.a);
+    ASSERT_EQ(rows.size(), 3);
+    EXPECT_DOUBLE_EQ(std::get<double>(rows[0]["value"]), 15.0);
+    EXPECT_EQ(std::get<std::string>(rows[1]["date_time"]), "2024-01-02T12:00:00");
+    EXPECT_DOUBLE_EQ(std::get<double>(rows[1]["value"]), 20.0);
+    EXPECT_DOUBLE_EQ(std::get<double>(rows[2]["value"]), 3.0);
+    EXPECT_EQ(f.db.read_time_series_group("Collection", "data", f.b).size(), 1);
+}
+
+TEST(Database, WriteTimeSeriesValidatesColumns) {
+    BulkWriteFixture f;
+    auto expect_error = [&](const std::vector<int64_t>& ids,
+                            const std::vector<quiver::TimeSeriesColumn>& columns,
+                            const std::string& expected) {
+        try {
+            f.db.write_time_series("Collection", "data", ids, columns);
+            FAIL() << "Expected an error containing: " << expected;
+        } catch (const std::runtime_error& e) {
+            EXPECT_NE(std::string(e.what()).find(expected), std::string::npos) << "Actual: " << e.what();
+        }
+    };
+
+    expect_error({f.a, f.a},
+                 bulk_columns({"2024-01-01T00:00:00"}, {1.0, 2.0}),
+                 "Cannot write_time_series: column 'date_time' has 1 cells but ids has 2");
+    expect_error({f.a},
+                 {{"value", std::vector<double>{1.0}, {}}},
+                 "Cannot write_time_series: columns missing required 'date_time' column");
+    expect_error({f.a},
+                 {{"date_time", std::vector<std::string>{"2024-01-01T00:00:00"}, {}},
+                  {"value", std::vector<std::string>{"x"}, {}}},
+                 "Cannot write_time_series: column 'value' has type REAL but received TEXT");
+    expect_error({f.a},
+                 {{"date_time", std::vector<std::string>{"2024-01-01T00:00:00"}, {0}}},
+                 "Cannot write_time_series: dimension column 'date_time' contains NULL");
+    expect_error({f.a},
+                 {{"date_time", std::vector<std::string>{"2024-01-01T00:00:00"}, {}},
+                  {"missing", std::vector<double>{1.0}, {}}},
+                 "Cannot write_time_series: column 'missing' not found");
+    expect_error({999}, bulk_columns({"2024-01-01T00:00:00"}, {1.0}), "999");
+
+    // Integers are accepted for REAL columns
+    f.db.write_time_series("Collection",
+                           "data",
+                           {f.a},
+                           {{"date_time", std::vector<std::string>{"2024-01-01T00:00:00"}, {}},
+                            {"value", std::vector<int64_t>{7}, {}}});
+    EXPECT_DOUBLE_EQ(std::get<double>(f.db.read_time_series_group("Collection", "data", f.a)[0]["value"]), 7.0);
+}
+
+TEST(Database, ReadTimeSeriesGroupAll) {
+    BulkWriteFixture f;
+    std::vector<int64_t> ids = {f.b, f.a, f.a};
+    auto columns = bulk_columns({"2024-01-01T00:00:00", "2024-01-02T00:00:00", "2024-01-01T00:00:00"}, {9.0, 2.0, 1.0});
+    columns[1].valid = {1, 0, 1};
+    f.db.write_time_series("Collection", "data", ids, columns);
+
+    auto data = f.db.read_time_series_group_all("Collection", "data");
+    EXPECT_EQ(data.ids, (std::vector<int64_t>{f.a, f.a, f.b}));
+    ASSERT_EQ(data.columns.size(), 2);
+
+    EXPECT_EQ(data.columns[0].name, "date_time");
+    EXPECT_EQ(std::get<std::vector<std::string>>(data.columns[0].values),
+              (std::vector<std::string>{"2024-01-01T00:00:00", "2024-01-02T00:00:00", "2024-01-01T00:00:00"}));
+    EXPECT_EQ(data.columns[0].valid, (std::vector<uint8_t>{1, 1, 1}));
+
+    EXPECT_EQ(data.columns[1].name, "value");
+    const auto& values = std::get<std::vector<double>>(data.columns[1].values);
+    ASSERT_EQ(values.size(), 3);
+    EXPECT_DOUBLE_EQ(values[0], 1.0);
+    EXPECT_DOUBLE_EQ(values[2], 9.0);
+    EXPECT_EQ(data.columns[1].valid, (std::vector<uint8_t>{1, 0, 1}));
+
+    // The result is write_time_series input: round-trip into a cleared group
+    f.db.update_time_series_group("Collection", "data", f.a, {});
+    f.db.update_time_series_group("Collection", "data", f.b, {});
+    f.db.write_time_series("Collection", "data", data.ids, data.columns);
+    EXPECT_EQ(f.db.read_time_series_group_all("Collection", "data").columns[1].valid, data.columns[1].valid);
+}
+
+TEST(Database, ReadTimeSeriesGroupAllMultiDimension) {
+    auto db = quiver::Database::from_schema(":memory:",
+                                            VALID_SCHEMA("multi_dim_time_series.sql"),
+                                            {.read_only = false, .console_level = quiver::LogLevel::Off});
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+    quiver::Element resource;
+    resource.set("label", std::string("Resource 1"));
+    auto id = db.create_element("Resource", resource);
+
+    std::vector<std::map<std::string, quiver::Value>> rows = {
+        {{"date_time", std::string("2024-01-01")}, {"block", int64_t{2}}, {"load", 20.0}, {"flag", int64_t{1}}},
+        {{"date_time", std::string("2024-01-01")}, {"block", int64_t{1}}, {"load", 10.0}, {"flag", nullptr}}};
+    db.update_time_series_group("Resource", "load", id, rows);
+
+    auto data = db.read_time_series_group_all("Resource", "load");
+    ASSERT_EQ(data.ids.size(), 2);
+    ASSERT_EQ(data.columns.size(), 4);
+    EXPECT_EQ(data.columns[0].name, "date_time");
+    EXPECT_EQ(data.columns[1].name, "block");
+    EXPECT_EQ(std::get<std::vector<int64_t>>(data.columns[1].values), (std::vector<int64_t>{1, 2}));
+    EXPECT_EQ(data.columns[2].name, "load");
+    EXPECT_EQ(data.columns[3].name, "flag");
+    EXPECT_EQ(data.columns[3].valid, (std::vector<uint8_t>{0, 1}));
+}
+
+TEST(Database, ReadTimeSeriesGroupAllEmpty) {
+    BulkWriteFixture f;
+    auto data = f.db.read_time_series_group_all("Collection", "data");
+    EXPECT_TRUE(data.ids.empty());
+    ASSERT_EQ(data.columns.size(), 2);
+    EXPECT_TRUE(std::get<std::vector<double>>(data.columns[1].values).empty());
+    EXPECT_THROW(f.db.read_time_series_group_all("Collection", "missing"), std::runtime_error);
+}
@@ -0,0 +1,437 @@
+#include "test_utils.h"
+
+#include <chrono>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/element.h>
+
+// ============================================================================
+// Packed time series storage (Collection_time_series_<group>_packed)
+// ============================================================================
+
+namespace {
+
+struct PackedFixture {
+    quiver::Database db;
+    int64_t id1 = 0;
+    int64_t id2 = 0;
+
+    PackedFixture()
+        : db(quiver::Database::from_schema(":memory:",
+                                           VALID_SCHEMA("packed_time_series.sql"),
+                                           {.read_only = false, .console_level = quiver::LogLevel::Off})) {
+        quiver::Element config;
+        config.set("label", std::string("Test Config"));
+        db.create_element("Configuration", config);
+
+        quiver::Element e1;
+        e1.set("label", std::string("Plant 1"));
+        id1 = db.create_element("Plant", e1);
+
+        quiver::Element e2;
+        e2.set("label", std::string("Plant 2"));
+        id2 = db.create_element("Plant", e2);
+    }
+
+    int64_t chunk_count(int64_t id) {
+        return *db.query_integer("SELECT COUNT(*) FROM Plant_time_series_inflow_packed WHERE id = ?", {id});
+    }
+};
+
+// "YYYY-MM-DDTHH:MM:SS" of the given number of hours after 2024-01-01T00:00:00.
+std::string hour(int64_t hours) {
+    using namespace std::chrono;
+    const auto time = sys_days{year{2024} / January / 1} + std::chrono::hours{hours};
+    const auto day = floor<days>(time);
+    const year_month_day ymd{day};
+    const hh_mm_ss hms{time - day};
+    char buffer[32];
+    std::snprintf(buffer,
+                  sizeof(buffer),
+                  "%04d-%02u-%02uT%02d:00:00",
+                  static_cast<int>(ymd.year()),
+                  static_cast<unsigned>(ymd.month()),
+                  static_cast<unsigned>(ymd.day()),
+                  static_cast<int>(hms.hours().count()));
+    return buffer;
+}
+
+}  // namespace
+
+TEST(Database, PackedTimeSeriesRoundTrip) {
+    PackedFixture f;
+
+    // Out of order, with a gap at 02:00 and NULL cells; a space separator is accepted.
+    std::vector<std::map<std::string, quiver::Value>> rows = {
+        {{"date_time", std::string("2024-01-01 03:00:00")}, {"inflow", 3.5}, {"turbines", int64_t{3}}},
+        {{"date_time", hour(0)}, {"inflow", 1.5}, {"turbines", int64_t{1}}},
+        {{"date_time", hour(1)}, {"inflow", nullptr}, {"turbines", int64_t{2}}},
+        {{"date_time", hour(4)}, {"inflow", int64_t{4}}},
+    };
+    f.db.update_time_series_group("Plant", "inflow", f.id1, rows);
+
+    auto result = f.db.read_time_series_group("Plant", "inflow", f.id1);
+    ASSERT_EQ(result.size(), 4u);
+    EXPECT_EQ(std::get<std::string>(result[0].at("date_time")), "2024-01-01T00:00:00");
+    EXPECT_EQ(std::get<double>(result[0].at("inflow")), 1.5);
+    EXPECT_EQ(std::get<int64_t>(result[0].at("turbines")), 1);
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(result[1].at("inflow")));
+    EXPECT_EQ(std::get<int64_t>(result[1].at("turbines")), 2);
+    EXPECT_EQ(std::get<std::string>(result[2].at("date_time")), "2024-01-01T03:00:00");
+    EXPECT_EQ(std::get<double>(result[2].at("inflow")), 3.5);
+    EXPECT_EQ(std::get<std::string>(result[3].at("date_time")), "2024-01-01T04:00:00");
+    EXPECT_EQ(std::get<double>(result[3].at("inflow")), 4.0);
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(result[3].at("turbines")));
+
+    // The time series table itself holds no rows.
+    EXPECT_EQ(*f.db.query_integer("SELECT COUNT(*) FROM Plant_time_series_inflow"), 0);
+    EXPECT_EQ(f.chunk_count(f.id1), 1);
+    EXPECT_TRUE(f.db.read_time_series_group("Plant", "inflow", f.id2).empty());
+
+    // Unpacked groups of the same collection are unaffected.
+    f.db.update_time_series_group(
+        "Plant", "prices", f.id1, {{{"date_time", std::string("2024-01-01")}, {"price", 9.0}}});
+    EXPECT_EQ(std::get<std::string>(f.db.read_time_series_group("Plant", "prices", f.id1)[0].at("date_time")),
+              "2024-01-01");
+
+    // Clearing removes the chunks; deleting the element cascades to them.
+    f.db.update_time_series_group("Plant", "inflow", f.id1, {});
+    EXPECT_EQ(f.chunk_count(f.id1), 0);
+    f.db.update_time_series_group("Plant", "inflow", f.id2, rows);
+    EXPECT_EQ(f.chunk_count(f.id2), 1);
+    f.db.delete_element("Plant", f.id2);
+    EXPECT_EQ(f.chunk_count(f.id2), 0);
+}
+
+TEST(Database, PackedTimeSeriesDeleteElementsReportsDecodedRows) {
+    PackedFixture f;
+
+    // Five slots with a gap: one chunk holding four rows.
+    f.db.update_time_series_group("Plant",
+                                  "inflow",
+                                  f.id1,
+                                  {{{"date_time", hour(0)}, {"inflow", 1.0}},
+                                   {{"date_time", hour(1)}, {"inflow", 2.0}},
+                                   {{"date_time", hour(3)}, {"inflow", 3.0}},
+                                   {{"date_time", hour(4)}, {"inflow", 4.0}}});
+    f.db.update_time_series_group("Plant", "inflow", f.id2, {{{"date_time", hour(0)}, {"inflow", 5.0}}});
+    ASSERT_EQ(f.chunk_count(f.id1), 1);
+
+    std::vector<int64_t> ids = {f.id1, f.id2};
+    const auto result = f.db.delete_elements("Plant", ids);
+    EXPECT_EQ(result.elements, 2);
+    EXPECT_EQ(result.group_rows.at("Plant_time_series_inflow"), 5);
+    EXPECT_EQ(result.group_rows.count("Plant_time_series_inflow_packed"), 0u);
+    EXPECT_EQ(f.chunk_count(f.id1), 0);
+}
+
+TEST(Database, PackedTimeSeriesBulkWriteAndRead) {
+    PackedFixture f;
+
+    // Two years of hourly values for one element (three chunks of at most 8760 slots) and a
+    // daily series for the other.
+    constexpr int64_t hours = 17544;
+    std::vector<int64_t> ids;
+    std::vector<std::string> date_times;
+    std::vector<double> inflow;
+    for (int64_t h = 0; h < hours; ++h) {
+        ids.push_back(f.id1);
+        date_times.push_back(hour(h));
+        inflow.push_back(static_cast<double>(h));
+    }
+    for (int64_t d = 0; d < 10; ++d) {
+        ids.push_back(f.id2);
+        date_times.push_back(hour(d * 24));
+        inflow.push_back(100.0 + static_cast<double>(d));
+    }
+    std::vector<quiver::TimeSeriesColumn> columns(2);
+    columns[0].name = "date_time";
+    columns[0].values = date_times;
+    columns[1].name = "inflow";
+    columns[1].values = inflow;
+    f.db.write_time_series("Plant", "inflow", ids, columns);
+
+    EXPECT_EQ(f.chunk_count(f.id1), 3);
+    EXPECT_EQ(f.chunk_count(f.id2), 1);
+
+    auto data = f.db.read_time_series_group_all("Plant", "inflow");
+    EXPECT_EQ(data.ids, ids);
+    ASSERT_EQ(data.columns.size(), 3u);
+    EXPECT_EQ(std::get<std::vector<std::string>>(data.columns[0].values), date_times);
+    EXPECT_EQ(std::get<std::vector<double>>(data.columns[1].values), inflow);
+    EXPECT_EQ(data.columns[2].name, "turbines");
+    EXPECT_EQ(data.columns[2].valid, std::vector<uint8_t>(ids.size(), 0));
+
+    // Append rejects an existing time; Upsert overwrites it.
+    std::vector<quiver::TimeSeriesColumn> one(2);
+    one[0].name = "date_time";
+    one[0].values = std::vector<std::string>{hour(5)};
+    one[1].name = "inflow";
+    one[1].values = std::vector<double>{-5.0};
+    EXPECT_THROW(f.db.write_time_series("Plant", "inflow", {f.id1}, one), std::runtime_error);
+    f.db.write_time_series("Plant", "inflow", {f.id1}, one, quiver::TimeSeriesWriteMode::Upsert);
+    EXPECT_EQ(std::get<double>(f.db.read_time_series_group("Plant", "inflow", f.id1)[5].at("inflow")), -5.0);
+
+    // ReplaceRange drops the element's rows between the first and last written time.
+    std::vector<quiver::TimeSeriesColumn> range(2);
+    range[0].name = "date_time";
+    range[0].values = std::vector<std::string>{hour(24), hour(48)};
+    range[1].name = "inflow";
+    range[1].values = std::vector<double>{7.0, 8.0};
+    f.db.write_time_series("Plant", "inflow", {f.id2, f.id2}, range, quiver::TimeSeriesWriteMode::ReplaceRange);
+    auto daily = f.db.read_time_series_group("Plant", "inflow", f.id2);
+    ASSERT_EQ(daily.size(), 10u);
+    EXPECT_EQ(std::get<double>(daily[1].at("inflow")), 7.0);
+    EXPECT_EQ(std::get<double>(daily[2].at("inflow")), 8.0);
+    EXPECT_EQ(std::get<double>(daily[3].at("inflow")), 103.0);
+
+    // upsert_time_series_row leaves omitted columns NULL, as for row tables.
+    f.db.upsert_time_series_row("Plant", "inflow", f.id2, {{"date_time", hour(12)}, {"turbines", int64_t{2}}});
+    daily = f.db.read_time_series_group("Plant", "inflow", f.id2);
+    ASSERT_EQ(daily.size(), 11u);
+    EXPECT_EQ(std::get<std::string>(daily[1].at("date_time")), hour(12));
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(daily[1].at("inflow")));
+    EXPECT_EQ(std::get<int64_t>(daily[1].at("turbines")), 2);
+}
+
+TEST(Database, PackedTimeSeriesAsOfReads) {
+    PackedFixture f;
+
+    f.db.update_time_series_group("Plant",
+                                  "inflow",
+                                  f.id1,
+                                  {{{"date_time", hour(0)}, {"inflow", 1.0}},
+                                   {{"date_time", hour(2)}, {"inflow", nullptr}, {"turbines", int64_t{1}}},
+                                   {{"date_time", hour(4)}, {"inflow", 3.0}}});
+
+    // Element 2 has no rows. NULL cells are skipped, so 02:00 and 03:00 still see 1.0.
+    auto row = f.db.read_time_series_row("Plant", "inflow", "inflow", hour(3));
+    ASSERT_EQ(row.size(), 2u);
+    EXPECT_EQ(std::get<double>(row[0]), 1.0);
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(row[1]));
+
+    auto rows = f.db.read_time_series_rows("Plant", "inflow", "inflow", {hour(9), hour(-1), hour(2), hour(4)});
+    ASSERT_EQ(rows.size(), 2u);
+    ASSERT_EQ(rows[0].size(), 4u);
+    EXPECT_EQ(std::get<double>(rows[0][0]), 3.0);
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(rows[0][1]));
+    EXPECT_EQ(std::get<double>(rows[0][2]), 1.0);
+    EXPECT_EQ(std::get<double>(rows[0][3]), 3.0);
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(rows[1][0]));
+
+    EXPECT_EQ(std::get<int64_t>(f.db.read_time_series_row("Plant", "inflow", "turbines", hour(5))[0]), 1);
+
+    // Lookup times must be full date-times.
+    EXPECT_THROW(f.db.read_time_series_row("Plant", "inflow", "inflow", "2024-01-01"), std::runtime_error);
+}
+
+TEST(Database, PackedTimeSeriesAsOfReadsOnlyTheChunksItNeeds) {
+    PackedFixture f;
+    f.db.enable_stats();
+
+    // Hourly rows over three chunks; the last chunk only has NULL inflow.
+    std::vector<std::map<std::string, quiver::Value>> rows;
+    for (int64_t h = 0; h < 2 * 8760 + 10; ++h) {
+        if (h < 2 * 8760) {
+            rows.push_back({{"date_time", hour(h)}, {"inflow", static_cast<double>(h)}});
+        } else {
+            rows.push_back({{"date_time", hour(h)}, {"inflow", nullptr}, {"turbines", int64_t{1}}});
+        }
+    }
+    f.db.update_time_series_group("Plant", "inflow", f.id1, rows);
+    ASSERT_EQ(f.chunk_count(f.id1), 3);
+
+    auto rows_read = [&f](const std::string& operation) {
+        for (const auto& op : f.db.stats()) {
+            if (op.operation == operation) {
+                return op.rows_read;
+            }
+        }
+        return int64_t{0};
+    };
+
+    // Each read also lists the two plants. Only the first chunk starts at or before hour 100.
+    EXPECT_EQ(std::get<double>(f.db.read_time_series_row("Plant", "inflow", "inflow", hour(100))[0]), 100.0);
+    EXPECT_EQ(rows_read("read_time_series_row"), 2 + 1);
+
+    // The newest chunk has no inflow, so the answer comes from the one before; the first is never read.
+    auto matrix = f.db.read_time_series_rows("Plant", "inflow", "inflow", {hour(2 * 8760 + 5), hour(8760)});
+    EXPECT_EQ(std::get<double>(matrix[0][0]), 2 * 8760 - 1.0);
+    EXPECT_EQ(std::get<double>(matrix[0][1]), 8760.0);
+    EXPECT_EQ(rows_read("read_time_series_rows"), 2 + 2);
+}
+
+TEST(Database, PackedTimeSeriesCellsAreLittleEndian) {
+    PackedFixture f;
+    f.db.update_time_series_group("Plant", "inflow", f.id1, {{{"date_time", hour(0)}, {"inflow", 1.0}}});
+
+    // Presence bitmap, then inflow (validity bitmap, 1.0) and turbines (validity bitmap, no value).
+    EXPECT_EQ(f.db.query_string("SELECT hex(data) FROM Plant_time_series_inflow_packed WHERE id = ?", {f.id1}),
+              "0101000000000000F03F000000000000000000");
+}
+
+TEST(Database, PackedTimeSeriesCreateAndUpdateElement) {
+    PackedFixture f;
+
+    quiver::Element element;
+    element.set("label", std::string("Plant 3"));
+    element.set("date_time", std::vector<std::string>{hour(1), hour(0)});
+    element.set("inflow", std::vector<double>{2.0, 1.0});
+    auto id = f.db.create_element("Plant", element);
+
+    auto rows = f.db.read_time_series_group("Plant", "inflow", id);
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(std::get<double>(rows[0].at("inflow")), 1.0);
+    EXPECT_EQ(f.chunk_count(id), 1);
+
+    quiver::Element update;
+    update.set("date_time", std::vector<std::string>{hour(6)});
+    update.set("inflow", std::vector<double>{6.0});
+    f.db.update_element("Plant", id, update);
+    rows = f.db.read_time_series_group("Plant", "inflow", id);
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_EQ(std::get<std::string>(rows[0].at("date_time")), hour(6));
+}
+
+TEST(Database, PackedTimeSeriesCreateElements) {
+    PackedFixture f;
+
+    quiver::Element e3;
+    e3.set("label", std::string("Plant 3"));
+    e3.set("date_time", std::vector<std::string>{hour(1), hour(0)});
+    e3.set("inflow", std::vector<double>{2.0, 1.0});
+    quiver::Element e4;
+    e4.set("label", std::string("Plant 4"));
+    e4.set("date_time", std::vector<std::string>{hour(2)});
+    e4.set("turbines", std::vector<int64_t>{4});
+    auto ids = f.db.create_elements("Plant", {e3, e4});
+    ASSERT_EQ(ids.size(), 2u);
+
+    auto rows = f.db.read_time_series_group("Plant", "inflow", ids[0]);
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(std::get<std::string>(rows[0].at("date_time")), hour(0));
+    EXPECT_EQ(std::get<double>(rows[0].at("inflow")), 1.0);
+    EXPECT_EQ(std::get<double>(rows[1].at("inflow")), 2.0);
+    rows = f.db.read_time_series_group("Plant", "inflow", ids[1]);
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_EQ(std::get<int64_t>(rows[0].at("turbines")), 4);
+    EXPECT_EQ(f.chunk_count(ids[0]), 1);
+    EXPECT_EQ(*f.db.query_integer("SELECT COUNT(*) FROM Plant_time_series_inflow"), 0);
+
+    // A duplicate time in a later element is rejected before any element is written.
+    quiver::Element e5;
+    e5.set("label", std::string("Plant 5"));
+    quiver::Element e6;
+    e6.set("label", std::string("Plant 6"));
+    e6.set("date_time", std::vector<std::string>{hour(0), hour(0)});
+    e6.set("inflow", std::vector<double>{1.0, 2.0});
+    EXPECT_THROW(f.db.create_elements("Plant", {e5, e6}), std::runtime_error);
+    EXPECT_EQ(*f.db.query_integer("SELECT COUNT(*) FROM Plant"), 4);
+}
+
+TEST(Database, PackedTimeSeriesErrors) {
+    PackedFixture f;
+
+    // Duplicate times, date-only values, and times too irregular to pack are rejected and leave
+    // the stored series alone.
+    f.db.update_time_series_group("Plant", "inflow", f.id1, {{{"date_time", hour(0)}, {"inflow", 1.0}}});
+    EXPECT_THROW(f.db.update_time_series_group(
+                     "Plant",
+                     "inflow",
+                     f.id1,
+                     {{{"date_time", hour(1)}, {"inflow", 1.0}}, {{"date_time", hour(1)}, {"inflow", 2.0}}}),
+                 std::runtime_error);
+    EXPECT_THROW(f.db.update_time_series_group(
+                     "Plant", "inflow", f.id1, {{{"date_time", std::string("2024-01-01")}, {"inflow", 1.0}}}),
+                 std::runtime_error);
+    EXPECT_THROW(f.db.update_time_series_group("Plant",
+                                               "inflow",
+                                               f.id1,
+                                               {{{"date_time", std::string("2024-01-01T00:00:00")}, {"inflow", 1.0}},
+                                                {{"date_time", std::string("2024-01-01T00:00:01")}, {"inflow", 1.0}},
+                                                {{"date_time", std::string("2030-01-01T00:00:00")}, {"inflow", 1.0}}}),
+                 std::runtime_error);
+    EXPECT_EQ(f.db.read_time_series_group("Plant", "inflow", f.id1).size(), 1u);
+
+    EXPECT_THROW(f.db.export_csv("Plant", "inflow", "packed.csv"), std::runtime_error);
+}
+
+TEST(Database, PackedTimeSeriesCreateElementTypeMismatch) {
+    auto db = quiver::Database::from_schema(":memory:",
+                                            VALID_SCHEMA("packed_time_series_shared_column.sql"),
+                                            {.read_only = false, .console_level = quiver::LogLevel::Off});
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    // 'operator' is FK-resolved against the set group, where it is TEXT, so the string reaches the
+    // packed group's INTEGER column and must be rejected there.
+    quiver::Element element;
+    element.set("label", std::string("Plant 1"));
+    element.set("date_time", std::vector<std::string>{hour(0)});
+    element.set("operator", std::vector<std::string>{"Alice"});
+    try {
+        db.create_element("Plant", element);
+        FAIL() << "Expected std::runtime_error";
+    } catch (const std::runtime_error& e) {
+        EXPECT_STREQ(e.what(),
+                     "Cannot create_element: type mismatch for column 'operator': expected INTEGER, got TEXT");
+    }
+    EXPECT_THROW(db.create_elements("Plant", {element}), std::runtime_error);
+    EXPECT_EQ(*db.query_integer("SELECT COUNT(*) FROM Plant"), 0);
+}
+
+TEST(Database, PackedTimeSeriesSuffixWithoutLayoutIsOrdinaryGroup) {
+    auto db = quiver::Database::from_schema(":memory:",
+                                            VALID_SCHEMA("packed_time_series_suffix.sql"),
+                                            {.read_only = false, .console_level = quiver::LogLevel::Off});
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+    quiver::Element plant;
+    plant.set("label", std::string("Plant 1"));
+    auto id = db.create_element("Plant", plant);
+
+    std::vector<std::string> groups;
+    for (const auto& group : db.list_time_series_groups("Plant")) {
+        groups.push_back(group.group_name);
+    }
+    EXPECT_EQ(groups, (std::vector<std::string>{"flow", "flow_packed", "level_packed"}));
+
+    db.update_time_series_group("Plant", "flow_packed", id, {{{"date_time", hour(0)}, {"flow_peak", 2.5}}});
+    db.update_time_series_group("Plant", "level_packed", id, {{{"date_time", hour(0)}, {"level", 7.0}}});
+    EXPECT_EQ(*db.query_integer("SELECT COUNT(*) FROM Plant_time_series_flow_packed"), 1);
+    auto rows = db.read_time_series_group("Plant", "level_packed", id);
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_EQ(std::get<double>(rows[0].at("level")), 7.0);
+}
+
+TEST(Database, PackedTimeSeriesStats) {
+    PackedFixture f;
+    f.db.enable_stats();
+
+    f.db.update_time_series_group(
+        "Plant",
+        "inflow",
+        f.id1,
+        {{{"date_time", hour(0)}, {"inflow", 1.0}}, {{"date_time", hour(1)}, {"inflow", 2.0}}});
+    f.db.update_time_series_group("Plant", "inflow", f.id2, {{{"date_time", hour(0)}, {"inflow", 3.0}}});
+    EXPECT_EQ(f.db.read_time_series_group("Plant", "inflow", f.id1).size(), 2u);
+    EXPECT_EQ(f.db.read_time_series_group_all("Plant", "inflow").ids.size(), 3u);
+
+    // Chunks are stepped and bound outside Cursor, but still count toward the operation.
+    const auto stats = f.db.stats();
+    auto find = [&stats](const std::string& operation) -> const quiver::OperationStats& {
+        for (const auto& op : stats) {
+            if (op.operation == operation) {
+                return op;
+            }
+        }
+        throw std::runtime_error("no stats for " + operation);
+    };
+    // DELETE binds the id; each chunk binds five integers and its data.
+    EXPECT_GT(find("update_time_series_group").bytes_bound, 2 * 6 * 8);
+    EXPECT_EQ(find("read_time_series_group").rows_read, 1);
+    EXPECT_EQ(find("read_time_series_group_all").rows_read, 2);
+}
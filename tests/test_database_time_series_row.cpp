@@ -253,6 +253,114 @@ static std::string capture_add_row_error(quiver::Database& db,
     return {};
 }
 
+TEST(Database, ReadTimeSeriesRowsMatchesRowReader) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    std::vector<int64_t> ids;
+    for (int i = 1; i <= 3; ++i) {
+        quiver::Element e;
+        e.set("label", "Item " + std::to_string(i));
+        ids.push_back(db.create_element("Collection", e));
+    }
+
+    db.update_time_series_group("Collection",
+                                "data",
+                                ids[0],
+                                {{{"date_time", std::string("2024-01-01")}, {"value", 1.0}},
+                                 {{"date_time", std::string("2024-01-03")}, {"value", nullptr}},
+                                 {{"date_time", std::string("2024-01-04")}, {"value", 4.0}}});
+    db.update_time_series_group(
+        "Collection", "data", ids[2], {{{"date_time", std::string("2024-01-02")}, {"value", 20.0}}});
+
+    // Unsorted and repeated timestamps, including ones before and after all data
+    std::vector<std::string> date_times = {
+        "2024-01-03", "2023-12-31", "2024-01-01", "2024-01-05", "2024-01-02", "2024-01-03"};
+    auto matrix = db.read_time_series_rows("Collection", "data", "value", date_times);
+    ASSERT_EQ(matrix.size(), 3);
+
+    for (size_t t = 0; t < date_times.size(); ++t) {
+        auto row = db.read_time_series_row("Collection", "data", "value", date_times[t]);
+        for (size_t e = 0; e < ids.size(); ++e) {
+            EXPECT_EQ(matrix[e][t], row[e]) << "element " << e << " at " << date_times[t];
+        }
+    }
+
+    // Spot checks: NULL at 2024-01-03 carries 1.0 forward, element 2 has no data
+    EXPECT_DOUBLE_EQ(std::get<double>(matrix[0][0]), 1.0);
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(matrix[0][1]));
+    EXPECT_DOUBLE_EQ(std::get<double>(matrix[0][3]), 4.0);
+    EXPECT_TRUE(std::holds_alternative<std::nullptr_t>(matrix[1][3]));
+    EXPECT_DOUBLE_EQ(std::get<double>(matrix[2][4]), 20.0);
+}
+
+TEST(Database, ReadTimeSeriesRowsEdgeCases) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("collections.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    EXPECT_TRUE(db.read_time_series_rows("Collection", "data", "value", {"2024-01-01"}).empty());
+
+    quiver::Element e;
+    e.set("label", std::string("Item 1"));
+    db.create_element("Collection", e);
+
+    auto matrix = db.read_time_series_rows("Collection", "data", "value", {});
+    ASSERT_EQ(matrix.size(), 1);
+    EXPECT_TRUE(matrix[0].empty());
+
+    EXPECT_THROW(db.read_time_series_rows("Collection", "data", "missing", {"2024-01-01"}), std::runtime_error);
+    EXPECT_THROW(db.read_time_series_rows("Collection", "data", "date_time", {"2024-01-01"}), std::runtime_error);
+}
+
+TEST(Database, ReadTimeSeriesRowsRejectMultiDimensionGroups) {
+    auto db = quiver::Database::from_schema(":memory:",
+                                            VALID_SCHEMA("multi_dim_time_series.sql"),
+                                            {.read_only = false, .console_level = quiver::LogLevel::Off});
+
+    quiver::Element config;
+    config.set("label", std::string("Test Config"));
+    db.create_element("Configuration", config);
+
+    quiver::Element resource;
+    resource.set("label", std::string("Resource 1"));
+    auto id = db.create_element("Resource", resource);
+    db.update_time_series_group("Resource",
+                                "load",
+                                id,
+                                {{{"date_time", std::string("2024-01-02")}, {"block", int64_t{1}}, {"load", 30.0}},
+                                 {{"date_time", std::string("2024-01-02")}, {"block", int64_t{2}}, {"load", nullptr}}});
+
+    // Block 1 and block 2 disagree at 2024-01-02, so neither reader picks one of them.
+    auto error_of = [](auto&& call) {
+        try {
+            call();
+        } catch (const std::runtime_error& e) {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+    const auto row_error =
+        error_of([&] { db.read_time_series_row("Resource", "load", "load", "2024-01-02T12:00:00"); });
+    const auto rows_error =
+        error_of([&] { db.read_time_series_rows("Resource", "load", "load", {"2024-01-02T12:00:00"}); });
+    EXPECT_NE(row_error.find("Cannot read_time_series_row: group 'load' of collection 'Resource' has more than one "
+                             "dimension column"),
+              std::string::npos)
+        << "Actual: " << row_error;
+    EXPECT_NE(rows_error.find("Cannot read_time_series_rows: group 'load' of collection 'Resource' has more than "
+                              "one dimension column"),
+              std::string::npos)
+        << "Actual: " << rows_error;
+}
+
 TEST(Database, UpsertTimeSeriesRowInsert) {
     auto db = quiver::Database::from_schema(
         ":memory:", VALID_SCHEMA("collections.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
@@ -0,0 +1,121 @@
+#include "test_utils.h"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <quiver/database.h>
+#include <quiver/index_advisor.h>
+#include <sqlite3.h>
+
+namespace {
+
+const quiver::DatabaseOptions quiet{.read_only = false, .console_level = quiver::LogLevel::Off};
+
+// Same shape as collections.sql, but no group table key leads with id (the set's UNIQUE is (tag, id)).
+constexpr const char* kUnindexedSchema = R"(
+    CREATE TABLE Configuration (id INTEGER PRIMARY KEY, label TEXT UNIQUE NOT NULL) STRICT;
+    CREATE TABLE Collection (id INTEGER PRIMARY KEY AUTOINCREMENT, label TEXT UNIQUE NOT NULL) STRICT;
+    CREATE TABLE Collection_vector_values (
+        id INTEGER, vector_index INTEGER, value_int INTEGER,
+        FOREIGN KEY (id) REFERENCES Collection(id) ON DELETE CASCADE ON UPDATE CASCADE
+    ) STRICT;
+    CREATE TABLE Collection_set_tags (
+        id INTEGER, tag TEXT, UNIQUE (tag, id),
+        FOREIGN KEY (id) REFERENCES Collection(id) ON DELETE CASCADE ON UPDATE CASCADE
+    ) STRICT;
+    CREATE TABLE Collection_time_series_data (
+        id INTEGER, date_time TEXT, value REAL,
+        FOREIGN KEY (id) REFERENCES Collection(id) ON DELETE CASCADE ON UPDATE CASCADE
+    ) STRICT;
+)";
+
+// from_schema only reads files: write kUnindexedSchema next to the other temporaries.
+std::string unindexed_schema_path() {
+    const auto path = (std::filesystem::temp_directory_path() / "quiver_index_advisor_schema.sql").string();
+    std::ofstream(path) << kUnindexedSchema;
+    return path;
+}
+
+std::vector<std::string> describe(const std::vector<quiver::MissingIndex>& indexes) {
+    std::vector<std::string> result;
+    for (const auto& index : indexes) {
+        result.push_back(index.create_sql());
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(IndexAdvisor, ConventionalSchemaNeedsNothing) {
+    auto db = quiver::Database::from_schema(":memory:", VALID_SCHEMA("collections.sql"), quiet);
+    EXPECT_TRUE(db.missing_indexes().empty());
+    EXPECT_TRUE(db.ensure_indexes().empty());
+}
+
+TEST(IndexAdvisor, ReportsUnindexedForeignKeyColumns) {
+    auto db = quiver::Database::from_schema(":memory:", VALID_SCHEMA("relations.sql"), quiet);
+    EXPECT_EQ(describe(db.missing_indexes()),
+              (std::vector<std::string>{
+                  "CREATE INDEX IF NOT EXISTS idx_Child_parent_id ON Child (parent_id)",
+                  "CREATE INDEX IF NOT EXISTS idx_Child_sibling_id ON Child (sibling_id)",
+                  "CREATE INDEX IF NOT EXISTS idx_Child_set_mentors_mentor_id ON Child_set_mentors (mentor_id)",
+                  "CREATE INDEX IF NOT EXISTS idx_Child_set_parents_parent_ref ON Child_set_parents (parent_ref)",
+                  "CREATE INDEX IF NOT EXISTS idx_Child_time_series_events_sponsor_id ON Child_time_series_events "
+                  "(sponsor_id)",
+                  "CREATE INDEX IF NOT EXISTS idx_Child_vector_refs_parent_ref ON Child_vector_refs (parent_ref)",
+              }));
+}
+
+TEST(IndexAdvisor, ReportsGroupAccessPaths) {
+    sqlite3* raw = nullptr;
+    ASSERT_EQ(sqlite3_open(":memory:", &raw), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(raw, kUnindexedSchema, nullptr, nullptr, nullptr), SQLITE_OK);
+    const auto schema = quiver::Schema::from_database(raw);
+    sqlite3_close(raw);
+
+    const auto missing = quiver::IndexAdvisor(schema).missing_indexes();
+    ASSERT_EQ(missing.size(), 3u);
+    EXPECT_EQ(missing[0].table, "Collection_set_tags");
+    EXPECT_EQ(missing[0].columns, (std::vector<std::string>{"id"}));
+    EXPECT_EQ(missing[1].table, "Collection_time_series_data");
+    EXPECT_EQ(missing[1].columns, (std::vector<std::string>{"id", "date_time"}));
+    EXPECT_EQ(missing[2].table, "Collection_vector_values");
+    EXPECT_EQ(missing[2].columns, (std::vector<std::string>{"id", "vector_index"}));
+    EXPECT_FALSE(missing[2].reason.empty());
+}
+
+TEST(IndexAdvisor, EnsureIndexesCreatesWhatIsMissing) {
+    auto db = quiver::Database::from_schema(":memory:", unindexed_schema_path(), quiet);
+
+    const auto created = db.ensure_indexes();
+    EXPECT_EQ(created.size(), 3u);
+    EXPECT_TRUE(db.missing_indexes().empty());
+    EXPECT_TRUE(db.ensure_indexes().empty());
+    EXPECT_EQ(db.query_integer("SELECT COUNT(*) FROM sqlite_master WHERE type = 'index' AND name LIKE 'idx_%'"), 3);
+
+    // Vector reads now search the index instead of scanning the table.
+    auto plan = db.cursor(
+        "EXPLAIN QUERY PLAN SELECT value_int FROM Collection_vector_values WHERE id = 1 ORDER BY vector_index");
+    ASSERT_TRUE(plan.next());
+    EXPECT_NE(plan.get_string(3).value_or("").find("idx_Collection_vector_values_id_vector_index"), std::string::npos);
+}
+
+TEST(IndexAdvisor, AsOfReadsRequireTheTimeSeriesIndex) {
+    auto db = quiver::Database::from_schema(":memory:", unindexed_schema_path(), quiet);
+    db.create_element("Configuration", quiver::Element().set("label", std::string("Config")));
+    db.create_element("Collection", quiver::Element().set("label", std::string("Item 1")));
+
+    EXPECT_THROW(db.read_time_series_rows("Collection", "data", "value", {"2024-01-01"}), std::runtime_error);
+    db.ensure_indexes();
+    EXPECT_EQ(db.read_time_series_rows("Collection", "data", "value", {"2024-01-01"}).size(), 1u);
+}
+
+TEST(IndexAdvisor, EnsureIndexesRejectsReadOnlyDatabase) {
+    const auto path = (std::filesystem::temp_directory_path() / "quiver_index_advisor_read_only.db").string();
+    std::filesystem::remove(path);
+    { auto setup = quiver::Database::from_schema(path, unindexed_schema_path(), quiet); }
+    quiver::Database db(path, {.read_only = true, .console_level = quiver::LogLevel::Off});
+    EXPECT_EQ(db.missing_indexes().size(), 3u);
+    EXPECT_THROW(db.ensure_indexes(), std::runtime_error);
+    std::filesystem::remove(path);
+}
@@ -102,3 +102,29 @@ TEST_F(LuaRunnerTest, DeleteElementByIdOtherElementsUnchanged) {
     EXPECT_TRUE(std::find(labels.begin(), labels.end(), "Item 3") != labels.end());
     EXPECT_TRUE(std::find(labels.begin(), labels.end(), "Item 2") == labels.end());
 }
+
+TEST_F(LuaRunnerTest, DeleteElementsAndWhere) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+
+    db.create_element("Configuration", quiver::Element().set("label", "Config"));
+    for (int64_t i = 1; i <= 4; ++i) {
+        db.create_element("Collection",
+                          quiver::Element()
+                              .set("label", "Item " + std::to_string(i))
+                              .set("some_integer", i * 100)
+                              .set("value_int", std::vector<int64_t>{i, i}));
+    }
+
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        local result = db:delete_elements("Collection", {1, 2})
+        assert(result.elements == 2, "Expected 2 deleted elements")
+        assert(result.group_rows.Collection_vector_values == 4, "Expected 4 vector rows")
+
+        result = db:delete_elements_where("Collection", "some_integer > ?", {300})
+        assert(result.elements == 1, "Expected 1 deleted element")
+    )");
+
+    EXPECT_EQ(db.read_element_ids("Collection"), (std::vector<int64_t>{3}));
+}
@@ -50,3 +50,17 @@ TEST_F(LuaRunnerTest, SummarizeCollection) {
         assert(report:find("values: 1/3 non%-empty"), "bad vector group stats")
     )LUA");
 }
+
+TEST_F(LuaRunnerTest, EnsureIndexes) {
+    auto db = quiver::Database::from_schema(
+        ":memory:", VALID_SCHEMA("relations.sql"), {.read_only = false, .console_level = quiver::LogLevel::Off});
+    quiver::LuaRunner lua(db);
+    lua.run(R"LUA(
+        local missing = db:missing_indexes()
+        assert(#missing == 6, "expected 6 missing indexes, got " .. #missing)
+        assert(missing[1].table == "Child", "first missing index should be on Child")
+        assert(missing[1].columns[1] == "parent_id", "first missing index should be on parent_id")
+        assert(#db:ensure_indexes() == 6, "ensure_indexes should create all 6")
+        assert(#db:missing_indexes() == 0, "nothing should be missing afterwards")
+    )LUA");
+}
@@ -166,3 +166,22 @@ TEST_F(LuaRunnerTest, QueryParameterCountMismatch) {
         assert(label == "Item 1", "expected Item 1, got " .. tostring(label))
     )");
 }
+
+TEST_F(LuaRunnerTest, StatsReportsOperations) {
+    auto db = quiver::Database::from_schema(":memory:", collections_schema);
+    db.create_element("Configuration", quiver::Element().set("label", "Config"));
+
+    quiver::LuaRunner lua(db);
+
+    lua.run(R"(
+        db:enable_stats()
+        db:query_integer("SELECT 1")
+        db:query_integer("SELECT 2")
+        local stats = db:stats()
+        assert(stats.query_integer ~= nil, "Expected query_integer stats")
+        assert(stats.query_integer.calls == 2, "Expected 2 calls, got " .. tostring(stats.query_integer.calls))
+        assert(stats.query_integer.rows_read == 2, "Expected 2 rows read")
+        db:reset_stats()
+        assert(next(db:stats()) == nil, "Expected no stats after reset")
+    )");
+}
@@ -1,7 +1,14 @@
 #include "test_utils.h"
 
+#include <algorithm>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <quiver/database.h>
+#include <quiver/schema.h>
+#include <quiver/schema_validator.h>
+#include <sqlite3.h>
+#include <string>
+#include <vector>
 
 class SchemaValidatorFixture : public ::testing::Test {
 protected:
@@ -73,6 +80,22 @@ TEST_F(SchemaValidatorFixture, InvalidFkActions) {
                  std::runtime_error);
 }
 
+TEST_F(SchemaValidatorFixture, ValidSchemaPackedTimeSeries) {
+    EXPECT_NO_THROW(quiver::Database::from_schema(":memory:", VALID_SCHEMA("packed_time_series.sql"), options));
+}
+
+TEST_F(SchemaValidatorFixture, InvalidPackedTimeSeriesTextValue) {
+    EXPECT_THROW(
+        quiver::Database::from_schema(":memory:", INVALID_SCHEMA("packed_time_series_text_value.sql"), options),
+        std::runtime_error);
+}
+
+TEST_F(SchemaValidatorFixture, InvalidPackedTimeSeriesNoGroup) {
+    EXPECT_THROW(
+        quiver::Database::from_schema(":memory:", INVALID_SCHEMA("packed_time_series_no_group.sql"), options),
+        std::runtime_error);
+}
+
 // ============================================================================
 // Type validation tests (via create_element errors)
 // ============================================================================
@@ -346,3 +369,151 @@ TEST_F(SchemaValidatorFixture, GetScalarMetadataIdColumn) {
     EXPECT_EQ(metadata.name, "id");
     EXPECT_EQ(metadata.data_type, quiver::DataType::Integer);
 }
+
+// ============================================================================
+// Schema lookup index
+// ============================================================================
+
+TEST(SchemaLookup, GroupsAndColumnRouting) {
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(":memory:", &db), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(db,
+                           "CREATE TABLE Items (id INTEGER PRIMARY KEY, label TEXT);"
+                           "CREATE TABLE Items_vector_amount (id INTEGER, vector_index INTEGER, value REAL);"
+                           "CREATE TABLE Items_vector_values (id INTEGER, vector_index INTEGER, amount REAL);"
+                           "CREATE TABLE Items_set_amounts (id INTEGER, amount REAL);"
+                           "CREATE TABLE Items_time_series_data (id INTEGER, date_time TEXT, amount REAL);"
+                           "CREATE TABLE Items_time_series_files (data TEXT);",
+                           nullptr,
+                           nullptr,
+                           nullptr),
+              SQLITE_OK);
+    auto schema = quiver::Schema::from_database(db);
+    sqlite3_close(db);
+
+    EXPECT_EQ(schema.group_names("Items", quiver::GroupTableType::Vector),
+              (std::vector<std::string>{"amount", "values"}));
+    EXPECT_EQ(schema.group_names("Items", quiver::GroupTableType::Set), std::vector<std::string>{"amounts"});
+    EXPECT_EQ(schema.group_names("Items", quiver::GroupTableType::TimeSeries), std::vector<std::string>{"data"});
+    EXPECT_TRUE(schema.group_names("Missing", quiver::GroupTableType::Vector).empty());
+
+    // The vector table named after the column first, then every other holder by table name.
+    std::vector<std::string> tables;
+    for (const auto& match : schema.find_all_tables_for_column("Items", "amount")) {
+        tables.push_back(match.table_name);
+    }
+    EXPECT_EQ(tables,
+              (std::vector<std::string>{
+                  "Items_vector_amount", "Items_set_amounts", "Items_time_series_data", "Items_vector_values"}));
+    EXPECT_TRUE(schema.find_all_tables_for_column("Items", "missing").empty());
+
+    EXPECT_EQ(schema.find_vector_table("Items", "amount"), "Items_vector_amount");
+    EXPECT_EQ(schema.find_set_table("Items", "amount"), "Items_set_amounts");
+    EXPECT_THROW(schema.find_set_table("Items", "value"), std::runtime_error);
+
+    // A copy gets its own index, pointing at its own tables.
+    auto copy = schema;
+    ASSERT_NE(copy.get_table("Items"), nullptr);
+    EXPECT_NE(copy.get_table("Items"), schema.get_table("Items"));
+    EXPECT_EQ(copy.find_all_tables_for_column("Items", "amount").size(), 4u);
+}
+
+TEST(SchemaLookup, LoadsColumnsForeignKeysAndIndexes) {
+    sqlite3* db = nullptr;
+    ASSERT_EQ(sqlite3_open(":memory:", &db), SQLITE_OK);
+    ASSERT_EQ(sqlite3_exec(db,
+                           "CREATE TABLE Parent (id INTEGER PRIMARY KEY, label TEXT NOT NULL DEFAULT 'x');"
+                           "CREATE TABLE Child (id INTEGER PRIMARY KEY, parent_id INTEGER, other_id INTEGER,"
+                           " date_created TEXT,"
+                           " FOREIGN KEY (parent_id) REFERENCES Parent(id) ON DELETE SET NULL,"
+                           " FOREIGN KEY (other_id) REFERENCES Parent(id) ON DELETE CASCADE);"
+                           "CREATE UNIQUE INDEX idx_child_pair ON Child (parent_id, other_id);"
+                           "CREATE INDEX idx_child_expr ON Child (parent_id + 1);",
+                           nullptr,
+                           nullptr,
+                           nullptr),
+              SQLITE_OK);
+    auto schema = quiver::Schema::from_database(db);
+    sqlite3_close(db);
+
+    const auto* parent = schema.get_table("Parent");
+    ASSERT_NE(parent, nullptr);
+    EXPECT_EQ(parent->column_order, (std::vector<std::string>{"id", "label"}));
+    EXPECT_TRUE(parent->get_column("id")->primary_key);
+    EXPECT_TRUE(parent->get_column("label")->not_null);
+    EXPECT_EQ(parent->get_column("label")->default_value, "'x'");
+    EXPECT_TRUE(parent->foreign_keys.empty());
+
+    const auto* child = schema.get_table("Child");
+    ASSERT_NE(child, nullptr);
+    EXPECT_EQ(child->get_data_type("date_created"), quiver::DataType::DateTime);
+    ASSERT_EQ(child->foreign_keys.size(), 2u);
+    std::vector<std::string> from_columns;
+    for (const auto& fk : child->foreign_keys) {
+        EXPECT_EQ(fk.to_table, "Parent");
+        EXPECT_EQ(fk.to_column, "id");
+        from_columns.push_back(fk.from_column);
+    }
+    std::sort(from_columns.begin(), from_columns.end());
+    EXPECT_EQ(from_columns, (std::vector<std::string>{"other_id", "parent_id"}));
+
+    ASSERT_EQ(child->indexes.size(), 2u);
+    for (const auto& index : child->indexes) {
+        if (index.name == "idx_child_pair") {
+            EXPECT_TRUE(index.unique);
+            EXPECT_EQ(index.columns, (std::vector<std::string>{"parent_id", "other_id"}));
+        } else {
+            EXPECT_EQ(index.name, "idx_child_expr");
+            EXPECT_FALSE(index.unique);
+            EXPECT_TRUE(index.columns.empty());
+        }
+    }
+}
+
+// ============================================================================
+// Validated-schema fingerprint
+// ============================================================================
+
+TEST_F(SchemaValidatorFixture, FingerprintSkipsRevalidationUntilSchemaChanges) {
+    const auto path = (std::filesystem::temp_directory_path() / "quiver_fingerprint_test.db").string();
+    quiver::Database::from_schema(path, VALID_SCHEMA("basic.sql"), options);
+
+    sqlite3* raw = nullptr;
+    ASSERT_EQ(sqlite3_open(path.c_str(), &raw), SQLITE_OK);
+    const auto stored = [raw] {
+        sqlite3_stmt* stmt = nullptr;
+        EXPECT_EQ(sqlite3_prepare_v2(raw, "SELECT fingerprint FROM quiver_schema_fingerprint", -1, &stmt, nullptr),
+                  SQLITE_OK);
+        std::string value;
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            value = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+        }
+        sqlite3_finalize(stmt);
+        return value;
+    };
+    const auto current = [raw] {
+        return std::to_string(quiver::SchemaValidator::kRevision) + ":" + quiver::Schema::fingerprint(raw);
+    };
+    EXPECT_EQ(stored(), current());
+    EXPECT_FALSE(quiver::Schema::from_database(raw).has_table(quiver::Schema::kFingerprintTable));
+
+    // A schema change no longer matches, so the next open validates again - and rejects this one.
+    ASSERT_EQ(sqlite3_exec(raw, "CREATE TABLE Bad_name (id INTEGER PRIMARY KEY)", nullptr, nullptr, nullptr),
+              SQLITE_OK);
+    EXPECT_NE(stored(), current());
+    EXPECT_THROW(quiver::Database(path, options).read_element_ids("Configuration"), std::runtime_error);
+
+    // With a matching fingerprint on record the same schema is taken as validated.
+    const auto record = "UPDATE quiver_schema_fingerprint SET fingerprint = '" + current() + "'";
+    ASSERT_EQ(sqlite3_exec(raw, record.c_str(), nullptr, nullptr, nullptr), SQLITE_OK);
+    EXPECT_NO_THROW(quiver::Database(path, options).read_element_ids("Configuration"));
+
+    // Opening never writes one: only schema writers (apply_schema, migrate_up, ensure_indexes) do.
+    ASSERT_EQ(sqlite3_exec(raw, "DROP TABLE Bad_name; DROP TABLE quiver_schema_fingerprint", nullptr, nullptr, nullptr),
+              SQLITE_OK);
+    quiver::Database(path, options).read_element_ids("Configuration");
+    EXPECT_EQ(sqlite3_exec(raw, "SELECT 1 FROM quiver_schema_fingerprint", nullptr, nullptr, nullptr), SQLITE_ERROR);
+
+    sqlite3_close(raw);
+    std::filesystem::remove(path);
+}